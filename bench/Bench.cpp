@@ -0,0 +1,13 @@
+#include "Bench.h"
+
+volatile uint64_t laibench::g_sink = 0;
+
+void laibench::compare(
+        _In_ const char* name,
+        _In_ double baselineNs,
+        _In_ double optimizedNs)
+{
+    SWSS_LOG_ENTER();
+
+    printf("%-48s %12.1fx\n", name, (optimizedNs > 0) ? baselineNs / optimizedNs : 0.0);
+}
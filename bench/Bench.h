@@ -0,0 +1,62 @@
+#pragma once
+
+#include "swss/sal.h"
+#include "swss/logger.h"
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+namespace laibench
+{
+    /**
+     * @brief Value returned by benchmarked operations is accumulated here,
+     * so compiler can't optimize operation away.
+     */
+    extern volatile uint64_t g_sink;
+
+    /**
+     * @brief Run operation given number of times and print average time
+     * per operation.
+     *
+     * Operation gets iteration number and returns any value which depends
+     * on its result. If single operation processes batch of samples, time
+     * is reported per sample.
+     */
+    template <typename Op>
+    double run(
+            _In_ const char* name,
+            _In_ uint64_t iterations,
+            _In_ Op op,
+            _In_ uint64_t samples = 1)
+    {
+        SWSS_LOG_ENTER();
+
+        uint64_t sum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            sum += (uint64_t)op(i);
+        }
+
+        auto stop = std::chrono::steady_clock::now();
+
+        g_sink = g_sink + sum;
+
+        double ns = std::chrono::duration<double, std::nano>(stop - start).count() / (double)(iterations * samples);
+
+        printf("%-48s %12.1f ns/op\n", name, ns);
+
+        return ns;
+    }
+
+    /**
+     * @brief Print speedup of optimized operation over baseline.
+     */
+    void compare(
+            _In_ const char* name,
+            _In_ double baselineNs,
+            _In_ double optimizedNs);
+}
@@ -0,0 +1,187 @@
+#include "Bench.h"
+
+#include "BinaryRecordFormat.h"
+
+#include "meta/lai_serialize.h"
+#include "meta/LaiAttributeList.h"
+#include "meta/MetadataIndex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+/*
+ * Compares recording of set/get records with scalar attributes: text line
+ * joined from serialized attributes, the same line encoded to binary record
+ * as binary recorder did before, and binary record encoded directly from
+ * attribute list.
+ */
+
+#define ITERATIONS 1000000
+
+#define RECORD_ATTR_COUNT 8
+
+std::string joinFieldValues(
+        _In_ const std::vector<swss::FieldValueTuple> &values);
+
+typedef struct _BenchRecord
+{
+    lai_object_type_t m_objectType;
+
+    std::string m_key;
+
+    std::vector<lai_attribute_t> m_attrs;
+
+} BenchRecord;
+
+static bool generateValue(
+        _In_ const lai_attr_metadata_t* md,
+        _In_ uint32_t index,
+        _Out_ lai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    memset(&attr, 0, sizeof(attr));
+
+    attr.id = md->attrid;
+
+    if (md->isenum && md->enummetadata && md->enummetadata->valuescount)
+    {
+        attr.value.s32 = md->enummetadata->values[index % md->enummetadata->valuescount];
+
+        return true;
+    }
+
+    switch (md->attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_BOOL:
+            attr.value.booldata = (index % 2) != 0;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+            attr.value.u8 = (uint8_t)index;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+            attr.value.u16 = (uint16_t)index;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_UINT32:
+            attr.value.u32 = index * 1000;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_INT32:
+            attr.value.s32 = -(int32_t)index;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_UINT64:
+            attr.value.u64 = (uint64_t)index * 1000000007;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:
+            attr.value.d64 = (double)index / 100;
+            return true;
+
+        case LAI_ATTR_VALUE_TYPE_CHARDATA:
+            snprintf(attr.value.chardata, sizeof(attr.value.chardata), "bench-%u", index);
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static void generateRecords(
+        _Out_ std::vector<BenchRecord>& records)
+{
+    SWSS_LOG_ENTER();
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        auto objectType = (lai_object_type_t)otmeta->values[i];
+
+        auto info = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(objectType);
+
+        if (info == nullptr)
+        {
+            continue;
+        }
+
+        BenchRecord record;
+
+        record.m_objectType = objectType;
+        record.m_key = lai_serialize_object_type(objectType) + ":oid:0x10000000000001";
+
+        for (size_t idx = 0; info->attrmetadata[idx] != nullptr && record.m_attrs.size() < RECORD_ATTR_COUNT; idx++)
+        {
+            lai_attribute_t attr;
+
+            if (generateValue(info->attrmetadata[idx], (uint32_t)idx, attr))
+            {
+                record.m_attrs.push_back(attr);
+            }
+        }
+
+        if (record.m_attrs.size())
+        {
+            records.push_back(record);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<BenchRecord> records;
+
+    generateRecords(records);
+
+    if (records.empty())
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::string buffer;
+    std::string tokens;
+
+    double text;
+    double binaryFromLine;
+    double binaryFromAttrs;
+
+    text = laibench::run("text line", ITERATIONS, [&](uint64_t i) {
+            auto& r = records[i % records.size()];
+            auto entry = laimeta::LaiAttributeList::serialize_attr_list(r.m_objectType, (uint32_t)r.m_attrs.size(), r.m_attrs.data(), false);
+            auto line = "s|" + r.m_key + "|" + joinFieldValues(entry);
+            return line.size(); });
+
+    binaryFromLine = laibench::run("binary record from text line", ITERATIONS, [&](uint64_t i) {
+            auto& r = records[i % records.size()];
+            auto entry = laimeta::LaiAttributeList::serialize_attr_list(r.m_objectType, (uint32_t)r.m_attrs.size(), r.m_attrs.data(), false);
+            buffer.clear();
+            lairedis::BinaryRecordFormat::encodeRecord(buffer, i, "s|" + r.m_key + "|" + joinFieldValues(entry));
+            return buffer.size(); });
+
+    binaryFromAttrs = laibench::run("binary record from attributes", ITERATIONS, [&](uint64_t i) {
+            auto& r = records[i % records.size()];
+            tokens.clear();
+            lairedis::BinaryRecordFormat::appendStringToken(tokens, "s", 1);
+            lairedis::BinaryRecordFormat::appendStringToken(tokens, r.m_key.data(), r.m_key.size());
+            for (auto& attr: r.m_attrs)
+            {
+                auto md = lai_metadata_get_attr_metadata(r.m_objectType, attr.id);
+                lairedis::BinaryRecordFormat::appendAttrToken(tokens, *md, attr, false);
+            }
+            buffer.clear();
+            lairedis::BinaryRecordFormat::appendRecord(buffer, i, 2 + r.m_attrs.size(), tokens);
+            return buffer.size(); });
+
+    laibench::compare("binary from attributes vs text line", text, binaryFromAttrs);
+    laibench::compare("binary from attributes vs from text line", binaryFromLine, binaryFromAttrs);
+
+    return EXIT_SUCCESS;
+}
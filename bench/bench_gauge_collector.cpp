@@ -0,0 +1,88 @@
+#include "Bench.h"
+
+#include "pm/Collector.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <vector>
+
+/*
+ * Per sample cost of power gauge conversions done by gauge collector,
+ * scalar pow/log10 used before against batch conversion. Each sample is
+ * converted from dBm to mW for averaging and average is converted back.
+ */
+
+#define GAUGE_COUNT 256
+#define ROUNDS 20000
+
+/**
+ * @brief Exposes batch conversions of Collector, object is never created.
+ */
+class GaugeConversions:
+    public syncd::Collector
+{
+    public:
+
+        using syncd::Collector::convertdBm2MilliWatt;
+
+        using syncd::Collector::convertMilliWatt2dBm;
+};
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<double> dbm(GAUGE_COUNT);
+    std::vector<double> mw(GAUGE_COUNT);
+    std::vector<double> avg(GAUGE_COUNT);
+
+    // typical optical power range: -40 dBm .. 25 dBm
+
+    for (size_t i = 0; i < GAUGE_COUNT; i++)
+    {
+        dbm[i] = -40.0 + 65.0 * (double)i / GAUGE_COUNT;
+    }
+
+    printf("gauges: %d\n", GAUGE_COUNT);
+
+    double before;
+    double after;
+
+    before = laibench::run("dBm -> mW (pow)", ROUNDS, [&](uint64_t r) {
+            for (size_t i = 0; i < GAUGE_COUNT; i++)
+            {
+                mw[i] = pow(10.0, (dbm[i] / 10.0));
+            }
+            return (uint64_t)(1000.0 * mw[r % GAUGE_COUNT]); }, GAUGE_COUNT);
+
+    after = laibench::run("dBm -> mW (batch)", ROUNDS, [&](uint64_t r) {
+            GaugeConversions::convertdBm2MilliWatt(dbm.data(), mw.data(), GAUGE_COUNT);
+            return (uint64_t)(1000.0 * mw[r % GAUGE_COUNT]); }, GAUGE_COUNT);
+
+    laibench::compare("dBm -> mW speedup", before, after);
+
+    before = laibench::run("mW -> dBm (log10)", ROUNDS, [&](uint64_t r) {
+            for (size_t i = 0; i < GAUGE_COUNT; i++)
+            {
+                avg[i] = 10.0 * log10(fabs(mw[i]) < 1.0e-20 ? 1 : mw[i]);
+            }
+            return (uint64_t)(avg[r % GAUGE_COUNT] + 1000.0); }, GAUGE_COUNT);
+
+    after = laibench::run("mW -> dBm (batch)", ROUNDS, [&](uint64_t r) {
+            GaugeConversions::convertMilliWatt2dBm(mw.data(), avg.data(), GAUGE_COUNT);
+            return (uint64_t)(avg[r % GAUGE_COUNT] + 1000.0); }, GAUGE_COUNT);
+
+    laibench::compare("mW -> dBm speedup", before, after);
+
+    double maxError = 0;
+
+    for (size_t i = 0; i < GAUGE_COUNT; i++)
+    {
+        maxError = fmax(maxError, fabs(avg[i] - dbm[i]));
+    }
+
+    printf("%-48s %12.3g dB\n", "max round trip error", maxError);
+
+    return EXIT_SUCCESS;
+}
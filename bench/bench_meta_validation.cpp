@@ -0,0 +1,357 @@
+#include "Bench.h"
+
+#include "meta/Meta.h"
+#include "meta/MetadataIndex.h"
+#include "meta/DummyLaiInterface.h"
+#include "meta/lai_serialize.h"
+
+#include "ObjectIdLayout.h"
+#include "VirtualObjectIdManager.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+/*
+ * Cost of meta validation of create, set, get and remove on 10k objects.
+ * Implementation behind meta only allocates object ids, so measured time
+ * is validation and metadata database update.
+ */
+
+#define OBJECT_COUNT 10000
+#define ITERATIONS 1000000
+
+/**
+ * @brief Dummy implementation which allocates virtual object ids.
+ */
+class BenchLaiInterface:
+    public laimeta::DummyLaiInterface
+{
+    public:
+
+        BenchLaiInterface():
+            m_index(0)
+        {
+            SWSS_LOG_ENTER();
+
+            // empty
+        }
+
+        virtual ~BenchLaiInterface() = default;
+
+    public:
+
+        virtual lai_status_t create(
+                _In_ lai_object_type_t objectType,
+                _Out_ lai_object_id_t* objectId,
+                _In_ lai_object_id_t linecardId,
+                _In_ uint32_t attr_count,
+                _In_ const lai_attribute_t *attr_list) override
+        {
+            SWSS_LOG_ENTER();
+
+            uint64_t index = (objectType == LAI_OBJECT_TYPE_LINECARD) ? 0 : ++m_index;
+
+            *objectId = lairedis::RedisObjectIdLayout::construct(objectType, 0, index, 0);
+
+            return LAI_STATUS_SUCCESS;
+        }
+
+        virtual lai_object_type_t objectTypeQuery(
+                _In_ lai_object_id_t objectId) override
+        {
+            SWSS_LOG_ENTER();
+
+            return lairedis::VirtualObjectIdManager::objectTypeQuery(objectId);
+        }
+
+        virtual lai_object_id_t linecardIdQuery(
+                _In_ lai_object_id_t objectId) override
+        {
+            SWSS_LOG_ENTER();
+
+            return lairedis::VirtualObjectIdManager::linecardIdQuery(objectId);
+        }
+
+    private:
+
+        uint64_t m_index;
+};
+
+typedef struct _BenchObject
+{
+    lai_object_type_t m_objectType;
+
+    lai_object_id_t m_objectId;
+
+    std::vector<lai_attribute_t> m_attrs;
+
+    /**
+     * @brief Index of create and set attribute in m_attrs, or -1.
+     */
+    int m_setIndex;
+
+} BenchObject;
+
+/**
+ * @brief Generate mandatory and key attributes, values are based on index
+ * so keys are unique.
+ */
+static bool generateAttributes(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t index,
+        _Out_ BenchObject& obj)
+{
+    SWSS_LOG_ENTER();
+
+    obj.m_objectType = objectType;
+    obj.m_objectId = LAI_NULL_OBJECT_ID;
+    obj.m_attrs.clear();
+    obj.m_setIndex = -1;
+
+    auto info = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(objectType);
+
+    if (info == nullptr)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; info->attrmetadata[i] != nullptr; ++i)
+    {
+        const auto* md = info->attrmetadata[i];
+
+        bool mandatory = LAI_HAS_FLAG_MANDATORY_ON_CREATE(md->flags) && !md->isconditional;
+
+        if (!mandatory && !LAI_HAS_FLAG_KEY(md->flags))
+        {
+            continue;
+        }
+
+        lai_attribute_t attr;
+
+        memset(&attr, 0, sizeof(attr));
+
+        attr.id = md->attrid;
+
+        uint64_t value = (uint64_t)index + 1;
+
+        uint64_t max = std::numeric_limits<int32_t>::max();
+
+        if (md->isenum && md->enummetadata && md->enummetadata->valuescount)
+        {
+            attr.value.s32 = md->enummetadata->values[index % md->enummetadata->valuescount];
+        }
+        else
+        {
+            switch (md->attrvaluetype)
+            {
+                case LAI_ATTR_VALUE_TYPE_BOOL:
+                    attr.value.booldata = false;
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_UINT8:
+                    attr.value.u8 = (uint8_t)value;
+                    max = std::numeric_limits<uint8_t>::max();
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_UINT16:
+                    attr.value.u16 = (uint16_t)value;
+                    max = std::numeric_limits<uint16_t>::max();
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_UINT32:
+                    attr.value.u32 = (uint32_t)value;
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_INT32:
+                    attr.value.s32 = (int32_t)value;
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_UINT64:
+                    attr.value.u64 = value;
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_DOUBLE:
+                    attr.value.d64 = 0.0;
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_CHARDATA:
+                    snprintf(attr.value.chardata, sizeof(attr.value.chardata), "bench-%u", index);
+                    break;
+
+                default:
+                    return false;
+            }
+        }
+
+        if (value > max)
+        {
+            return false;
+        }
+
+        if (obj.m_setIndex < 0 && LAI_HAS_FLAG_CREATE_AND_SET(md->flags))
+        {
+            obj.m_setIndex = (int)obj.m_attrs.size();
+        }
+
+        obj.m_attrs.push_back(attr);
+    }
+
+    return true;
+}
+
+static void benchMetadataLookup()
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    std::vector<const lai_attr_metadata_t*> attrs;
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        auto info = lai_metadata_get_object_type_info((lai_object_type_t)otmeta->values[i]);
+
+        for (size_t idx = 0; info && info->attrmetadata[idx] != NULL; idx++)
+        {
+            attrs.push_back(info->attrmetadata[idx]);
+        }
+    }
+
+    if (attrs.empty())
+    {
+        return;
+    }
+
+    double before;
+    double after;
+
+    before = laibench::run("attr metadata (lai_metadata)", ITERATIONS, [&](uint64_t i) {
+            auto md = attrs[i % attrs.size()];
+            return (uintptr_t)lai_metadata_get_attr_metadata(md->objecttype, md->attrid); });
+
+    after = laibench::run("attr metadata (MetadataIndex)", ITERATIONS, [&](uint64_t i) {
+            auto md = attrs[i % attrs.size()];
+            return (uintptr_t)index.getAttrMetadata(md->objecttype, md->attrid); });
+
+    laibench::compare("attr metadata speedup", before, after);
+
+    before = laibench::run("object type info (lai_metadata)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)lai_metadata_get_object_type_info(attrs[i % attrs.size()]->objecttype); });
+
+    after = laibench::run("object type info (MetadataIndex)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)index.getObjectTypeInfo(attrs[i % attrs.size()]->objecttype); });
+
+    laibench::compare("object type info speedup", before, after);
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    benchMetadataLookup();
+
+    auto meta = std::make_shared<laimeta::Meta>(std::make_shared<BenchLaiInterface>());
+
+    BenchObject linecard;
+
+    if (!generateAttributes(LAI_OBJECT_TYPE_LINECARD, 0, linecard) ||
+            meta->create(LAI_OBJECT_TYPE_LINECARD, &linecard.m_objectId, LAI_NULL_OBJECT_ID,
+                (uint32_t)linecard.m_attrs.size(), linecard.m_attrs.data()) != LAI_STATUS_SUCCESS)
+    {
+        printf("failed to create linecard\n");
+
+        return EXIT_FAILURE;
+    }
+
+    lai_object_id_t linecardId = linecard.m_objectId;
+
+    // use all object types for which attributes can be generated
+
+    std::vector<lai_object_type_t> objectTypes;
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        auto ot = (lai_object_type_t)otmeta->values[i];
+
+        if (ot == LAI_OBJECT_TYPE_NULL || ot == LAI_OBJECT_TYPE_LINECARD)
+        {
+            continue;
+        }
+
+        BenchObject obj;
+
+        if (!generateAttributes(ot, OBJECT_COUNT, obj))
+        {
+            continue;
+        }
+
+        if (meta->create(ot, &obj.m_objectId, linecardId, (uint32_t)obj.m_attrs.size(), obj.m_attrs.data()) != LAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        meta->remove(ot, obj.m_objectId);
+
+        objectTypes.push_back(ot);
+    }
+
+    if (objectTypes.empty())
+    {
+        printf("no object type can be created\n");
+
+        return EXIT_FAILURE;
+    }
+
+    std::vector<BenchObject> objects(OBJECT_COUNT);
+
+    std::vector<size_t> settable;
+
+    for (size_t i = 0; i < OBJECT_COUNT; i++)
+    {
+        generateAttributes(objectTypes[i % objectTypes.size()], (uint32_t)(i / objectTypes.size()), objects[i]);
+
+        if (objects[i].m_setIndex >= 0)
+        {
+            settable.push_back(i);
+        }
+    }
+
+    printf("objects: %d, object types: %zu, settable objects: %zu\n", OBJECT_COUNT, objectTypes.size(), settable.size());
+
+    size_t failures = 0;
+
+    auto check = [&](lai_status_t status) {
+        failures += (status != LAI_STATUS_SUCCESS);
+        return status; };
+
+    laibench::run("create", OBJECT_COUNT, [&](uint64_t i) {
+            auto& obj = objects[i];
+            return check(meta->create(obj.m_objectType, &obj.m_objectId, linecardId, (uint32_t)obj.m_attrs.size(), obj.m_attrs.data())); });
+
+    if (!settable.empty())
+    {
+        laibench::run("set", OBJECT_COUNT, [&](uint64_t i) {
+                auto& obj = objects[settable[i % settable.size()]];
+                return check(meta->set(obj.m_objectType, obj.m_objectId, &obj.m_attrs[obj.m_setIndex])); });
+    }
+
+    laibench::run("get", OBJECT_COUNT, [&](uint64_t i) {
+            auto& obj = objects[i];
+            return check(meta->get(obj.m_objectType, obj.m_objectId, (uint32_t)obj.m_attrs.size(), obj.m_attrs.data())); });
+
+    laibench::run("remove", OBJECT_COUNT, [&](uint64_t i) {
+            auto& obj = objects[i];
+            return check(meta->remove(obj.m_objectType, obj.m_objectId)); });
+
+    printf("failed operations: %zu\n", failures);
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+#include "Bench.h"
+
+#include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+/*
+ * Compares name lookups done by MetadataIndex with metadata linear scans
+ * used by serialize functions before index was added.
+ */
+
+#define ITERATIONS 1000000
+
+static int32_t linearDeserializeEnum(
+        _In_ const std::string& s,
+        _In_ const lai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < meta->valuescount; ++i)
+    {
+        if (strcmp(s.c_str(), meta->valuesnames[i]) == 0 ||
+            strcmp(s.c_str(), meta->valuesshortnames[i]) == 0)
+        {
+            return meta->values[i];
+        }
+    }
+
+    return -1;
+}
+
+static const char* linearSerializeEnum(
+        _In_ int32_t value,
+        _In_ const lai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < meta->valuescount; ++i)
+    {
+        if (meta->values[i] == value)
+        {
+            return meta->valuesnames[i];
+        }
+    }
+
+    return nullptr;
+}
+
+static void collectNames(
+        _Out_ std::vector<std::string>& attrNames,
+        _Out_ std::vector<std::string>& statNames)
+{
+    SWSS_LOG_ENTER();
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        auto info = lai_metadata_get_object_type_info((lai_object_type_t)otmeta->values[i]);
+
+        if (info == NULL)
+        {
+            continue;
+        }
+
+        for (size_t idx = 0; info->attrmetadata && info->attrmetadata[idx] != NULL; idx++)
+        {
+            attrNames.push_back(info->attrmetadata[idx]->attridname);
+        }
+
+        for (size_t idx = 0; info->statenum && idx < info->statenum->valuescount; idx++)
+        {
+            statNames.push_back(info->statenum->valuesnames[idx]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    std::vector<std::string> attrNames;
+    std::vector<std::string> statNames;
+
+    collectNames(attrNames, statNames);
+
+    printf("attributes: %zu, stats: %zu\n", attrNames.size(), statNames.size());
+
+    const lai_enum_metadata_t* em = &lai_metadata_enum_lai_alarm_type_t;
+
+    std::vector<std::string> enumNames(em->valuesnames, em->valuesnames + em->valuescount);
+
+    double before;
+    double after;
+
+    before = laibench::run("enum name -> value (linear)", ITERATIONS, [&](uint64_t i) {
+            return linearDeserializeEnum(enumNames[i % enumNames.size()], em); });
+
+    after = laibench::run("enum name -> value (lai_deserialize_enum)", ITERATIONS, [&](uint64_t i) {
+            int32_t value;
+            lai_deserialize_enum(enumNames[i % enumNames.size()], em, value);
+            return value; });
+
+    laibench::compare("enum name -> value speedup", before, after);
+
+    before = laibench::run("enum value -> name (linear)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)linearSerializeEnum(em->values[i % em->valuescount], em); });
+
+    after = laibench::run("enum value -> name (MetadataIndex)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)index.getEnumName(em, em->values[i % em->valuescount], false); });
+
+    laibench::compare("enum value -> name speedup", before, after);
+
+    before = laibench::run("attr id name (linear)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)lai_metadata_get_attr_metadata_by_attr_id_name(attrNames[i % attrNames.size()].c_str()); });
+
+    after = laibench::run("attr id name (lai_deserialize_attr_id)", ITERATIONS, [&](uint64_t i) {
+            const lai_attr_metadata_t* md;
+            lai_deserialize_attr_id(attrNames[i % attrNames.size()], &md);
+            return (uintptr_t)md; });
+
+    laibench::compare("attr id name speedup", before, after);
+
+    if (statNames.empty())
+    {
+        return EXIT_SUCCESS;
+    }
+
+    before = laibench::run("stat id name (linear)", ITERATIONS, [&](uint64_t i) {
+            return (uintptr_t)lai_metadata_get_stat_metadata_by_stat_id_name(statNames[i % statNames.size()].c_str()); });
+
+    after = laibench::run("stat id name (lai_deserialize_stat_id)", ITERATIONS, [&](uint64_t i) {
+            const lai_stat_metadata_t* md;
+            lai_deserialize_stat_id(statNames[i % statNames.size()], &md);
+            return (uintptr_t)md; });
+
+    laibench::compare("stat id name speedup", before, after);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+#include "Bench.h"
+
+#include "ObjectIdLayout.h"
+#include "VirtualObjectIdManager.h"
+#include "RealObjectIdManager.h"
+
+#include <stdlib.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+/*
+ * Object id construct and decode throughput, using shared layout directly
+ * and through virtual (VID) and real (RID) object id managers. Allocation
+ * index counter is compared with std::map used before.
+ */
+
+#define ITERATIONS 10000000
+#define ALLOCATIONS 1000000
+
+int main(int argc, char **argv)
+{
+    SWSS_LOG_ENTER();
+
+    typedef lairedis::VsObjectIdLayout VsLayout;
+    typedef lairedis::RedisObjectIdLayout RedisLayout;
+
+    std::vector<lai_object_type_t> objectTypes;
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        auto ot = (lai_object_type_t)otmeta->values[i];
+
+        if (ot != LAI_OBJECT_TYPE_NULL && ot != LAI_OBJECT_TYPE_LINECARD && ot < LAI_OBJECT_TYPE_EXTENSIONS_MAX)
+        {
+            objectTypes.push_back(ot);
+        }
+    }
+
+    size_t count = objectTypes.size();
+
+    // power of 2 sized inputs, so iteration is mapped to input by mask
+
+    std::vector<lai_object_type_t> types;
+    std::vector<lai_object_id_t> rids;
+    std::vector<lai_object_id_t> vids;
+
+    for (uint64_t i = 0; i < 4096; i++)
+    {
+        types.push_back(objectTypes[i % count]);
+        rids.push_back(VsLayout::construct(objectTypes[i % count], (uint32_t)(i % 4), i, 0));
+        vids.push_back(RedisLayout::construct(objectTypes[i % count], (uint32_t)(i % 4), i, 0));
+    }
+
+    size_t mask = rids.size() - 1;
+
+    laibench::run("layout construct", ITERATIONS, [&](uint64_t i) {
+            return VsLayout::construct(types[i & mask], (uint32_t)(i & 0xff), i & VsLayout::OBJECT_INDEX_MAX, 0); });
+
+    laibench::run("layout decode type/linecard/index", ITERATIONS, [&](uint64_t i) {
+            auto oid = rids[i & mask];
+            return VsLayout::getObjectType(oid) + VsLayout::getLinecardIndex(oid) + VsLayout::getObjectIndex(oid); });
+
+    laibench::run("RID objectTypeQuery", ITERATIONS, [&](uint64_t i) {
+            return laivs::RealObjectIdManager::objectTypeQuery(rids[i & mask]); });
+
+    laibench::run("RID linecardIdQuery", ITERATIONS, [&](uint64_t i) {
+            return laivs::RealObjectIdManager::linecardIdQuery(rids[i & mask]); });
+
+    laibench::run("VID objectTypeQuery", ITERATIONS, [&](uint64_t i) {
+            return lairedis::VirtualObjectIdManager::objectTypeQuery(vids[i & mask]); });
+
+    laibench::run("VID linecardIdQuery", ITERATIONS, [&](uint64_t i) {
+            return lairedis::VirtualObjectIdManager::linecardIdQuery(vids[i & mask]); });
+
+    // per type index counter, std::map used before fixed array
+
+    std::map<lai_object_type_t, uint64_t> mapIndexer;
+
+    std::array<uint64_t, LAI_OBJECT_TYPE_EXTENSIONS_MAX> arrayIndexer;
+
+    arrayIndexer.fill(0);
+
+    double before = laibench::run("index counter (std::map)", ITERATIONS, [&](uint64_t i) {
+            return mapIndexer[types[i & mask]]++; });
+
+    double after = laibench::run("index counter (std::array)", ITERATIONS, [&](uint64_t i) {
+            return arrayIndexer[types[i & mask]]++; });
+
+    laibench::compare("index counter speedup", before, after);
+
+    lai_object_id_t linecardId = VsLayout::construct(LAI_OBJECT_TYPE_LINECARD, 0, 0, 0);
+
+    laivs::RealObjectIdManager manager(0, std::make_shared<laivs::LinecardConfigContainer>());
+
+    laibench::run("RID allocateNewObjectId", ALLOCATIONS, [&](uint64_t i) {
+            return manager.allocateNewObjectId(types[i & mask], linecardId); });
+
+    return EXIT_SUCCESS;
+}
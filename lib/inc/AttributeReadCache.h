@@ -0,0 +1,112 @@
+#pragma once
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <map>
+#include <unordered_map>
+
+namespace lairedis
+{
+    /**
+     * @brief Attribute read cache.
+     *
+     * Holds serialized values of READ_ONLY attributes returned by syncd on
+     * GET api, so repeated GET of the same attribute within TTL can be served
+     * locally without round trip to syncd. CREATE_ONLY and CREATE_AND_SET
+     * attributes are not stored here, they are served from metadata database.
+     *
+     * Entries are invalidated per object on SET and REMOVE, and entire cache
+     * is invalidated when notification arrives, since notifications are the
+     * only way syncd tells us that read only state changed.
+     *
+     * Cache is accessed from api and notification threads, so it's guarded by
+     * internal mutex. Each invalidation bumps cache generation, GET reads
+     * generation before sending request and passes it to update, so response
+     * which was in flight during invalidation is not stored.
+     */
+    class AttributeReadCache
+    {
+        public:
+
+            AttributeReadCache();
+
+            virtual ~AttributeReadCache() = default;
+
+        public:
+
+            void setEnabled(
+                    _In_ bool enabled);
+
+            bool isEnabled() const;
+
+            /**
+             * @brief Set READ_ONLY attribute time to live in milliseconds.
+             *
+             * Zero means that READ_ONLY attributes are not cached at all.
+             */
+            void setTtl(
+                    _In_ uint64_t ttlMs);
+
+            /**
+             * @brief Get cached serialized attribute value.
+             *
+             * @return False if value is not cached or it's expired.
+             */
+            bool get(
+                    _In_ lai_object_id_t objectId,
+                    _In_ lai_attr_id_t attrId,
+                    _Out_ std::string& value);
+
+            /**
+             * @brief Get current cache generation.
+             *
+             * Must be obtained before GET request is sent.
+             */
+            uint64_t getGeneration() const;
+
+            /**
+             * @brief Store READ_ONLY attributes from successful GET response.
+             *
+             * Other attributes on the list are ignored. Nothing is stored if
+             * cache was invalidated since given generation was obtained.
+             */
+            void update(
+                    _In_ uint64_t generation,
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list);
+
+            void invalidate(
+                    _In_ lai_object_id_t objectId);
+
+            void clear();
+
+        private:
+
+            typedef struct _Entry
+            {
+                std::chrono::steady_clock::time_point m_timestamp;
+
+                std::string m_value;
+
+            } Entry;
+
+            mutable std::mutex m_mutex;
+
+            bool m_enabled;
+
+            std::chrono::milliseconds m_ttl;
+
+            uint64_t m_generation;
+
+            std::unordered_map<lai_object_id_t, std::map<lai_attr_id_t, Entry>> m_cache;
+    };
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include <string>
+#include <vector>
+
+/*
+ * Binary recording layout.
+ *
+ * File is a sequence of self describing blocks, so file can be appended after
+ * log rotate or restart without any global header:
+ *
+ *  block:  magic[4] flags[1] varint(rawSize) varint(storedSize) data[storedSize]
+ *  data:   zlib compressed when LAI_REDIS_BINARY_RECORD_FLAG_COMPRESSED is set,
+ *          after decompression it's a sequence of records
+ *  record: varint(size) varint(timestampDelta) varint(tokenCount) token...
+ *  token:  tag[1] followed by
+ *              TOKEN_STRING:     varint(len) bytes
+ *              TOKEN_ATTR:       varint(objectType) varint(attrId) varint(len) value
+ *              TOKEN_ATTR_VALUE: varint(objectType) varint(attrId) raw value
+ *  raw:    BOOL as single byte, unsigned integers and object ids as varint,
+ *          signed integers and enums as zigzag varint, DOUBLE as 8 bytes
+ *          little endian, CHARDATA as varint(len) bytes
+ *
+ * Tokens are text line fields split on '|', so converting record back to text
+ * produces exactly the same line as text recorder would produce. Attribute
+ * tokens "LAI_X_ATTR_Y=value" carry attribute id instead of attribute name.
+ * Records of create, set and get are encoded directly from attribute list,
+ * attributes of scalar types are stored as raw values, other attributes
+ * (lists and structures) keep serialized value.
+ *
+ * First record in block has absolute timestamp in microseconds since epoch,
+ * next records have delta to previous record.
+ */
+
+#define LAI_REDIS_BINARY_RECORD_MAGIC "LRB1"
+
+#define LAI_REDIS_BINARY_RECORD_MAGIC_SIZE (4)
+
+#define LAI_REDIS_BINARY_RECORD_FLAG_COMPRESSED (0x01)
+
+/*
+ * 64 bit value takes at most 10 bytes when encoded as varint.
+ */
+#define LAI_REDIS_BINARY_RECORD_VARINT_MAX_SIZE (10)
+
+namespace lairedis
+{
+    class BinaryRecordFormat
+    {
+        private:
+
+            BinaryRecordFormat() = delete;
+            ~BinaryRecordFormat() = delete;
+
+        public:
+
+            enum Token
+            {
+                TOKEN_STRING = 0,
+
+                TOKEN_ATTR = 1,
+
+                TOKEN_ATTR_VALUE = 2,
+            };
+
+        public:
+
+            static void appendVarint(
+                    _Inout_ std::string& buffer,
+                    _In_ uint64_t value);
+
+            /**
+             * @brief Read varint from buffer.
+             *
+             * @return False if buffer ends before varint ends.
+             */
+            static bool readVarint(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset,
+                    _Out_ uint64_t& value);
+
+            /**
+             * @brief Encode text recording line (without timestamp) as binary record.
+             */
+            static void encodeRecord(
+                    _Inout_ std::string& buffer,
+                    _In_ uint64_t timestampDelta,
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Append record with already encoded tokens.
+             */
+            static void appendRecord(
+                    _Inout_ std::string& buffer,
+                    _In_ uint64_t timestampDelta,
+                    _In_ uint64_t tokenCount,
+                    _In_ const std::string& tokens);
+
+            static void appendStringToken(
+                    _Inout_ std::string& tokens,
+                    _In_ const char* data,
+                    _In_ size_t size);
+
+            /**
+             * @brief Append attribute token encoded from attribute.
+             *
+             * Scalar values are stored raw, other values are serialized,
+             * count only serialization is used for lists when requested.
+             */
+            static void appendAttrToken(
+                    _Inout_ std::string& tokens,
+                    _In_ const lai_attr_metadata_t& meta,
+                    _In_ const lai_attribute_t& attr,
+                    _In_ bool countOnly);
+
+            /**
+             * @brief Decode single binary record starting at offset back to text line.
+             *
+             * Throws on malformed record.
+             */
+            static std::string decodeRecord(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset,
+                    _Out_ uint64_t& timestampDelta);
+
+            static std::string compress(
+                    _In_ const std::string& raw);
+
+            static std::string uncompress(
+                    _In_ const std::string& stored,
+                    _In_ size_t rawSize);
+
+            /**
+             * @brief Format timestamp in microseconds since epoch as
+             * recording line timestamp.
+             */
+            static std::string serializeTimestamp(
+                    _In_ uint64_t microseconds);
+
+            /**
+             * @brief Parse recording line timestamp back to microseconds
+             * since epoch.
+             *
+             * @return False if string is not a recording timestamp.
+             */
+            static bool deserializeTimestamp(
+                    _In_ const std::string& timestamp,
+                    _Out_ uint64_t& microseconds);
+
+        private:
+
+            static void appendString(
+                    _Inout_ std::string& buffer,
+                    _In_ const char* data,
+                    _In_ size_t size);
+
+            static void appendToken(
+                    _Inout_ std::string& buffer,
+                    _In_ const char* token,
+                    _In_ size_t size);
+
+            static std::string readString(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset);
+
+            static void readAttrValue(
+                    _In_ const std::string& buffer,
+                    _Inout_ size_t& offset,
+                    _In_ const lai_attr_metadata_t& meta,
+                    _Inout_ std::string& line);
+    };
+}
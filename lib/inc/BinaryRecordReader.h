@@ -0,0 +1,68 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <istream>
+
+namespace lairedis
+{
+    /**
+     * @brief Binary recording reader.
+     *
+     * Produces the same lines (including timestamp) as text recorder would
+     * write for recorded events.
+     */
+    class BinaryRecordReader
+    {
+        public:
+
+            BinaryRecordReader(
+                    _Inout_ std::istream& stream);
+
+            virtual ~BinaryRecordReader() = default;
+
+        public:
+
+            /**
+             * @brief Get next recorded line.
+             *
+             * @return False when end of recording was reached.
+             */
+            bool getline(
+                    _Out_ std::string& line);
+
+            /**
+             * @brief Get next recorded line without timestamp prefix.
+             *
+             * @param timestamp Record timestamp in microseconds since epoch.
+             *
+             * @return False when end of recording was reached.
+             */
+            bool getRecord(
+                    _Out_ uint64_t& timestamp,
+                    _Out_ std::string& record);
+
+        public:
+
+            /**
+             * @brief Check whether given file starts with binary block magic.
+             */
+            static bool isBinaryRecording(
+                    _In_ const std::string& fileName);
+
+        private:
+
+            bool readBlock();
+
+        private:
+
+            std::istream& m_stream;
+
+            std::string m_block;
+
+            size_t m_offset;
+
+            uint64_t m_timestamp;
+    };
+}
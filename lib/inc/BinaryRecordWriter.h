@@ -0,0 +1,75 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <ostream>
+
+namespace lairedis
+{
+    /**
+     * @brief Binary recording writer.
+     *
+     * Collects encoded records into block and writes whole block to output
+     * stream when block is full, when block is older than flush interval or
+     * when flush is explicitly requested.
+     */
+    class BinaryRecordWriter
+    {
+        public:
+
+            BinaryRecordWriter(
+                    _In_ bool compress);
+
+            virtual ~BinaryRecordWriter() = default;
+
+        public:
+
+            void write(
+                    _Inout_ std::ostream& stream,
+                    _In_ uint64_t timestamp,
+                    _In_ const std::string& line);
+
+            /**
+             * @brief Write record from already encoded tokens.
+             *
+             * Tokens are encoded by BinaryRecordFormat append token functions.
+             */
+            void writeRecord(
+                    _Inout_ std::ostream& stream,
+                    _In_ uint64_t timestamp,
+                    _In_ uint64_t tokenCount,
+                    _In_ const std::string& tokens);
+
+            void flush(
+                    _Inout_ std::ostream& stream);
+
+            /**
+             * @brief Flush block if it's older than flush interval.
+             *
+             * Called periodically, so idle recorder doesn't hold records.
+             */
+            void flushExpired(
+                    _Inout_ std::ostream& stream,
+                    _In_ uint64_t timestamp);
+
+        private:
+
+            uint64_t beginRecord(
+                    _In_ uint64_t timestamp);
+
+            void endRecord(
+                    _Inout_ std::ostream& stream,
+                    _In_ uint64_t timestamp);
+
+        private:
+
+            bool m_compress;
+
+            std::string m_block;
+
+            uint64_t m_blockTimestamp;
+
+            uint64_t m_lastTimestamp;
+    };
+}
@@ -35,6 +35,18 @@ namespace lairedis
 
             uint64_t getResponseTimeout() const;
 
+            /**
+             * @brief Set busy poll time in microseconds.
+             *
+             * When waiting for response, channel will poll for response
+             * without blocking for given time before blocking wait. Zero
+             * disables busy poll.
+             */
+            void setBusyPoll(
+                    _In_ uint64_t busyPollUs);
+
+            uint64_t getBusyPoll() const;
+
         public:
 
             virtual void setBuffered(
@@ -65,6 +77,8 @@ namespace lairedis
 
             uint64_t m_responseTimeoutMs;
 
+            uint64_t m_busyPollUs;
+
         protected: // notification
 
             /**
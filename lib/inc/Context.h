@@ -6,6 +6,8 @@
 
 #include "meta/Meta.h"
 
+#include <mutex>
+
 namespace lairedis
 {
     class Context
@@ -37,5 +39,14 @@ namespace lairedis
             std::shared_ptr<RedisRemoteLaiInterface> m_redisLai;
 
             std::function<lai_linecard_notifications_t(std::shared_ptr<Notification>, Context*)> m_notificationCallback;
+
+            /**
+             * @brief Context API mutex.
+             *
+             * Serializes API calls and notifications within single context,
+             * so meta validation state stays consistent, while calls to
+             * different contexts (syncd instances) can run in parallel.
+             */
+            std::recursive_mutex m_mutex;
     };
 }
@@ -14,6 +14,7 @@
 #include <memory>
 #include <mutex>
 #include <map>
+#include <atomic>
 
 namespace lairedis
 {
@@ -60,6 +61,16 @@ namespace lairedis
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual lai_status_t bulkGet(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const lai_object_id_t *object_id,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ lai_attribute_t **attr_list,
+                    _Out_ lai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual lai_status_t getStats(
@@ -129,6 +140,17 @@ namespace lairedis
                     _In_ lai_api_t api,
                     _In_ lai_log_level_t log_level) override;
 
+        public: // debug
+
+            /**
+             * @brief Dump metadata database of all contexts to file.
+             *
+             * Reads published metadata snapshots, so dump doesn't wait for
+             * API calls in progress and doesn't block them.
+             */
+            lai_status_t dbgGenerateDump(
+                    _In_ const char *dumpFileName);
+
         private:
 
             lai_linecard_notifications_t handle_notification(
@@ -138,10 +160,18 @@ namespace lairedis
             std::shared_ptr<Context> getContext(
                     _In_ uint32_t globalContext);
 
+            std::vector<std::shared_ptr<Context>> getAllContexts();
+
         private:
 
-            bool m_apiInitialized;
+            std::atomic<bool> m_apiInitialized;
 
+            /**
+             * @brief Global API mutex.
+             *
+             * Guards initialize/uninitialize and context map. API calls
+             * are serialized on Context::m_mutex of context they target.
+             */
             std::recursive_mutex m_apimutex;
 
             std::map<uint32_t, std::shared_ptr<Context>> m_contextMap;
@@ -71,6 +71,25 @@ namespace lairedis
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list);
 
+        public: // bulk QUAD oid
+
+            /**
+             * @brief Get attributes of multiple objects of the same type.
+             *
+             * Each object has its own attribute list and status. Default
+             * implementation executes GET on each object.
+             *
+             * @return #LAI_STATUS_SUCCESS if all objects succeeded,
+             * #LAI_STATUS_FAILURE if any object failed.
+             */
+            virtual lai_status_t bulkGet(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const lai_object_id_t *object_id,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ lai_attribute_t **attr_list,
+                    _Out_ lai_status_t *object_statuses);
+
         public: // stats API
 
             virtual lai_status_t getStats(
@@ -2,3 +2,5 @@
 
 #define MUTEX() std::lock_guard<std::recursive_mutex> _lock(m_apimutex)
 #define MUTEX_UNLOCK() m_apimutex.unlock()
+
+#define CONTEXT_MUTEX(ctx) std::lock_guard<std::recursive_mutex> _ctxlock((ctx)->m_mutex)
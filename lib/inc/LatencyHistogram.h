@@ -0,0 +1,90 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace lairediscommon
+{
+    /**
+     * @brief Latency histogram.
+     *
+     * Collects latency samples in microseconds into log-linear buckets (16
+     * buckets per power of two, so reported values are within ~6% of real
+     * value) and logs p50/p90/p99/max every limit samples.
+     */
+    class LatencyHistogram
+    {
+        public:
+
+            /**
+             * @brief Called with full histogram every limit samples, before
+             * histogram is reset.
+             */
+            typedef std::function<void(const LatencyHistogram&)> Callback;
+
+        public:
+
+            static constexpr unsigned int DEFAULT_LIMIT = 10000;
+
+        public:
+
+            LatencyHistogram(
+                    _In_ const std::string& msg,
+                    _In_ uint64_t limit = DEFAULT_LIMIT);
+
+            ~LatencyHistogram() = default; // non virtual
+
+        public:
+
+            void record(
+                    _In_ uint64_t latencyUs);
+
+            /**
+             * @brief Get percentile of collected samples.
+             *
+             * @param[in] percentile Percentile in range 0..100.
+             *
+             * @return Latency in microseconds (bucket lower bound).
+             */
+            uint64_t getPercentile(
+                    _In_ double percentile) const;
+
+            uint64_t getCount() const;
+
+            uint64_t getMax() const;
+
+            void setCallback(
+                    _In_ Callback callback);
+
+            void reset();
+
+        public:
+
+            static bool m_enable;
+
+        private:
+
+            static size_t bucketIndex(
+                    _In_ uint64_t value);
+
+            static uint64_t bucketValue(
+                    _In_ size_t index);
+
+        private:
+
+            std::string m_msg;
+
+            uint64_t m_limit;
+
+            uint64_t m_count;
+
+            uint64_t m_max;
+
+            std::vector<uint64_t> m_buckets;
+
+            Callback m_callback;
+    };
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+extern "C" {
+#include "lai.h"
+}
+
+#include <stdint.h>
+
+namespace lairedis
+{
+    /**
+     * @brief Object id bit layout.
+     *
+     * Linecard index, global context and object type are encoded on 8 bits
+     * each, object index takes given number of lowest bits. Decoding is plain
+     * shift and mask, so all methods are constexpr and can be inlined in hot
+     * paths and checked at compile time.
+     */
+    template <uint32_t linecardIndexShift, uint32_t globalContextShift, uint32_t objectTypeShift, uint32_t objectIndexBits>
+    class ObjectIdLayout
+    {
+        public:
+
+            ObjectIdLayout() = delete;
+
+            ~ObjectIdLayout() = delete;
+
+        public:
+
+            static constexpr uint32_t LINECARD_INDEX_BITS_SIZE = 8;
+
+            static constexpr uint32_t GLOBAL_CONTEXT_BITS_SIZE = 8;
+
+            static constexpr uint32_t OBJECT_TYPE_BITS_SIZE = 8;
+
+            static constexpr uint32_t OBJECT_INDEX_BITS_SIZE = objectIndexBits;
+
+            static constexpr uint64_t LINECARD_INDEX_MAX = (1ULL << LINECARD_INDEX_BITS_SIZE) - 1;
+
+            static constexpr uint64_t GLOBAL_CONTEXT_MAX = (1ULL << GLOBAL_CONTEXT_BITS_SIZE) - 1;
+
+            static constexpr uint64_t OBJECT_TYPE_MAX = (1ULL << OBJECT_TYPE_BITS_SIZE) - 1;
+
+            static constexpr uint64_t OBJECT_INDEX_MAX = (1ULL << OBJECT_INDEX_BITS_SIZE) - 1;
+
+            static_assert(linecardIndexShift + LINECARD_INDEX_BITS_SIZE <= 64, "linecard index must fit in object id");
+            static_assert(globalContextShift + GLOBAL_CONTEXT_BITS_SIZE <= 64, "global context must fit in object id");
+            static_assert(objectTypeShift + OBJECT_TYPE_BITS_SIZE <= 64, "object type must fit in object id");
+
+            static_assert(objectIndexBits <= linecardIndexShift &&
+                    objectIndexBits <= globalContextShift &&
+                    objectIndexBits <= objectTypeShift, "object index can't overlap other fields");
+
+            /*
+             * This condition must be met, since we need to be able to encode
+             * LAI object type in object id on defined number of bits.
+             */
+            static_assert(LAI_OBJECT_TYPE_EXTENSIONS_MAX < OBJECT_TYPE_MAX, "max object type value must be greater than supported LAI max object type value");
+
+        public:
+
+            static constexpr uint32_t getLinecardIndex(
+                    _In_ lai_object_id_t objectId)
+            {
+                return (uint32_t)(((uint64_t)objectId >> linecardIndexShift) & LINECARD_INDEX_MAX);
+            }
+
+            static constexpr uint32_t getGlobalContext(
+                    _In_ lai_object_id_t objectId)
+            {
+                return (uint32_t)(((uint64_t)objectId >> globalContextShift) & GLOBAL_CONTEXT_MAX);
+            }
+
+            static constexpr lai_object_type_t getObjectType(
+                    _In_ lai_object_id_t objectId)
+            {
+                return (lai_object_type_t)(((uint64_t)objectId >> objectTypeShift) & OBJECT_TYPE_MAX);
+            }
+
+            static constexpr uint64_t getObjectIndex(
+                    _In_ lai_object_id_t objectId)
+            {
+                return (uint64_t)objectId & OBJECT_INDEX_MAX;
+            }
+
+            /**
+             * @brief Construct object id.
+             *
+             * Values must be already in range, they are not masked.
+             */
+            static constexpr lai_object_id_t construct(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t linecardIndex,
+                    _In_ uint64_t objectIndex,
+                    _In_ uint32_t globalContext)
+            {
+                return (lai_object_id_t)(
+                        ((uint64_t)linecardIndex << linecardIndexShift) |
+                        ((uint64_t)globalContext << globalContextShift) |
+                        ((uint64_t)objectType << objectTypeShift) |
+                        objectIndex);
+            }
+    };
+
+    /*
+     * lairedis virtual object id format:
+     *
+     * bits 63..56 - linecard index
+     * bits 55..48 - LAI object type
+     * bits 47..40 - global context
+     * bits 39..0  - object index
+     */
+    typedef ObjectIdLayout<56, 40, 48, 40> RedisObjectIdLayout;
+
+    /*
+     * Virtual linecard real object id format:
+     *
+     * bits 63..56 - reserved (must be zero)
+     * bits 55..48 - global context
+     * bits 47..40 - linecard index
+     * bits 39..32 - LAI object type
+     * bits 31..0  - object index
+     */
+    typedef ObjectIdLayout<40, 48, 32, 32> VsObjectIdLayout;
+}
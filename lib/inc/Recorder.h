@@ -7,10 +7,15 @@ extern "C" {
 #include "swss/table.h"
 
 #include "lairedis.h" // for notify enum
+#include "BinaryRecordWriter.h"
 
 #include <string>
 #include <fstream>
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #define LAI_REDIS_RECORDER_DECLARE_RECORD_REMOVE(ot)    \
     void recordRemove(                                  \
@@ -98,6 +103,19 @@ namespace lairedis
                     _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& arguments);
 
+            /**
+             * @brief Record generic Create API with already serialized arguments.
+             *
+             * Text recording uses serialized arguments, binary recording
+             * encodes attributes directly from attribute list.
+             */
+            void recordGenericCreate(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list);
+
             /**
              * @brief Record generic Create API response.
              *
@@ -132,6 +150,12 @@ namespace lairedis
                     _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& arguments);
 
+            void recordGenericSet(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ lai_object_type_t objectType,
+                    _In_ const lai_attribute_t *attr);
+
             void recordGenericSetResponse(
                     _In_ lai_status_t status);
 
@@ -146,6 +170,13 @@ namespace lairedis
                     _In_ const std::string& key,
                     _In_ const std::vector<swss::FieldValueTuple>& arguments);
 
+            void recordGenericGet(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list);
+
             void recordGenericGetResponse(
                     _In_ lai_status_t status,
                     _In_ lai_object_type_t objectType,
@@ -251,6 +282,30 @@ namespace lairedis
                     _In_ uint32_t objectCount,
                     _In_ const lai_status_t *objectStatuses);
 
+            /**
+             * @brief Record bulk GET.
+             *
+             * Arguments are in bulk get channel layout, each (object_id,
+             * attr_count) field followed by attr_count attribute fields.
+             */
+            void recordBulkGenericGet(
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments);
+
+            /**
+             * @brief Record bulk GET response.
+             *
+             * Each object status is followed by attribute values of that
+             * object, same as GET response.
+             */
+            void recordBulkGenericGetResponse(
+                    _In_ lai_status_t status,
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t objectCount,
+                    _In_ const uint32_t *attr_count,
+                    _In_ lai_attribute_t **attr_list,
+                    _In_ const lai_status_t *objectStatuses);
+
         public: // LAI global interface API
 
             void recordObjectTypeGetAvailability(
@@ -342,12 +397,22 @@ namespace lairedis
             bool setRecordingFilename(
                     _In_ const lai_attribute_t &attr);
 
+            bool setRecordingFormat(
+                    _In_ const lai_attribute_t &attr);
+
             void requestLogRotate();
 
         public: // static helper functions
 
             static std::string getTimestamp();
 
+            /**
+             * @brief Format timestamp given in microseconds since epoch the
+             * same way as recording lines are timestamped.
+             */
+            static std::string getTimestamp(
+                    _In_ uint64_t microseconds);
+
             void recordStats(
                 _In_ bool enable);
 
@@ -381,6 +446,8 @@ namespace lairedis
 
             void recordingFileReopen();
 
+            std::ios_base::openmode getOpenMode() const;
+
             void startRecording();
 
             void stopRecording();
@@ -388,6 +455,37 @@ namespace lairedis
             void recordLine(
                     _In_ const std::string& line);
 
+            /**
+             * @brief Record line with attributes at the end.
+             *
+             * Binary recording encodes attributes from attribute list, text
+             * recording joins arguments, which are serialized from attribute
+             * list when empty.
+             */
+            void recordAttrLine(
+                    _In_ const std::string& op,
+                    _In_ const std::string& key,
+                    _In_ const std::vector<swss::FieldValueTuple>& arguments,
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list,
+                    _In_ bool countOnly);
+
+            void writeLine(
+                    _In_ const std::string& line);
+
+            void checkLogRotate();
+
+            void startFlushThread();
+
+            void stopFlushThread();
+
+            /**
+             * @brief Flushes binary writer and performs requested log rotate
+             * when no records are written.
+             */
+            void flushThreadProc();
+
         private:
 
             bool m_performLogRotate;
@@ -406,6 +504,18 @@ namespace lairedis
 
             std::ofstream m_ofstream;
 
+            lai_redis_recording_format_t m_recordingFormat;
+
+            std::shared_ptr<BinaryRecordWriter> m_binaryWriter;
+
+            std::string m_binaryTokens;
+
             std::mutex m_mutex;
+
+            bool m_flushThreadRun;
+
+            std::shared_ptr<std::thread> m_flushThread;
+
+            std::condition_variable m_flushCv;
     };
 }
@@ -7,14 +7,19 @@
 #include "Notification.h"
 #include "Recorder.h"
 #include "SkipRecordAttrContainer.h"
+#include "LatencyHistogram.h"
 
 #include "swss/producertable.h"
 #include "swss/consumertable.h"
 #include "swss/notificationconsumer.h"
 #include "swss/selectableevent.h"
+#include "swss/select.h"
+#include "swss/table.h"
 
 #include <memory>
 #include <functional>
+#include <chrono>
+#include <map>
 
 namespace lairedis
 {
@@ -55,6 +60,29 @@ namespace lairedis
 
             virtual void notificationThreadFunction() override;
 
+        private:
+
+            /**
+             * @brief Select on get consumer.
+             *
+             * If busy poll is enabled, polls without blocking for busy poll
+             * time before blocking select with response timeout.
+             */
+            int selectResponse(
+                    _Out_ swss::Selectable **sel);
+
+            /**
+             * @brief Record latency of last command sent to syncd.
+             */
+            void recordLatency();
+
+            /**
+             * @brief Write latency percentiles of command to latency table.
+             */
+            void publishLatency(
+                    _In_ const std::string& command,
+                    _In_ const lairediscommon::LatencyHistogram& histogram);
+
         private:
 
             std::string m_dbAsic;
@@ -73,6 +101,30 @@ namespace lairedis
              */
             std::shared_ptr<swss::ConsumerTable> m_getConsumer;
 
+            /**
+             * @brief Select used to wait for responses.
+             *
+             * Created once with get consumer, so waiting for response don't
+             * need to create and close epoll instance on every api call.
+             */
+            swss::Select m_getSelect;
+
+            std::string m_lastCommand;
+
+            std::chrono::steady_clock::time_point m_lastCommandStart;
+
+            /**
+             * @brief Latency of each command from sending it till response.
+             */
+            std::map<std::string, std::shared_ptr<lairediscommon::LatencyHistogram>> m_latency;
+
+            /**
+             * @brief Latency table, see REDIS_TABLE_LATENCY.
+             */
+            std::shared_ptr<swss::Table> m_latencyTable;
+
+            std::chrono::steady_clock::time_point m_lastLatencyPublish;
+
             std::shared_ptr<swss::DBConnector> m_db;
 
             std::shared_ptr<swss::RedisPipeline> m_redisPipeline;
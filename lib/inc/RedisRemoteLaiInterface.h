@@ -7,6 +7,7 @@
 #include "Recorder.h"
 #include "RedisVidIndexGenerator.h"
 #include "SkipRecordAttrContainer.h"
+#include "AttributeReadCache.h"
 #include "RedisChannel.h"
 #include "LinecardConfigContainer.h"
 #include "ContextConfig.h"
@@ -68,6 +69,16 @@ namespace lairedis
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual lai_status_t bulkGet(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const lai_object_id_t *object_id,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ lai_attribute_t **attr_list,
+                    _Out_ lai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual lai_status_t getStats(
@@ -187,6 +198,25 @@ namespace lairedis
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list);
 
+        private: // read cache
+
+            /**
+             * @brief Try to serve GET from local state.
+             *
+             * CREATE_ONLY and CREATE_AND_SET attributes are taken from
+             * metadata database, READ_ONLY attributes from read cache. All
+             * requested attributes must be available locally, otherwise
+             * nothing is transferred to user buffers.
+             *
+             * @return True if GET was served locally and status is set.
+             */
+            bool getFromReadCache(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId,
+                    _In_ uint32_t attr_count,
+                    _Inout_ lai_attribute_t *attr_list,
+                    _Out_ lai_status_t& status);
+
         private: // QUAD API response
 
             /**
@@ -246,6 +276,19 @@ namespace lairedis
                     _In_ uint32_t object_count,
                     _Out_ lai_status_t *object_statuses);
 
+            /**
+             * @brief Wait for bulk GET response.
+             *
+             * Will wait for response from syncd. Each successful object
+             * values will be deserialized and transferred to user buffers.
+             */
+            lai_status_t waitForBulkGetResponse(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ lai_attribute_t **attr_list,
+                    _Out_ lai_status_t *object_statuses);
+
         private: // LAI API response
 
             lai_status_t waitForQueryAttributeCapabilityResponse(
@@ -318,10 +361,14 @@ namespace lairedis
 
             std::shared_ptr<SkipRecordAttrContainer> m_skipRecordAttrContainer;
 
+            std::shared_ptr<AttributeReadCache> m_readCache;
+
             std::shared_ptr<Channel> m_communicationChannel;
 
             uint64_t m_responseTimeoutMs;
 
+            uint64_t m_busyPollUs;
+
             std::function<lai_linecard_notifications_t(std::shared_ptr<Notification>)> m_notificationCallback;
 
     };
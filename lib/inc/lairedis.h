@@ -42,6 +42,27 @@ typedef enum _lai_redis_communication_mode_t
 
 } lai_redis_communication_mode_t;
 
+typedef enum _lai_redis_recording_format_t
+{
+    /**
+     * @brief Human readable text lines.
+     */
+    LAI_REDIS_RECORDING_FORMAT_TEXT,
+
+    /**
+     * @brief Length prefixed binary records.
+     *
+     * Can be converted back to text format with lairecord tool.
+     */
+    LAI_REDIS_RECORDING_FORMAT_BINARY,
+
+    /**
+     * @brief Length prefixed binary records in zlib compressed blocks.
+     */
+    LAI_REDIS_RECORDING_FORMAT_BINARY_COMPRESSED,
+
+} lai_redis_recording_format_t;
+
 typedef enum _lai_redis_linecard_attr_t
 {
     /**
@@ -206,4 +227,87 @@ typedef enum _lai_redis_linecard_attr_t
      */
     LAI_REDIS_LINECARD_ATTR_SYNC_OPERATION_RESPONSE_TIMEOUT,
 
+    /**
+     * @brief Recording file format.
+     *
+     * Changing format when recording is enabled will close current recording
+     * file and reopen it in new format. Binary recording file should have
+     * different name than text one since formats can't be mixed in single
+     * file.
+     *
+     * @type lai_redis_recording_format_t
+     * @flags CREATE_AND_SET
+     * @default LAI_REDIS_RECORDING_FORMAT_TEXT
+     */
+    LAI_REDIS_LINECARD_ATTR_RECORDING_FORMAT,
+
+    /**
+     * @brief Enable client side attribute read cache.
+     *
+     * When enabled, GET of CREATE_ONLY and CREATE_AND_SET attributes is
+     * served from metadata database, and GET of READ_ONLY attributes is served
+     * from cache filled by previous GET responses, as long as entries are not
+     * older than LAI_REDIS_LINECARD_ATTR_READ_CACHE_TTL. GET is sent to syncd
+     * only if any of requested attributes can't be served locally.
+     *
+     * Cached entries are invalidated on SET and REMOVE of given object and
+     * on any received notification. GET served from cache is recorded same
+     * as GET served by syncd.
+     *
+     * @type bool
+     * @flags CREATE_AND_SET
+     * @default false
+     */
+    LAI_REDIS_LINECARD_ATTR_READ_CACHE,
+
+    /**
+     * @brief Read cache time to live for READ_ONLY attributes in milliseconds.
+     *
+     * Zero disables caching of READ_ONLY attributes.
+     *
+     * @type lai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 1000
+     */
+    LAI_REDIS_LINECARD_ATTR_READ_CACHE_TTL,
+
+    /**
+     * @brief Synchronous operation busy poll time in microseconds.
+     *
+     * When waiting for response from syncd, poll for response without
+     * blocking for this amount of time before falling back to blocking wait.
+     * Trades CPU for lower latency of synchronous operations. Zero disables
+     * busy poll.
+     *
+     * @type lai_uint64_t
+     * @flags CREATE_AND_SET
+     * @default 0
+     */
+    LAI_REDIS_LINECARD_ATTR_SYNC_OPERATION_BUSY_POLL,
+
 } lai_redis_linecard_attr_t;
+
+/**
+ * @brief Get attributes of multiple objects of the same type.
+ *
+ * All objects are sent to syncd in single message and are serviced in one
+ * pass, each object has its own attribute list and status. All objects must
+ * belong to the same context.
+ *
+ * @param[in] object_type Object type of all objects.
+ * @param[in] object_count Number of objects.
+ * @param[in] object_id List of object ids.
+ * @param[in] attr_count List of attribute counts for each object.
+ * @param[inout] attr_list List of attribute lists for each object.
+ * @param[out] object_statuses Status of each object.
+ *
+ * @return #LAI_STATUS_SUCCESS if all objects succeeded, #LAI_STATUS_FAILURE
+ * if any object failed, or error status code on invalid parameters.
+ */
+extern "C" lai_status_t lai_redis_bulk_get(
+        _In_ lai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses);
@@ -24,6 +24,14 @@
 #define REDIS_ASIC_STATE_COMMAND_SET    "set"
 #define REDIS_ASIC_STATE_COMMAND_GET    "get"
 
+/*
+ * Bulk get key is "OBJECT_TYPE:object_count", each object is sent as
+ * (object_id, attr_count) field followed by attr_count attribute fields.
+ * Response has the same layout with object status instead of object id.
+ */
+
+#define REDIS_ASIC_STATE_COMMAND_BULK_GET   "bulkget"
+
 #define REDIS_ASIC_STATE_COMMAND_NOTIFY      "notify"
 
 #define REDIS_ASIC_STATE_COMMAND_GET_STATS          "get_stats"
@@ -72,6 +80,14 @@
  */
 #define REDIS_TABLE_GETRESPONSE     "GETRESPONSE"
 
+/**
+ * @brief Table where lairedis publishes latency of commands sent to syncd.
+ *
+ * Key is command name, fields are count, p50, p90, p99 and max, latencies
+ * are in microseconds.
+ */
+#define REDIS_TABLE_LATENCY         "LAIREDIS_LATENCY"
+
 // REDIS default database defines
 
 #define REDIS_DEFAULT_DATABASE_ASIC         "ASIC_DB"
@@ -0,0 +1,165 @@
+#include "AttributeReadCache.h"
+
+#include "meta/lai_serialize.h"
+
+#include "swss/logger.h"
+
+using namespace lairedis;
+
+#define DEFAULT_READ_CACHE_TTL_MS (1000)
+
+AttributeReadCache::AttributeReadCache():
+    m_enabled(false),
+    m_ttl(DEFAULT_READ_CACHE_TTL_MS),
+    m_generation(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void AttributeReadCache::setEnabled(
+        _In_ bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_enabled = enabled;
+
+    m_generation++;
+
+    m_cache.clear();
+}
+
+bool AttributeReadCache::isEnabled() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_enabled;
+}
+
+void AttributeReadCache::setTtl(
+        _In_ uint64_t ttlMs)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_ttl = std::chrono::milliseconds(ttlMs);
+
+    m_generation++;
+
+    m_cache.clear();
+}
+
+bool AttributeReadCache::get(
+        _In_ lai_object_id_t objectId,
+        _In_ lai_attr_id_t attrId,
+        _Out_ std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto oit = m_cache.find(objectId);
+
+    if (oit == m_cache.end())
+    {
+        return false;
+    }
+
+    auto ait = oit->second.find(attrId);
+
+    if (ait == oit->second.end())
+    {
+        return false;
+    }
+
+    if (std::chrono::steady_clock::now() - ait->second.m_timestamp >= m_ttl)
+    {
+        oit->second.erase(ait);
+
+        return false;
+    }
+
+    value = ait->second.m_value;
+
+    return true;
+}
+
+uint64_t AttributeReadCache::getGeneration() const
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_generation;
+}
+
+void AttributeReadCache::update(
+        _In_ uint64_t generation,
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_enabled || m_ttl.count() == 0)
+    {
+        return;
+    }
+
+    if (generation != m_generation)
+    {
+        // cache was invalidated while request was in flight, response may
+        // already be stale
+
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto md = lai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+        if (md == NULL || !LAI_HAS_FLAG_READ_ONLY(md->flags))
+        {
+            continue;
+        }
+
+        auto& entry = m_cache[objectId][md->attrid];
+
+        entry.m_timestamp = now;
+        entry.m_value = lai_serialize_attr_value(*md, attr_list[idx]);
+    }
+}
+
+void AttributeReadCache::invalidate(
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation++;
+
+    m_cache.erase(objectId);
+}
+
+void AttributeReadCache::clear()
+{
+    SWSS_LOG_ENTER();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_generation++;
+
+    m_cache.clear();
+}
@@ -0,0 +1,646 @@
+#include "BinaryRecordFormat.h"
+
+#include "meta/MetadataIndex.h"
+#include "meta/lai_serialize.h"
+
+#include "swss/logger.h"
+
+#include <zlib.h>
+#include <inttypes.h>
+#include <sys/time.h>
+
+#include <cstring>
+
+using namespace lairedis;
+
+void BinaryRecordFormat::appendVarint(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    while (value >= 0x80)
+    {
+        buffer.push_back((char)((value & 0x7f) | 0x80));
+
+        value >>= 7;
+    }
+
+    buffer.push_back((char)value);
+}
+
+bool BinaryRecordFormat::readVarint(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset,
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    value = 0;
+
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (offset >= buffer.size())
+        {
+            return false;
+        }
+
+        uint8_t byte = (uint8_t)buffer[offset++];
+
+        value |= (uint64_t)(byte & 0x7f) << shift;
+
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    SWSS_LOG_THROW("varint at offset %zu is too long", offset);
+}
+
+void BinaryRecordFormat::appendString(
+        _Inout_ std::string& buffer,
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    appendVarint(buffer, size);
+
+    buffer.append(data, size);
+}
+
+void BinaryRecordFormat::appendStringToken(
+        _Inout_ std::string& tokens,
+        _In_ const char* data,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    tokens.push_back((char)TOKEN_STRING);
+
+    appendString(tokens, data, size);
+}
+
+void BinaryRecordFormat::appendToken(
+        _Inout_ std::string& buffer,
+        _In_ const char* token,
+        _In_ size_t size)
+{
+    SWSS_LOG_ENTER();
+
+    // attribute token looks like LAI_X_ATTR_Y=value, everything else is
+    // stored as plain string
+
+    const char* eq = (const char*)memchr(token, '=', size);
+
+    if (eq != NULL && size >= 4 && memcmp(token, "LAI_", 4) == 0)
+    {
+        const std::string name(token, (size_t)(eq - token));
+
+        auto meta = laimeta::MetadataIndex::getInstance().getAttrMetadata(name);
+
+        if (meta == NULL)
+        {
+            meta = lai_metadata_get_attr_metadata_by_attr_id_name(name.c_str());
+        }
+
+        if (meta != NULL)
+        {
+            buffer.push_back((char)TOKEN_ATTR);
+
+            appendVarint(buffer, meta->objecttype);
+            appendVarint(buffer, meta->attrid);
+            appendString(buffer, eq + 1, size - name.size() - 1);
+
+            return;
+        }
+    }
+
+    appendStringToken(buffer, token, size);
+}
+
+static bool hasRawValue(
+        _In_ lai_attr_value_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (type)
+    {
+        case LAI_ATTR_VALUE_TYPE_BOOL:
+        case LAI_ATTR_VALUE_TYPE_CHARDATA:
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+        case LAI_ATTR_VALUE_TYPE_INT8:
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+        case LAI_ATTR_VALUE_TYPE_INT16:
+        case LAI_ATTR_VALUE_TYPE_UINT32:
+        case LAI_ATTR_VALUE_TYPE_INT32:
+        case LAI_ATTR_VALUE_TYPE_UINT64:
+        case LAI_ATTR_VALUE_TYPE_INT64:
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:
+        case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static uint64_t zigzagEncode(
+        _In_ int64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t zigzagDecode(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    return (int64_t)((value >> 1) ^ (0 - (value & 1)));
+}
+
+void BinaryRecordFormat::appendAttrToken(
+        _Inout_ std::string& tokens,
+        _In_ const lai_attr_metadata_t& meta,
+        _In_ const lai_attribute_t& attr,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    if (!hasRawValue(meta.attrvaluetype))
+    {
+        tokens.push_back((char)TOKEN_ATTR);
+
+        appendVarint(tokens, meta.objecttype);
+        appendVarint(tokens, meta.attrid);
+
+        std::string value;
+
+        lai_serialize_attr_value_append(value, meta, attr, countOnly);
+
+        appendString(tokens, value.data(), value.size());
+
+        return;
+    }
+
+    tokens.push_back((char)TOKEN_ATTR_VALUE);
+
+    appendVarint(tokens, meta.objecttype);
+    appendVarint(tokens, meta.attrid);
+
+    switch (meta.attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_BOOL:
+            tokens.push_back((char)(attr.value.booldata ? 1 : 0));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_CHARDATA:
+            appendString(tokens, attr.value.chardata, strnlen(attr.value.chardata, sizeof(attr.value.chardata)));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+            appendVarint(tokens, attr.value.u8);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT8:
+            appendVarint(tokens, zigzagEncode(attr.value.s8));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+            appendVarint(tokens, attr.value.u16);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT16:
+            appendVarint(tokens, zigzagEncode(attr.value.s16));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT32:
+            appendVarint(tokens, attr.value.u32);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT32:
+            appendVarint(tokens, zigzagEncode(attr.value.s32));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT64:
+            appendVarint(tokens, attr.value.u64);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT64:
+            appendVarint(tokens, zigzagEncode(attr.value.s64));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:
+            {
+                uint64_t bits;
+
+                memcpy(&bits, &attr.value.d64, sizeof(bits));
+
+                for (int shift = 0; shift < 64; shift += 8)
+                {
+                    tokens.push_back((char)(bits >> shift));
+                }
+            }
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            appendVarint(tokens, attr.value.oid);
+            break;
+
+        default:
+            SWSS_LOG_THROW("attr value type %d has no raw value", meta.attrvaluetype);
+    }
+}
+
+void BinaryRecordFormat::appendRecord(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t timestampDelta,
+        _In_ uint64_t tokenCount,
+        _In_ const std::string& tokens)
+{
+    SWSS_LOG_ENTER();
+
+    std::string header;
+
+    appendVarint(header, timestampDelta);
+    appendVarint(header, tokenCount);
+
+    appendVarint(buffer, header.size() + tokens.size());
+
+    buffer += header;
+    buffer += tokens;
+}
+
+void BinaryRecordFormat::encodeRecord(
+        _Inout_ std::string& buffer,
+        _In_ uint64_t timestampDelta,
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    std::string tokens;
+
+    uint64_t tokenCount = 0;
+
+    size_t start = 0;
+
+    while (true)
+    {
+        size_t end = line.find('|', start);
+
+        if (end == std::string::npos)
+        {
+            end = line.size();
+        }
+
+        appendToken(tokens, line.data() + start, end - start);
+
+        tokenCount++;
+
+        if (end == line.size())
+        {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    appendRecord(buffer, timestampDelta, tokenCount, tokens);
+}
+
+std::string BinaryRecordFormat::readString(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t size;
+
+    if (!readVarint(buffer, offset, size) || size > buffer.size() - offset)
+    {
+        SWSS_LOG_THROW("truncated string at offset %zu", offset);
+    }
+
+    std::string str = buffer.substr(offset, size);
+
+    offset += size;
+
+    return str;
+}
+
+static uint64_t readRawVarint(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t value;
+
+    if (!BinaryRecordFormat::readVarint(buffer, offset, value))
+    {
+        SWSS_LOG_THROW("truncated attribute value at offset %zu", offset);
+    }
+
+    return value;
+}
+
+void BinaryRecordFormat::readAttrValue(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset,
+        _In_ const lai_attr_metadata_t& meta,
+        _Inout_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    // value is decoded back to attribute and serialized, so line is the
+    // same as line of text recorder
+
+    lai_attribute_t attr;
+
+    memset(&attr, 0, sizeof(attr));
+
+    attr.id = meta.attrid;
+
+    switch (meta.attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_BOOL:
+
+            if (offset >= buffer.size())
+            {
+                SWSS_LOG_THROW("truncated attribute value at offset %zu", offset);
+            }
+
+            attr.value.booldata = buffer[offset++] != 0;
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_CHARDATA:
+            {
+                auto str = readString(buffer, offset);
+
+                if (str.size() > sizeof(attr.value.chardata))
+                {
+                    SWSS_LOG_THROW("chardata value too long: %zu", str.size());
+                }
+
+                memcpy(attr.value.chardata, str.data(), str.size());
+            }
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+            attr.value.u8 = (uint8_t)readRawVarint(buffer, offset);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT8:
+            attr.value.s8 = (int8_t)zigzagDecode(readRawVarint(buffer, offset));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+            attr.value.u16 = (uint16_t)readRawVarint(buffer, offset);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT16:
+            attr.value.s16 = (int16_t)zigzagDecode(readRawVarint(buffer, offset));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT32:
+            attr.value.u32 = (uint32_t)readRawVarint(buffer, offset);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT32:
+            attr.value.s32 = (int32_t)zigzagDecode(readRawVarint(buffer, offset));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_UINT64:
+            attr.value.u64 = readRawVarint(buffer, offset);
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_INT64:
+            attr.value.s64 = zigzagDecode(readRawVarint(buffer, offset));
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:
+            {
+                if (buffer.size() - offset < sizeof(uint64_t))
+                {
+                    SWSS_LOG_THROW("truncated attribute value at offset %zu", offset);
+                }
+
+                uint64_t bits = 0;
+
+                for (int shift = 0; shift < 64; shift += 8)
+                {
+                    bits |= (uint64_t)(uint8_t)buffer[offset++] << shift;
+                }
+
+                memcpy(&attr.value.d64, &bits, sizeof(bits));
+            }
+            break;
+
+        case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+            attr.value.oid = readRawVarint(buffer, offset);
+            break;
+
+        default:
+            SWSS_LOG_THROW("attr value type %d has no raw value", meta.attrvaluetype);
+    }
+
+    lai_serialize_attr_value_append(line, meta, attr, false);
+}
+
+std::string BinaryRecordFormat::decodeRecord(
+        _In_ const std::string& buffer,
+        _Inout_ size_t& offset,
+        _Out_ uint64_t& timestampDelta)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string record = readString(buffer, offset);
+
+    size_t pos = 0;
+
+    uint64_t tokenCount;
+
+    if (!readVarint(record, pos, timestampDelta) || !readVarint(record, pos, tokenCount))
+    {
+        SWSS_LOG_THROW("truncated record header");
+    }
+
+    std::string line;
+
+    for (uint64_t idx = 0; idx < tokenCount; idx++)
+    {
+        if (idx != 0)
+        {
+            line += "|";
+        }
+
+        if (pos >= record.size())
+        {
+            SWSS_LOG_THROW("truncated record, expected %" PRIu64 " tokens", tokenCount);
+        }
+
+        uint8_t tag = (uint8_t)record[pos++];
+
+        switch (tag)
+        {
+            case TOKEN_STRING:
+
+                line += readString(record, pos);
+                break;
+
+            case TOKEN_ATTR:
+                {
+                    uint64_t objectType;
+                    uint64_t attrId;
+
+                    if (!readVarint(record, pos, objectType) || !readVarint(record, pos, attrId))
+                    {
+                        SWSS_LOG_THROW("truncated attribute token");
+                    }
+
+                    auto meta = lai_metadata_get_attr_metadata((lai_object_type_t)objectType, (lai_attr_id_t)attrId);
+
+                    if (meta == NULL)
+                    {
+                        SWSS_LOG_THROW("unknown attribute %" PRIu64 " on object type %" PRIu64, attrId, objectType);
+                    }
+
+                    line += meta->attridname;
+                    line += "=";
+                    line += readString(record, pos);
+                }
+                break;
+
+            case TOKEN_ATTR_VALUE:
+                {
+                    uint64_t objectType;
+                    uint64_t attrId;
+
+                    if (!readVarint(record, pos, objectType) || !readVarint(record, pos, attrId))
+                    {
+                        SWSS_LOG_THROW("truncated attribute token");
+                    }
+
+                    auto meta = lai_metadata_get_attr_metadata((lai_object_type_t)objectType, (lai_attr_id_t)attrId);
+
+                    if (meta == NULL || !hasRawValue(meta->attrvaluetype))
+                    {
+                        SWSS_LOG_THROW("attribute %" PRIu64 " on object type %" PRIu64 " has no raw value", attrId, objectType);
+                    }
+
+                    line += meta->attridname;
+                    line += "=";
+
+                    readAttrValue(record, pos, *meta, line);
+                }
+                break;
+
+            default:
+                SWSS_LOG_THROW("unknown token tag %u", tag);
+        }
+    }
+
+    return line;
+}
+
+std::string BinaryRecordFormat::compress(
+        _In_ const std::string& raw)
+{
+    SWSS_LOG_ENTER();
+
+    uLongf size = compressBound((uLong)raw.size());
+
+    std::string stored(size, '\0');
+
+    int ret = compress2((Bytef*)&stored[0], &size, (const Bytef*)raw.data(), (uLong)raw.size(), Z_BEST_SPEED);
+
+    if (ret != Z_OK)
+    {
+        SWSS_LOG_THROW("compress2 failed: %d", ret);
+    }
+
+    stored.resize(size);
+
+    return stored;
+}
+
+std::string BinaryRecordFormat::uncompress(
+        _In_ const std::string& stored,
+        _In_ size_t rawSize)
+{
+    SWSS_LOG_ENTER();
+
+    uLongf size = (uLongf)rawSize;
+
+    std::string raw(rawSize, '\0');
+
+    int ret = ::uncompress((Bytef*)&raw[0], &size, (const Bytef*)stored.data(), (uLong)stored.size());
+
+    if (ret != Z_OK || size != rawSize)
+    {
+        SWSS_LOG_THROW("uncompress failed: %d, size %lu, expected %zu", ret, (unsigned long)size, rawSize);
+    }
+
+    return raw;
+}
+
+std::string BinaryRecordFormat::serializeTimestamp(
+        _In_ uint64_t microseconds)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[64];
+    struct timeval tv;
+
+    tv.tv_sec = (time_t)(microseconds / 1000000);
+    tv.tv_usec = (suseconds_t)(microseconds % 1000000);
+
+    struct tm now;
+    localtime_r(&tv.tv_sec, &now);
+
+    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &now);
+
+    snprintf(&buffer[size], 32, "%06ld", tv.tv_usec);
+
+    return std::string(buffer);
+}
+
+bool BinaryRecordFormat::deserializeTimestamp(
+        _In_ const std::string& timestamp,
+        _Out_ uint64_t& microseconds)
+{
+    SWSS_LOG_ENTER();
+
+    // 2020-01-01.12:34:56.123456
+
+    struct tm tm;
+
+    memset(&tm, 0, sizeof(tm));
+
+    unsigned int usec;
+
+    if (sscanf(timestamp.c_str(), "%d-%d-%d.%d:%d:%d.%u",
+                &tm.tm_year, &tm.tm_mon, &tm.tm_mday,
+                &tm.tm_hour, &tm.tm_min, &tm.tm_sec, &usec) != 7 || usec >= 1000000)
+    {
+        return false;
+    }
+
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    tm.tm_isdst = -1; // timestamps are local time, same as in serializeTimestamp
+
+    time_t sec = mktime(&tm);
+
+    if (sec == (time_t)-1)
+    {
+        return false;
+    }
+
+    microseconds = (uint64_t)sec * 1000000 + usec;
+
+    return true;
+}
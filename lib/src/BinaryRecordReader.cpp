@@ -0,0 +1,163 @@
+#include "BinaryRecordReader.h"
+#include "BinaryRecordFormat.h"
+
+#include "swss/logger.h"
+
+#include <fstream>
+#include <cstring>
+
+using namespace lairedis;
+
+BinaryRecordReader::BinaryRecordReader(
+        _Inout_ std::istream& stream):
+    m_stream(stream),
+    m_offset(0),
+    m_timestamp(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+bool BinaryRecordReader::isBinaryRecording(
+        _In_ const std::string& fileName)
+{
+    SWSS_LOG_ENTER();
+
+    std::ifstream file(fileName, std::ifstream::in | std::ifstream::binary);
+
+    char magic[LAI_REDIS_BINARY_RECORD_MAGIC_SIZE];
+
+    if (!file.read(magic, sizeof(magic)))
+    {
+        return false;
+    }
+
+    return memcmp(magic, LAI_REDIS_BINARY_RECORD_MAGIC, sizeof(magic)) == 0;
+}
+
+bool BinaryRecordReader::readBlock()
+{
+    SWSS_LOG_ENTER();
+
+    char magic[LAI_REDIS_BINARY_RECORD_MAGIC_SIZE];
+
+    if (!m_stream.read(magic, sizeof(magic)))
+    {
+        return false;
+    }
+
+    if (memcmp(magic, LAI_REDIS_BINARY_RECORD_MAGIC, sizeof(magic)) != 0)
+    {
+        SWSS_LOG_THROW("invalid block magic at offset %lld", (long long)m_stream.tellg() - (long long)sizeof(magic));
+    }
+
+    // header varints are at most 10 bytes each, read them byte by byte
+
+    std::string header;
+
+    int flags = m_stream.get();
+
+    if (flags == EOF)
+    {
+        SWSS_LOG_THROW("truncated block header");
+    }
+
+    uint64_t sizes[2];
+
+    for (int idx = 0; idx < 2; idx++)
+    {
+        header.clear();
+
+        while (true)
+        {
+            int c = m_stream.get();
+
+            if (c == EOF)
+            {
+                SWSS_LOG_THROW("truncated block header");
+            }
+
+            header.push_back((char)c);
+
+            if ((c & 0x80) == 0)
+            {
+                break;
+            }
+
+            if (header.size() >= LAI_REDIS_BINARY_RECORD_VARINT_MAX_SIZE)
+            {
+                SWSS_LOG_THROW("block header varint is longer than %d bytes", LAI_REDIS_BINARY_RECORD_VARINT_MAX_SIZE);
+            }
+        }
+
+        size_t offset = 0;
+
+        BinaryRecordFormat::readVarint(header, offset, sizes[idx]);
+    }
+
+    std::string data(sizes[1], '\0');
+
+    if (!m_stream.read(&data[0], sizes[1]))
+    {
+        SWSS_LOG_THROW("truncated block, expected %zu bytes", (size_t)sizes[1]);
+    }
+
+    if (flags & LAI_REDIS_BINARY_RECORD_FLAG_COMPRESSED)
+    {
+        m_block = BinaryRecordFormat::uncompress(data, sizes[0]);
+    }
+    else
+    {
+        m_block = std::move(data);
+    }
+
+    m_offset = 0;
+    m_timestamp = 0;
+
+    return true;
+}
+
+bool BinaryRecordReader::getline(
+        _Out_ std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t timestamp;
+
+    std::string record;
+
+    if (!getRecord(timestamp, record))
+    {
+        return false;
+    }
+
+    line = BinaryRecordFormat::serializeTimestamp(timestamp) + "|" + record;
+
+    return true;
+}
+
+bool BinaryRecordReader::getRecord(
+        _Out_ uint64_t& timestamp,
+        _Out_ std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    while (m_offset >= m_block.size())
+    {
+        if (!readBlock())
+        {
+            return false;
+        }
+    }
+
+    uint64_t delta;
+
+    record = BinaryRecordFormat::decodeRecord(m_block, m_offset, delta);
+
+    m_timestamp += delta;
+
+    timestamp = m_timestamp;
+
+    return true;
+}
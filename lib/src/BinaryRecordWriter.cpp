@@ -0,0 +1,124 @@
+#include "BinaryRecordWriter.h"
+#include "BinaryRecordFormat.h"
+
+#include "swss/logger.h"
+
+using namespace lairedis;
+
+#define BINARY_RECORD_BLOCK_SIZE (64 * 1024)
+
+#define BINARY_RECORD_FLUSH_INTERVAL_US (1000 * 1000)
+
+BinaryRecordWriter::BinaryRecordWriter(
+        _In_ bool compress):
+    m_compress(compress),
+    m_blockTimestamp(0),
+    m_lastTimestamp(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_block.reserve(BINARY_RECORD_BLOCK_SIZE * 2);
+}
+
+uint64_t BinaryRecordWriter::beginRecord(
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_block.empty())
+    {
+        // first record in block carries absolute timestamp
+
+        m_blockTimestamp = timestamp;
+        m_lastTimestamp = 0;
+    }
+
+    uint64_t delta = (timestamp > m_lastTimestamp) ? (timestamp - m_lastTimestamp) : 0;
+
+    m_lastTimestamp = (timestamp > m_lastTimestamp) ? timestamp : m_lastTimestamp;
+
+    return delta;
+}
+
+void BinaryRecordWriter::endRecord(
+        _Inout_ std::ostream& stream,
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_block.size() >= BINARY_RECORD_BLOCK_SIZE ||
+            timestamp - m_blockTimestamp >= BINARY_RECORD_FLUSH_INTERVAL_US)
+    {
+        flush(stream);
+    }
+}
+
+void BinaryRecordWriter::write(
+        _Inout_ std::ostream& stream,
+        _In_ uint64_t timestamp,
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    BinaryRecordFormat::encodeRecord(m_block, beginRecord(timestamp), line);
+
+    endRecord(stream, timestamp);
+}
+
+void BinaryRecordWriter::writeRecord(
+        _Inout_ std::ostream& stream,
+        _In_ uint64_t timestamp,
+        _In_ uint64_t tokenCount,
+        _In_ const std::string& tokens)
+{
+    SWSS_LOG_ENTER();
+
+    BinaryRecordFormat::appendRecord(m_block, beginRecord(timestamp), tokenCount, tokens);
+
+    endRecord(stream, timestamp);
+}
+
+void BinaryRecordWriter::flushExpired(
+        _Inout_ std::ostream& stream,
+        _In_ uint64_t timestamp)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_block.size() && timestamp - m_blockTimestamp >= BINARY_RECORD_FLUSH_INTERVAL_US)
+    {
+        flush(stream);
+    }
+}
+
+void BinaryRecordWriter::flush(
+        _Inout_ std::ostream& stream)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_block.empty())
+    {
+        return;
+    }
+
+    std::string header(LAI_REDIS_BINARY_RECORD_MAGIC, LAI_REDIS_BINARY_RECORD_MAGIC_SIZE);
+
+    std::string stored = m_compress ? BinaryRecordFormat::compress(m_block) : std::string();
+
+    // don't keep compressed block if it's not smaller than raw one
+
+    bool compressed = m_compress && stored.size() < m_block.size();
+
+    header.push_back((char)(compressed ? LAI_REDIS_BINARY_RECORD_FLAG_COMPRESSED : 0));
+
+    BinaryRecordFormat::appendVarint(header, m_block.size());
+
+    const std::string& data = compressed ? stored : m_block;
+
+    BinaryRecordFormat::appendVarint(header, data.size());
+
+    stream.write(header.data(), header.size());
+    stream.write(data.data(), data.size());
+    stream.flush();
+
+    m_block.clear();
+}
@@ -9,7 +9,8 @@ using namespace lairedis;
 Channel::Channel(
         _In_ Callback callback):
     m_callback(callback),
-    m_responseTimeoutMs(LAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT)
+    m_responseTimeoutMs(LAI_REDIS_DEFAULT_SYNC_OPERATION_RESPONSE_TIMEOUT),
+    m_busyPollUs(0)
 {
     SWSS_LOG_ENTER();
 
@@ -37,3 +38,18 @@ uint64_t Channel::getResponseTimeout() const
 
     return m_responseTimeoutMs;
 }
+
+void Channel::setBusyPoll(
+        _In_ uint64_t busyPollUs)
+{
+    SWSS_LOG_ENTER();
+
+    m_busyPollUs = busyPollUs;
+}
+
+uint64_t Channel::getBusyPoll() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_busyPollUs;
+}
@@ -6,6 +6,8 @@
 #include "meta/Meta.h"
 #include "meta/lai_serialize.h"
 
+#include <fstream>
+
 // TODO - simplify recorder
 
 using namespace lairedis;
@@ -16,7 +18,7 @@ using namespace std::placeholders;
         SWSS_LOG_ERROR("%s: api not initialized", __PRETTY_FUNCTION__);     \
         return LAI_STATUS_FAILURE; }
 
-#define REDIS_CHECK_CONTEXT(oid)                                            \
+#define REDIS_GET_CONTEXT(oid)                                              \
     auto _globalContext = VirtualObjectIdManager::getGlobalContext(oid);    \
     auto context = getContext(_globalContext);                              \
     if (context == nullptr) {                                               \
@@ -25,6 +27,10 @@ using namespace std::placeholders;
                 lai_serialize_object_id(oid).c_str());                      \
         return LAI_STATUS_FAILURE; }
 
+#define REDIS_CHECK_CONTEXT(oid)                                            \
+    REDIS_GET_CONTEXT(oid)                                                  \
+    CONTEXT_MUTEX(context);
+
 Lai::Lai()
 {
     SWSS_LOG_ENTER();
@@ -101,11 +107,25 @@ lai_status_t Lai::uninitialize(void)
 
     SWSS_LOG_NOTICE("begin");
 
-    m_contextMap.clear();
+    // contexts are destroyed outside api mutex, since context destructor
+    // joins notification thread which may be waiting for context mutex
 
-    m_recorder = nullptr;
+    std::map<uint32_t, std::shared_ptr<Context>> contextMap;
 
-    m_apiInitialized = false;
+    {
+        MUTEX();
+
+        m_apiInitialized = false;
+
+        contextMap.swap(m_contextMap);
+
+        // contexts keep their own reference, so recorder is destroyed
+        // together with last context
+
+        m_recorder = nullptr;
+    }
+
+    contextMap.clear();
 
     SWSS_LOG_NOTICE("end");
 
@@ -126,11 +146,10 @@ lai_status_t Lai::create(
         _In_ uint32_t attr_count,
         _In_ const lai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    REDIS_CHECK_CONTEXT(linecardId);
+    REDIS_GET_CONTEXT(linecardId);
 
     if (objectType == LAI_OBJECT_TYPE_LINECARD && attr_count > 0 && attr_list)
     {
@@ -153,6 +172,8 @@ lai_status_t Lai::create(
         }
     }
 
+    CONTEXT_MUTEX(context);
+
     auto status = context->m_meta->create(
             objectType,
             objectId,
@@ -167,7 +188,6 @@ lai_status_t Lai::remove(
         _In_ lai_object_type_t objectType,
         _In_ lai_object_id_t objectId)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -180,29 +200,42 @@ lai_status_t Lai::set(
         _In_ lai_object_id_t objectId,
         _In_ const lai_attribute_t *attr)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
     if (RedisRemoteLaiInterface::isRedisAttribute(objectType, attr))
     {
+        // Redis extension attributes are applied on all contexts and some of
+        // them reconfigure shared recorder, so all context mutexes are taken
+        // (always in context map order) to make this exclusive with any other
+        // API call or notification.
+
+        std::vector<std::unique_lock<std::recursive_mutex>> locks;
+
+        auto contexts = getAllContexts();
+
         if (attr->id == LAI_REDIS_LINECARD_ATTR_REDIS_COMMUNICATION_MODE)
         {
             // Since communication mode destroys current channel and creates
             // new one, it may happen, that during this SET api execution when
-            // api mutex is acquired, channel destructor will be blocking on
+            // context mutex is acquired, channel destructor will be blocking on
             // thread->join() and channel thread will start processing
             // incoming notification. That notification will be synchronized
-            // with api mutex and will cause deadlock, so to mitigate this
-            // scenario we will unlock api mutex here.
+            // with context mutex and will cause deadlock, so to mitigate this
+            // scenario we will not lock context mutexes here.
             //
             // This is not the perfect, but assuming that communication mode is
             // changed in single thread and before linecard create then we should
             // not hit race condition.
 
-            SWSS_LOG_NOTICE("unlocking api mutex for communication mode");
-
-            MUTEX_UNLOCK();
+            SWSS_LOG_NOTICE("not locking context mutexes for communication mode");
+        }
+        else
+        {
+            for (auto& context: contexts)
+            {
+                locks.emplace_back(context->m_mutex);
+            }
         }
 
         // skip metadata if attribute is redis extension attribute
@@ -212,9 +245,9 @@ lai_status_t Lai::set(
 
         bool success = true;
 
-        for (auto& kvp: m_contextMap)
+        for (auto& context: contexts)
         {
-            lai_status_t status = kvp.second->m_redisLai->set(objectType, objectId, attr);
+            lai_status_t status = context->m_redisLai->set(objectType, objectId, attr);
 
             success &= (status == LAI_STATUS_SUCCESS);
 
@@ -237,7 +270,6 @@ lai_status_t Lai::get(
         _In_ uint32_t attr_count,
         _Inout_ lai_attribute_t *attr_list)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(objectId);
@@ -249,6 +281,53 @@ lai_status_t Lai::get(
             attr_list);
 }
 
+// BULK QUAD OID
+
+lai_status_t Lai::bulkGet(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+
+    if (object_count < 1 || object_id == nullptr)
+    {
+        SWSS_LOG_ERROR("expected at least 1 object to get");
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    // all objects must belong to the same context, since they will be sent
+    // in single message
+
+    for (uint32_t idx = 1; idx < object_count; idx++)
+    {
+        if (VirtualObjectIdManager::getGlobalContext(object_id[idx]) !=
+                VirtualObjectIdManager::getGlobalContext(object_id[0]))
+        {
+            SWSS_LOG_ERROR("object %s is in different context than %s",
+                    lai_serialize_object_id(object_id[idx]).c_str(),
+                    lai_serialize_object_id(object_id[0]).c_str());
+
+            return LAI_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    REDIS_CHECK_CONTEXT(object_id[0]);
+
+    return context->m_meta->bulkGet(
+            objectType,
+            object_count,
+            object_id,
+            attr_count,
+            attr_list,
+            object_statuses);
+}
+
 // LAI API
 
 lai_status_t Lai::objectTypeGetAvailability(
@@ -258,7 +337,6 @@ lai_status_t Lai::objectTypeGetAvailability(
         _In_ const lai_attribute_t *attrList,
         _Out_ uint64_t *count)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(linecardId);
@@ -280,7 +358,6 @@ lai_status_t Lai::getStats(
         _In_ const lai_stat_id_t *counter_ids,
         _Out_ lai_stat_value_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -301,7 +378,6 @@ lai_status_t Lai::getStatsExt(
         _In_ lai_stats_mode_t mode,
         _Out_ lai_stat_value_t *counters)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -321,7 +397,6 @@ lai_status_t Lai::clearStats(
         _In_ uint32_t number_of_counters,
         _In_ const lai_stat_id_t *counter_ids)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -342,7 +417,6 @@ lai_status_t Lai::getAlarms(
         _In_ const lai_alarm_type_t *alarm_ids,
         _Out_ lai_alarm_info_t *alarm_info)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -361,7 +435,6 @@ lai_status_t Lai::clearAlarms(
         _In_ uint32_t number_of_alarms,
         _In_ const lai_alarm_type_t *alarm_ids)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(object_id);
@@ -379,7 +452,6 @@ lai_status_t Lai::queryAttributeCapability(
         _In_ lai_attr_id_t attr_id,
         _Out_ lai_attr_capability_t *capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(linecard_id);
@@ -397,7 +469,6 @@ lai_status_t Lai::queryAattributeEnumValuesCapability(
         _In_ lai_attr_id_t attr_id,
         _Inout_ lai_s32_list_t *enum_values_capability)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
     REDIS_CHECK_CONTEXT(linecard_id);
@@ -443,18 +514,76 @@ lai_status_t Lai::logSet(
         _In_ lai_api_t api,
         _In_ lai_log_level_t log_level)
 {
-    MUTEX();
     SWSS_LOG_ENTER();
     REDIS_CHECK_API_INITIALIZED();
 
-    for (auto&kvp: m_contextMap)
+    for (auto& context: getAllContexts())
     {
-        kvp.second->m_meta->logSet(api, log_level);
+        CONTEXT_MUTEX(context);
+
+        context->m_meta->logSet(api, log_level);
     }
 
     return LAI_STATUS_SUCCESS;
 }
 
+lai_status_t Lai::dbgGenerateDump(
+        _In_ const char *dumpFileName)
+{
+    SWSS_LOG_ENTER();
+    REDIS_CHECK_API_INITIALIZED();
+
+    if (dumpFileName == nullptr)
+    {
+        SWSS_LOG_ERROR("dump file name is NULL");
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::ofstream ofs(dumpFileName);
+
+    if (!ofs.is_open())
+    {
+        SWSS_LOG_ERROR("failed to open dump file: %s", dumpFileName);
+
+        return LAI_STATUS_FAILURE;
+    }
+
+    for (auto& context: getAllContexts())
+    {
+        // no context mutex, snapshot is immutable
+
+        auto snapshot = context->m_meta->getSnapshot();
+
+        ofs << "snapshot version " << snapshot->getVersion() << " oids " << snapshot->size() << std::endl;
+
+        for (auto& mk: snapshot->getAllKeys())
+        {
+            auto oid = mk.objectkey.key.object_id;
+
+            ofs << lai_serialize_object_meta_key(mk);
+
+            if (snapshot->objectReferenceExists(oid))
+            {
+                ofs << " refcount " << snapshot->getObjectReferenceCount(oid);
+            }
+
+            ofs << std::endl;
+
+            for (auto& attr: snapshot->getObject(oid)->m_attrs)
+            {
+                auto md = attr->getLaiAttrMetadata();
+
+                ofs << "    " << md->attridname << "=" << lai_serialize_attr_value(*md, *attr->getLaiAttr()) << std::endl;
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("generated dump: %s", dumpFileName);
+
+    return LAI_STATUS_SUCCESS;
+}
+
 /*
  * NOTE: Notifications during linecard create and linecard remove.
  *
@@ -474,7 +603,7 @@ lai_linecard_notifications_t Lai::handle_notification(
         _In_ std::shared_ptr<Notification> notification,
         _In_ Context* context)
 {
-    MUTEX();
+    CONTEXT_MUTEX(context);
     SWSS_LOG_ENTER();
 
     if (!m_apiInitialized)
@@ -490,6 +619,7 @@ lai_linecard_notifications_t Lai::handle_notification(
 std::shared_ptr<Context> Lai::getContext(
         _In_ uint32_t globalContext)
 {
+    MUTEX();
     SWSS_LOG_ENTER();
 
     auto it = m_contextMap.find(globalContext);
@@ -500,6 +630,21 @@ std::shared_ptr<Context> Lai::getContext(
     return it->second;
 }
 
+std::vector<std::shared_ptr<Context>> Lai::getAllContexts()
+{
+    MUTEX();
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<Context>> contexts;
+
+    for (auto& kvp: m_contextMap)
+    {
+        contexts.push_back(kvp.second);
+    }
+
+    return contexts;
+}
+
 std::string joinFieldValues(
         _In_ const std::vector<swss::FieldValueTuple> &values)
 {
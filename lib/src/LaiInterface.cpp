@@ -105,3 +105,28 @@ lai_status_t LaiInterface::get(
 
     return LAI_STATUS_FAILURE;
 }
+
+lai_status_t LaiInterface::bulkGet(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    lai_status_t status = LAI_STATUS_SUCCESS;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        object_statuses[idx] = get(objectType, object_id[idx], attr_count[idx], attr_list[idx]);
+
+        if (object_statuses[idx] != LAI_STATUS_SUCCESS)
+        {
+            status = LAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
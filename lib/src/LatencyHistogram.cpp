@@ -0,0 +1,161 @@
+#include "LatencyHistogram.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+
+using namespace lairediscommon;
+
+#define SUB_BUCKET_BITS (4)
+#define SUB_BUCKET_COUNT (1 << SUB_BUCKET_BITS)
+#define BUCKET_COUNT ((64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT)
+
+bool LatencyHistogram::m_enable = true;
+
+LatencyHistogram::LatencyHistogram(
+        _In_ const std::string& msg,
+        _In_ uint64_t limit):
+    m_msg(msg),
+    m_limit(limit),
+    m_buckets(BUCKET_COUNT)
+{
+    SWSS_LOG_ENTER();
+
+    reset();
+}
+
+size_t LatencyHistogram::bucketIndex(
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return (size_t)value;
+    }
+
+    int exp = 63 - __builtin_clzll(value);
+
+    uint64_t sub = (value >> (exp - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+
+    return (size_t)((exp - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub);
+}
+
+uint64_t LatencyHistogram::bucketValue(
+        _In_ size_t index)
+{
+    SWSS_LOG_ENTER();
+
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    int exp = (int)(index / SUB_BUCKET_COUNT) + SUB_BUCKET_BITS - 1;
+
+    uint64_t sub = index % SUB_BUCKET_COUNT;
+
+    return (SUB_BUCKET_COUNT + sub) << (exp - SUB_BUCKET_BITS);
+}
+
+void LatencyHistogram::record(
+        _In_ uint64_t latencyUs)
+{
+    SWSS_LOG_ENTER();
+
+    m_buckets[bucketIndex(latencyUs)]++;
+
+    m_count++;
+
+    if (latencyUs > m_max)
+    {
+        m_max = latencyUs;
+    }
+
+    if (m_count >= m_limit)
+    {
+        if (m_enable)
+        {
+            SWSS_LOG_NOTICE("%s latency of %" PRIu64 " calls: p50 %" PRIu64 " us, p90 %" PRIu64 " us, p99 %" PRIu64 " us, max %" PRIu64 " us",
+                    m_msg.c_str(),
+                    m_count,
+                    getPercentile(50),
+                    getPercentile(90),
+                    getPercentile(99),
+                    m_max);
+        }
+
+        if (m_callback)
+        {
+            m_callback(*this);
+        }
+
+        reset();
+    }
+}
+
+uint64_t LatencyHistogram::getPercentile(
+        _In_ double percentile) const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)((double)m_count * percentile / 100.0);
+
+    if (rank >= m_count)
+    {
+        rank = m_count - 1;
+    }
+
+    uint64_t seen = 0;
+
+    for (size_t idx = 0; idx < m_buckets.size(); idx++)
+    {
+        seen += m_buckets[idx];
+
+        if (seen > rank)
+        {
+            return bucketValue(idx);
+        }
+    }
+
+    return m_max;
+}
+
+uint64_t LatencyHistogram::getCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_count;
+}
+
+uint64_t LatencyHistogram::getMax() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_max;
+}
+
+void LatencyHistogram::setCallback(
+        _In_ Callback callback)
+{
+    SWSS_LOG_ENTER();
+
+    m_callback = callback;
+}
+
+void LatencyHistogram::reset()
+{
+    SWSS_LOG_ENTER();
+
+    m_count = 0;
+    m_max = 0;
+
+    std::fill(m_buckets.begin(), m_buckets.end(), 0);
+}
@@ -1,4 +1,5 @@
 #include "Recorder.h"
+#include "BinaryRecordFormat.h"
 
 #include "meta/lai_serialize.h"
 #include "meta/LaiAttributeList.h"
@@ -9,6 +10,7 @@
 #include <cstring>
 #include <vector>
 #include <fstream>
+#include <chrono>
 
 using namespace lairedis;
 using namespace laimeta;
@@ -28,6 +30,7 @@ std::vector<swss::FieldValueTuple> serialize_alarm_id_list(
 
 #define MUTEX() std::lock_guard<std::mutex> _lock(m_mutex)
 #define DEFAULT_RECORDING_FILE_NAME "lairedis.rec"
+#define RECORDER_FLUSH_INTERVAL_MS (1000)
 Recorder::Recorder()
 {
     SWSS_LOG_ENTER();
@@ -43,6 +46,10 @@ Recorder::Recorder()
     m_recordStats = true;
 
     m_recordAlarms = true;
+
+    m_recordingFormat = LAI_REDIS_RECORDING_FORMAT_TEXT;
+
+    m_flushThreadRun = false;
 }
 
 Recorder::~Recorder()
@@ -156,6 +163,46 @@ bool Recorder::setRecordingFilename(
     return true;
 }
 
+bool Recorder::setRecordingFormat(
+        _In_ const lai_attribute_t &attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto format = (lai_redis_recording_format_t)attr.value.s32;
+
+    switch (format)
+    {
+        case LAI_REDIS_RECORDING_FORMAT_TEXT:
+        case LAI_REDIS_RECORDING_FORMAT_BINARY:
+        case LAI_REDIS_RECORDING_FORMAT_BINARY_COMPRESSED:
+            break;
+
+        default:
+
+            SWSS_LOG_ERROR("invalid recording format value: %d", attr.value.s32);
+
+            return false;
+    }
+
+    /// Stop the recording with old format before switching
+    if (m_enabled)
+    {
+        stopRecording();
+    }
+
+    m_recordingFormat = format;
+
+    SWSS_LOG_NOTICE("setting recording format: %d", m_recordingFormat);
+
+    /// Start recording with new format
+    if (m_enabled)
+    {
+        startRecording();
+    }
+
+    return true;
+}
+
 void Recorder::enableRecording(
         _In_ bool enabled)
 {
@@ -185,9 +232,78 @@ void Recorder::recordLine(
 
     if (m_ofstream.is_open())
     {
-        m_ofstream << getTimestamp() << "|" << line << std::endl;
+        writeLine(line);
     }
 
+    checkLogRotate();
+}
+
+void Recorder::recordAttrLine(
+        _In_ const std::string& op,
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list,
+        _In_ bool countOnly)
+{
+    MUTEX();
+
+    SWSS_LOG_ENTER();
+
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    if (m_ofstream.is_open())
+    {
+        if (m_binaryWriter && attr_count)
+        {
+            m_binaryTokens.clear();
+
+            BinaryRecordFormat::appendStringToken(m_binaryTokens, op.data(), op.size());
+            BinaryRecordFormat::appendStringToken(m_binaryTokens, key.data(), key.size());
+
+            for (uint32_t idx = 0; idx < attr_count; idx++)
+            {
+                auto meta = lai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+                if (meta == NULL)
+                {
+                    SWSS_LOG_THROW("unable to get metadata for object type %s, attribute %d",
+                            lai_serialize_object_type(objectType).c_str(),
+                            attr_list[idx].id);
+                }
+
+                BinaryRecordFormat::appendAttrToken(m_binaryTokens, *meta, attr_list[idx], countOnly);
+            }
+
+            struct timeval tv;
+
+            gettimeofday(&tv, NULL);
+
+            m_binaryWriter->writeRecord(m_ofstream, (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec, 2 + attr_count, m_binaryTokens);
+        }
+        else if (arguments.empty() && attr_count)
+        {
+            auto entry = LaiAttributeList::serialize_attr_list(objectType, attr_count, attr_list, countOnly);
+
+            writeLine(op + "|" + key + "|" + joinFieldValues(entry));
+        }
+        else
+        {
+            writeLine(op + "|" + key + "|" + joinFieldValues(arguments));
+        }
+    }
+
+    checkLogRotate();
+}
+
+void Recorder::checkLogRotate()
+{
+    SWSS_LOG_ENTER();
+
     if (m_performLogRotate)
     {
         m_performLogRotate = false;
@@ -198,8 +314,83 @@ void Recorder::recordLine(
 
         if (m_ofstream.is_open())
         {
-            m_ofstream << getTimestamp() << "|" << "#|logrotate on: " << m_recordingFile << std::endl;
+            writeLine("#|logrotate on: " + m_recordingFile);
+        }
+    }
+}
+
+void Recorder::startFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    m_flushThreadRun = true;
+
+    m_flushThread = std::make_shared<std::thread>(&Recorder::flushThreadProc, this);
+}
+
+void Recorder::stopFlushThread()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_flushThread == nullptr)
+    {
+        return;
+    }
+
+    {
+        MUTEX();
+
+        m_flushThreadRun = false;
+    }
+
+    m_flushCv.notify_all();
+
+    m_flushThread->join();
+
+    m_flushThread = nullptr;
+}
+
+void Recorder::flushThreadProc()
+{
+    SWSS_LOG_ENTER();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (m_flushThreadRun)
+    {
+        m_flushCv.wait_for(lock, std::chrono::milliseconds(RECORDER_FLUSH_INTERVAL_MS));
+
+        if (!m_flushThreadRun || !m_enabled || !m_ofstream.is_open())
+        {
+            continue;
         }
+
+        struct timeval tv;
+
+        gettimeofday(&tv, NULL);
+
+        m_binaryWriter->flushExpired(m_ofstream, (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+
+        checkLogRotate();
+    }
+}
+
+void Recorder::writeLine(
+        _In_ const std::string& line)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_binaryWriter)
+    {
+        struct timeval tv;
+
+        gettimeofday(&tv, NULL);
+
+        m_binaryWriter->write(m_ofstream, (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec, line);
+    }
+    else
+    {
+        m_ofstream << getTimestamp() << "|" << line << std::endl;
     }
 }
 
@@ -214,6 +405,11 @@ void Recorder::recordingFileReopen()
 {
     SWSS_LOG_ENTER();
 
+    if (m_binaryWriter && m_ofstream.is_open())
+    {
+        m_binaryWriter->flush(m_ofstream);
+    }
+
     m_ofstream.close();
 
     /*
@@ -222,7 +418,7 @@ void Recorder::recordingFileReopen()
      * empty file here.
      */
 
-    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+    m_ofstream.open(m_recordingFile, getOpenMode());
 
     if (!m_ofstream.is_open())
     {
@@ -237,7 +433,15 @@ void Recorder::startRecording()
 
     m_recordingFile = m_recordingOutputDirectory + "/" + m_recordingFileName;
 
-    m_ofstream.open(m_recordingFile, std::ofstream::out | std::ofstream::app);
+    m_binaryWriter = nullptr;
+
+    if (m_recordingFormat != LAI_REDIS_RECORDING_FORMAT_TEXT)
+    {
+        m_binaryWriter = std::make_shared<BinaryRecordWriter>(
+                m_recordingFormat == LAI_REDIS_RECORDING_FORMAT_BINARY_COMPRESSED);
+    }
+
+    m_ofstream.open(m_recordingFile, getOpenMode());
 
     if (!m_ofstream.is_open())
     {
@@ -247,6 +451,13 @@ void Recorder::startRecording()
 
     recordLine("#|recording on: " + m_recordingFile);
 
+    if (m_binaryWriter)
+    {
+        // binary records are buffered, text records are flushed by each line
+
+        startFlushThread();
+    }
+
     SWSS_LOG_NOTICE("started recording: %s", m_recordingFileName.c_str());
 }
 
@@ -256,31 +467,50 @@ void Recorder::stopRecording()
 
     SWSS_LOG_NOTICE("stopped recording");
 
+    stopFlushThread();
+
     if (m_ofstream.is_open())
     {
+        if (m_binaryWriter)
+        {
+            m_binaryWriter->flush(m_ofstream);
+        }
+
         m_ofstream.close();
 
         SWSS_LOG_NOTICE("closed recording file: %s", m_recordingFileName.c_str());
     }
 }
 
+std::ios_base::openmode Recorder::getOpenMode() const
+{
+    SWSS_LOG_ENTER();
+
+    if (m_recordingFormat == LAI_REDIS_RECORDING_FORMAT_TEXT)
+    {
+        return std::ofstream::out | std::ofstream::app;
+    }
+
+    return std::ofstream::out | std::ofstream::app | std::ofstream::binary;
+}
+
 std::string Recorder::getTimestamp()
 {
     SWSS_LOG_ENTER();
 
-    char buffer[64];
     struct timeval tv;
 
     gettimeofday(&tv, NULL);
 
-    struct tm now;
-    localtime_r(&tv.tv_sec, &now);
-
-    size_t size = strftime(buffer, 32, "%Y-%m-%d.%T.", &now);
+    return getTimestamp((uint64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+}
 
-    snprintf(&buffer[size], 32, "%06ld", tv.tv_usec);
+std::string Recorder::getTimestamp(
+        _In_ uint64_t microseconds)
+{
+    SWSS_LOG_ENTER();
 
-    return std::string(buffer);
+    return BinaryRecordFormat::serializeTimestamp(microseconds);
 }
 
 void Recorder::recordQueryAttributeCapability(
@@ -368,6 +598,18 @@ void Recorder::recordGenericCreate(
     recordLine("c|" + key + "|" + joinFieldValues(arguments));
 }
 
+void Recorder::recordGenericCreate(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    recordAttrLine("c", key, arguments, objectType, attr_count, attr_list, false);
+}
+
 void Recorder::recordGenericCreateResponse(
         _In_ lai_status_t status)
 {
@@ -502,6 +744,17 @@ void Recorder::recordGenericSet(
     recordLine("s|" + key + "|" + joinFieldValues(arguments));
 }
 
+void Recorder::recordGenericSet(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ lai_object_type_t objectType,
+        _In_ const lai_attribute_t *attr)
+{
+    SWSS_LOG_ENTER();
+
+    recordAttrLine("s", key, arguments, objectType, 1, attr, false);
+}
+
 void Recorder::recordGenericSetResponse(
         _In_ lai_status_t status)
 {
@@ -542,6 +795,75 @@ void Recorder::recordBulkGenericSetResponse(
     // synchronous mode, and we could use "G" from GET api as response
 }
 
+void Recorder::recordBulkGenericGet(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments)
+{
+    SWSS_LOG_ENTER();
+
+    std::string joined;
+
+    // ||obj_id|attr=val|attr=val||obj_id|attr=val|attr=val
+
+    for (size_t idx = 0; idx < arguments.size(); )
+    {
+        size_t count = std::stoul(fvValue(arguments[idx]));
+
+        joined += "||" + fvField(arguments[idx++]);
+
+        for (size_t end = idx + count; idx < end && idx < arguments.size(); idx++)
+        {
+            joined += "|" + fvField(arguments[idx]) + "=" + fvValue(arguments[idx]);
+        }
+    }
+
+    // capital 'B' stands for bulk GET operation.
+
+    recordLine("B|" + key + joined);
+}
+
+void Recorder::recordBulkGenericGetResponse(
+        _In_ lai_status_t status,
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t objectCount,
+        _In_ const uint32_t *attr_count,
+        _In_ lai_attribute_t **attr_list,
+        _In_ const lai_status_t *objectStatuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::string joined;
+
+    // ||status|attr=val|attr=val||status
+
+    for (uint32_t idx = 0; idx < objectCount; idx++)
+    {
+        joined += "||" + lai_serialize_status(objectStatuses[idx]);
+
+        if (objectStatuses[idx] != LAI_STATUS_SUCCESS && objectStatuses[idx] != LAI_STATUS_BUFFER_OVERFLOW)
+        {
+            continue;
+        }
+
+        // on buffer overflow only list counts are recorded, same as in GET
+
+        auto entry = LaiAttributeList::serialize_attr_list(
+                objectType,
+                attr_count[idx],
+                attr_list[idx],
+                objectStatuses[idx] == LAI_STATUS_BUFFER_OVERFLOW);
+
+        if (entry.size())
+        {
+            joined += "|" + joinFieldValues(entry);
+        }
+    }
+
+    // capital 'G' stands for GET api response
+
+    recordLine("G|" + lai_serialize_status(status) + joined);
+}
+
 void Recorder::recordGenericGet(
         _In_ lai_object_type_t objectType,
         _In_ lai_object_id_t objectId,
@@ -568,6 +890,18 @@ void Recorder::recordGenericGet(
     recordLine("g|" + key + "|" + joinFieldValues(arguments));
 }
 
+void Recorder::recordGenericGet(
+        _In_ const std::string& key,
+        _In_ const std::vector<swss::FieldValueTuple>& arguments,
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list)
+{
+    SWSS_LOG_ENTER();
+
+    recordAttrLine("g", key, arguments, objectType, attr_count, attr_list, false);
+}
+
 void Recorder::recordGenericGetResponse(
         _In_ lai_status_t status,
         _In_ const std::vector<swss::FieldValueTuple>& arguments)
@@ -827,13 +1161,9 @@ void Recorder::recordCreate(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = LaiAttributeList::serialize_attr_list(
-            objectType,
-            attr_count,
-            attr_list,
-            false);
+    std::vector<swss::FieldValueTuple> entry;
 
-    if (entry.size() == 0)
+    if (attr_count == 0)
     {
         // make sure that we put object into db
         // even if there are no attributes set
@@ -846,9 +1176,9 @@ void Recorder::recordCreate(
 
     std::string key = serializedObjectType + ":" + serializedObjectId;
 
-    SWSS_LOG_DEBUG("generic create key: %s, fields: %zu", key.c_str(), entry.size());
+    SWSS_LOG_DEBUG("generic create key: %s, attributes: %u", key.c_str(), attr_count);
 
-    recordGenericCreate(key, entry);
+    recordGenericCreate(key, entry, objectType, attr_count, attr_list);
 }
 
 void Recorder::recordSet(
@@ -858,19 +1188,13 @@ void Recorder::recordSet(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = LaiAttributeList::serialize_attr_list(
-            objectType,
-            1,
-            attr,
-            false);
-
     auto serializedObjectType  = lai_serialize_object_type(objectType);
 
     auto key = serializedObjectType + ":" + serializedObjectId;
 
-    SWSS_LOG_DEBUG("generic set key: %s, fields: %zu", key.c_str(), entry.size());
+    SWSS_LOG_DEBUG("generic set key: %s", key.c_str());
 
-    recordGenericSet(key, entry);
+    recordGenericSet(key, {}, objectType, attr);
 }
 
 void Recorder::recordGet(
@@ -881,19 +1205,13 @@ void Recorder::recordGet(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry = LaiAttributeList::serialize_attr_list(
-            objectType,
-            attr_count,
-            attr_list,
-            false);
-
     std::string serializedObjectType = lai_serialize_object_type(objectType);
 
     std::string key = serializedObjectType + ":" + serializedObjectId;
 
-    SWSS_LOG_DEBUG("generic get key: %s, fields: %zu", key.c_str(), entry.size());
+    SWSS_LOG_DEBUG("generic get key: %s, attributes: %u", key.c_str(), attr_count);
 
-    recordGenericGet(key, entry);
+    recordGenericGet(key, {}, objectType, attr_count, attr_list);
 }
 
 void Recorder::recordGenericGetResponse(
@@ -904,32 +1222,22 @@ void Recorder::recordGenericGetResponse(
 {
     SWSS_LOG_ENTER();
 
+    // capital 'G' stands for GET api response
+
     if (status == LAI_STATUS_SUCCESS)
     {
-        auto entry = LaiAttributeList::serialize_attr_list(
-            objectType,
-            attr_count,
-            attr_list,
-            false);
-
-        recordGenericGetResponse(status, entry);
+        recordAttrLine("G", lai_serialize_status(status), {}, objectType, attr_count, attr_list, false);
     }
     else if (status == LAI_STATUS_BUFFER_OVERFLOW)
     {
         // will only record COUNT values for lists, since count is expected
         // values, and user buffer is not enough to return all from LAI
 
-        auto entry = LaiAttributeList::serialize_attr_list(
-            objectType,
-            attr_count,
-            attr_list,
-            true);
-
-        recordGenericGetResponse(status, entry);
+        recordAttrLine("G", lai_serialize_status(status), {}, objectType, attr_count, attr_list, true);
     }
     else
     {
-        recordGenericGetResponse(status, {});
+        recordAttrLine("G", lai_serialize_status(status), {}, objectType, 0, attr_list, false);
     }
 }
 
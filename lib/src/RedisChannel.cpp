@@ -9,6 +9,12 @@
 
 using namespace lairedis;
 
+/*
+ * Commands which don't reach histogram limit are published at least this
+ * often, with samples collected so far.
+ */
+#define LATENCY_PUBLISH_INTERVAL_SEC (10)
+
 RedisChannel::RedisChannel(
         _In_ const std::string& dbAsic,
         _In_ Channel::Callback callback):
@@ -24,6 +30,11 @@ RedisChannel::RedisChannel(
     m_asicState             = std::make_shared<swss::ProducerTable>(m_redisPipeline.get(), ASIC_STATE_TABLE, true);
     m_getConsumer           = std::make_shared<swss::ConsumerTable>(m_db.get(), REDIS_TABLE_GETRESPONSE);
 
+    m_getSelect.addSelectable(m_getConsumer.get());
+
+    m_latencyTable          = std::make_shared<swss::Table>(m_db.get(), REDIS_TABLE_LATENCY);
+    m_lastLatencyPublish    = std::chrono::steady_clock::now();
+
     m_dbNtf                 = std::make_shared<swss::DBConnector>(dbAsic, 0);
     m_notificationConsumer  = std::make_shared<swss::NotificationConsumer>(m_dbNtf.get(), REDIS_TABLE_NOTIFICATIONS);
 
@@ -146,6 +157,9 @@ void RedisChannel::set(
 {
     SWSS_LOG_ENTER();
 
+    m_lastCommand = command;
+    m_lastCommandStart = std::chrono::steady_clock::now();
+
     m_asicState->set(key, values, command);
 }
 
@@ -155,6 +169,9 @@ void RedisChannel::del(
 {
     SWSS_LOG_ENTER();
 
+    m_lastCommand = command;
+    m_lastCommandStart = std::chrono::steady_clock::now();
+
     m_asicState->del(key, command);
 }
 
@@ -164,17 +181,13 @@ lai_status_t RedisChannel::wait(
 {
     SWSS_LOG_ENTER();
 
-    swss::Select s;
-
-    s.addSelectable(m_getConsumer.get());
-
     while (true)
     {
         SWSS_LOG_DEBUG("wait for %s response", command.c_str());
 
         swss::Selectable *sel;
 
-        int result = s.select(&sel, (int)m_responseTimeoutMs);
+        int result = selectResponse(&sel);
 
         if (result == swss::Select::OBJECT)
         {
@@ -198,6 +211,8 @@ lai_status_t RedisChannel::wait(
 
             SWSS_LOG_DEBUG("%s status: %s", command.c_str(), opkey.c_str());
 
+            recordLatency();
+
             return status;
         }
 
@@ -209,3 +224,83 @@ lai_status_t RedisChannel::wait(
 
     return LAI_STATUS_FAILURE;
 }
+
+int RedisChannel::selectResponse(
+        _Out_ swss::Selectable **sel)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_busyPollUs)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto busyPoll = std::chrono::microseconds(m_busyPollUs);
+
+        do
+        {
+            int result = m_getSelect.select(sel, 0);
+
+            if (result != swss::Select::TIMEOUT)
+            {
+                return result;
+            }
+        }
+        while (std::chrono::steady_clock::now() - start < busyPoll);
+    }
+
+    return m_getSelect.select(sel, (int)m_responseTimeoutMs);
+}
+
+void RedisChannel::recordLatency()
+{
+    SWSS_LOG_ENTER();
+
+    auto now = std::chrono::steady_clock::now();
+
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(now - m_lastCommandStart).count();
+
+    auto& histogram = m_latency[m_lastCommand];
+
+    if (!histogram)
+    {
+        histogram = std::make_shared<lairediscommon::LatencyHistogram>("RedisChannel " + m_lastCommand);
+
+        std::string command = m_lastCommand;
+
+        histogram->setCallback([this, command](const lairediscommon::LatencyHistogram& h) {
+                publishLatency(command, h);
+                });
+    }
+
+    histogram->record((uint64_t)latency);
+
+    if (now - m_lastLatencyPublish >= std::chrono::seconds(LATENCY_PUBLISH_INTERVAL_SEC))
+    {
+        m_lastLatencyPublish = now;
+
+        for (auto& kvp: m_latency)
+        {
+            if (kvp.second->getCount())
+            {
+                publishLatency(kvp.first, *kvp.second);
+            }
+        }
+    }
+}
+
+void RedisChannel::publishLatency(
+        _In_ const std::string& command,
+        _In_ const lairediscommon::LatencyHistogram& histogram)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> values;
+
+    values.emplace_back("count", std::to_string(histogram.getCount()));
+    values.emplace_back("p50", std::to_string(histogram.getPercentile(50)));
+    values.emplace_back("p90", std::to_string(histogram.getPercentile(90)));
+    values.emplace_back("p99", std::to_string(histogram.getPercentile(99)));
+    values.emplace_back("max", std::to_string(histogram.getMax()));
+
+    m_latencyTable->set(command, values);
+}
@@ -4,6 +4,7 @@
 #include "Recorder.h"
 #include "VirtualObjectIdManager.h"
 #include "SkipRecordAttrContainer.h"
+#include "AttributeReadCache.h"
 #include "LinecardContainer.h"
 #include "PerformanceIntervalTimer.h"
 
@@ -11,6 +12,7 @@
 
 #include "meta/lai_serialize.h"
 #include "meta/LaiAttributeList.h"
+#include "meta/MetadataIndex.h"
 
 #include <inttypes.h>
 
@@ -73,6 +75,8 @@ lai_status_t RedisRemoteLaiInterface::initialize(
 
     m_skipRecordAttrContainer = std::make_shared<SkipRecordAttrContainer>();
 
+    m_readCache = std::make_shared<AttributeReadCache>();
+
     m_asicInitViewMode = false; // default mode is apply mode
     m_useTempView = false;
     m_syncMode = false;
@@ -84,6 +88,8 @@ lai_status_t RedisRemoteLaiInterface::initialize(
 
     m_responseTimeoutMs = m_communicationChannel->getResponseTimeout();
 
+    m_busyPollUs = m_communicationChannel->getBusyPoll();
+
     m_db = std::make_shared<swss::DBConnector>(m_contextConfig->m_dbAsic, 0);
 
     m_redisVidIndexGenerator = std::make_shared<RedisVidIndexGenerator>(m_db, REDIS_KEY_VIDCOUNTER);
@@ -222,6 +228,8 @@ lai_status_t RedisRemoteLaiInterface::remove(
             objectType,
             lai_serialize_object_id(objectId));
 
+    m_readCache->invalidate(objectId);
+
     if (objectType == LAI_OBJECT_TYPE_LINECARD && status == LAI_STATUS_SUCCESS)
     {
         SWSS_LOG_NOTICE("removing linecard id %s", lai_serialize_object_id(objectId).c_str());
@@ -300,6 +308,16 @@ lai_status_t RedisRemoteLaiInterface::setRedisExtensionAttribute(
 
             return LAI_STATUS_SUCCESS;
 
+        case LAI_REDIS_LINECARD_ATTR_SYNC_OPERATION_BUSY_POLL:
+
+            m_busyPollUs = attr->value.u64;
+
+            m_communicationChannel->setBusyPoll(m_busyPollUs);
+
+            SWSS_LOG_NOTICE("set busy poll to %" PRIu64 " us", m_busyPollUs);
+
+            return LAI_STATUS_SUCCESS;
+
         case LAI_REDIS_LINECARD_ATTR_SYNC_MODE:
 
             SWSS_LOG_WARN("sync mode is depreacated, use communication mode");
@@ -335,6 +353,8 @@ lai_status_t RedisRemoteLaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
 
+                    m_communicationChannel->setBusyPoll(m_busyPollUs);
+
                     m_communicationChannel->setBuffered(true);
 
                     return LAI_STATUS_SUCCESS;
@@ -351,6 +371,8 @@ lai_status_t RedisRemoteLaiInterface::setRedisExtensionAttribute(
 
                     m_communicationChannel->setResponseTimeout(m_responseTimeoutMs);
 
+                    m_communicationChannel->setBusyPoll(m_busyPollUs);
+
                     m_communicationChannel->setBuffered(false);
 
                     return LAI_STATUS_SUCCESS;
@@ -398,6 +420,31 @@ lai_status_t RedisRemoteLaiInterface::setRedisExtensionAttribute(
             }
 
             return LAI_STATUS_SUCCESS;
+
+        case LAI_REDIS_LINECARD_ATTR_RECORDING_FORMAT:
+
+            if (m_recorder && !m_recorder->setRecordingFormat(*attr))
+            {
+                return LAI_STATUS_INVALID_PARAMETER;
+            }
+
+            return LAI_STATUS_SUCCESS;
+
+        case LAI_REDIS_LINECARD_ATTR_READ_CACHE:
+
+            SWSS_LOG_NOTICE("%s read cache", attr->value.booldata ? "enabling" : "disabling");
+
+            m_readCache->setEnabled(attr->value.booldata);
+
+            return LAI_STATUS_SUCCESS;
+
+        case LAI_REDIS_LINECARD_ATTR_READ_CACHE_TTL:
+
+            SWSS_LOG_NOTICE("setting read cache ttl to %" PRIu64 " ms", attr->value.u64);
+
+            m_readCache->setTtl(attr->value.u64);
+
+            return LAI_STATUS_SUCCESS;
             
         default:
             break;
@@ -425,6 +472,17 @@ lai_status_t RedisRemoteLaiInterface::set(
             lai_serialize_object_id(objectId),
             attr);
 
+    if (objectType == LAI_OBJECT_TYPE_LINECARD)
+    {
+        // linecard attributes can affect read only state of any object
+
+        m_readCache->clear();
+    }
+    else
+    {
+        m_readCache->invalidate(objectId);
+    }
+
     if (objectType == LAI_OBJECT_TYPE_LINECARD && status == LAI_STATUS_SUCCESS)
     {
         auto sw = m_linecardContainer->getLinecard(objectId);
@@ -454,11 +512,114 @@ lai_status_t RedisRemoteLaiInterface::get(
 {
     SWSS_LOG_ENTER();
 
-    return get(
+    if (m_readCache->isEnabled())
+    {
+        lai_status_t status;
+
+        if (getFromReadCache(objectType, objectId, attr_count, attr_list, status))
+        {
+            return status;
+        }
+    }
+
+    uint64_t generation = m_readCache->getGeneration();
+
+    auto status = get(
             objectType,
             lai_serialize_object_id(objectId),
             attr_count,
             attr_list);
+
+    if (status == LAI_STATUS_SUCCESS)
+    {
+        m_readCache->update(generation, objectType, objectId, attr_count, attr_list);
+    }
+
+    return status;
+}
+
+bool RedisRemoteLaiInterface::getFromReadCache(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId,
+        _In_ uint32_t attr_count,
+        _Inout_ lai_attribute_t *attr_list,
+        _Out_ lai_status_t& status)
+{
+    SWSS_LOG_ENTER();
+
+    status = LAI_STATUS_FAILURE;
+
+    auto meta = m_meta.lock();
+
+    if (!meta || attr_count == 0)
+    {
+        return false;
+    }
+
+    lai_object_meta_key_t metaKey;
+
+    metaKey.objecttype = objectType;
+    metaKey.objectkey.key.object_id = objectId;
+
+    std::vector<swss::FieldValueTuple> values;
+
+    for (uint32_t idx = 0; idx < attr_count; idx++)
+    {
+        auto md = laimeta::MetadataIndex::getInstance().getAttrMetadata(objectType, attr_list[idx].id);
+
+        if (md == NULL)
+        {
+            return false;
+        }
+
+        std::string value;
+
+        if (LAI_HAS_FLAG_READ_ONLY(md->flags))
+        {
+            if (!m_readCache->get(objectId, md->attrid, value))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            auto attr = meta->getObjectLocalAttr(metaKey, md->attrid);
+
+            if (!attr)
+            {
+                return false;
+            }
+
+            value = lai_serialize_attr_value(*md, *attr->getLaiAttr());
+        }
+
+        values.emplace_back(md->attridname, value);
+    }
+
+    SWSS_LOG_DEBUG("get %s served from read cache", lai_serialize_object_id(objectId).c_str());
+
+    // get served from cache is recorded same as get served by syncd, so
+    // recording contains every value returned to application
+
+    bool record = !m_skipRecordAttrContainer->canSkipRecording(objectType, attr_count, attr_list);
+
+    if (record)
+    {
+        m_recorder->recordGenericGet(objectType, objectId, attr_count, attr_list);
+    }
+
+    LaiAttributeList list(objectType, values, false);
+
+    // BUFFER_OVERFLOW will transfer only list counts, same as syncd response
+
+    status = transfer_attributes(objectType, attr_count, list.get_attr_list(), attr_list, false);
+
+    if (record)
+    {
+        m_recorder->recordGenericGetResponse(status, objectType, attr_count, attr_list);
+    }
+
+    return true;
 }
 
 lai_status_t RedisRemoteLaiInterface::create(
@@ -490,7 +651,7 @@ lai_status_t RedisRemoteLaiInterface::create(
 
     SWSS_LOG_NOTICE("generic create key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_recorder->recordGenericCreate(key, entry);
+    m_recorder->recordGenericCreate(key, entry, object_type, attr_count, attr_list);
 
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_CREATE);
 
@@ -544,7 +705,7 @@ lai_status_t RedisRemoteLaiInterface::set(
 
     SWSS_LOG_NOTICE("generic set key: %s, fields: %zu", key.c_str(), entry.size());
 
-    m_recorder->recordGenericSet(key, entry);
+    m_recorder->recordGenericSet(key, entry, objectType, attr);
 
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_SET);
 
@@ -646,7 +807,7 @@ lai_status_t RedisRemoteLaiInterface::get(
 
     if (record)
     {
-        m_recorder->recordGenericGet(key, entry);
+        m_recorder->recordGenericGet(key, entry, objectType, attr_count, attr_list);
     }
 
     // get is special, it will not put data
@@ -664,6 +825,122 @@ lai_status_t RedisRemoteLaiInterface::get(
 }
 
 
+lai_status_t RedisRemoteLaiInterface::bulkGet(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        Utils::clearOidValues(objectType, attr_count[idx], attr_list[idx]);
+
+        auto entry = LaiAttributeList::serialize_attr_list(objectType, attr_count[idx], attr_list[idx], false);
+
+        entries.emplace_back(lai_serialize_object_id(object_id[idx]), std::to_string(entry.size()));
+
+        entries.insert(entries.end(), entry.begin(), entry.end());
+    }
+
+    std::string key = lai_serialize_object_type(objectType) + ":" + std::to_string(object_count);
+
+    SWSS_LOG_INFO("bulk get key: %s, fields: %zu", key.c_str(), entries.size());
+
+    m_recorder->recordBulkGenericGet(key, entries);
+
+    uint64_t generation = m_readCache->getGeneration();
+
+    // bulk get, same as get will not put data into asic view
+
+    m_communicationChannel->set(key, entries, REDIS_ASIC_STATE_COMMAND_BULK_GET);
+
+    auto status = waitForBulkGetResponse(objectType, object_count, attr_count, attr_list, object_statuses);
+
+    m_recorder->recordBulkGenericGetResponse(status, objectType, object_count, attr_count, attr_list, object_statuses);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] == LAI_STATUS_SUCCESS)
+        {
+            m_readCache->update(generation, objectType, object_id[idx], attr_count[idx], attr_list[idx]);
+        }
+    }
+
+    return status;
+}
+
+lai_status_t RedisRemoteLaiInterface::waitForBulkGetResponse(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    swss::KeyOpFieldsValuesTuple kco;
+
+    auto status = m_communicationChannel->wait(REDIS_ASIC_STATE_COMMAND_GETRESPONSE, kco);
+
+    auto &values = kfvFieldsValues(kco);
+
+    if (values.size() == 0)
+    {
+        // timeout or syncd was not able to process request at all
+
+        for (uint32_t idx = 0; idx < object_count; idx++)
+        {
+            object_statuses[idx] = (status == LAI_STATUS_SUCCESS) ? LAI_STATUS_FAILURE : status;
+        }
+
+        return (status == LAI_STATUS_SUCCESS) ? LAI_STATUS_FAILURE : status;
+    }
+
+    size_t pos = 0;
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (pos >= values.size())
+        {
+            SWSS_LOG_THROW("logic error, bulk get response contains less than %u objects", object_count);
+        }
+
+        lai_deserialize_status(fvField(values[pos]), object_statuses[idx]);
+
+        size_t count = std::stoul(fvValue(values[pos]));
+
+        pos++;
+
+        if (pos + count > values.size())
+        {
+            SWSS_LOG_THROW("logic error, bulk get response object %u is truncated", idx);
+        }
+
+        if (object_statuses[idx] == LAI_STATUS_SUCCESS || object_statuses[idx] == LAI_STATUS_BUFFER_OVERFLOW)
+        {
+            // on overflow only list counts are returned, same as on single get
+
+            bool countOnly = (object_statuses[idx] == LAI_STATUS_BUFFER_OVERFLOW);
+
+            std::vector<swss::FieldValueTuple> entry(values.begin() + pos, values.begin() + pos + count);
+
+            LaiAttributeList list(objectType, entry, countOnly);
+
+            transfer_attributes(objectType, attr_count[idx], list.get_attr_list(), attr_list[idx], countOnly);
+        }
+
+        pos += count;
+    }
+
+    return status;
+}
+
 lai_status_t RedisRemoteLaiInterface::getStats(
         _In_ lai_object_type_t object_type,
         _In_ lai_object_id_t object_id,
@@ -673,7 +950,7 @@ lai_status_t RedisRemoteLaiInterface::getStats(
 {
     SWSS_LOG_ENTER();
 
-    auto stats_enum = lai_metadata_get_object_type_info(object_type)->statenum;
+    auto stats_enum = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(object_type)->statenum;
 
     auto entry = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
 
@@ -685,9 +962,28 @@ lai_status_t RedisRemoteLaiInterface::getStats(
 
     // get_stats will not put data to asic view, only to message queue
 
+    m_recorder->recordGenericGetStats(key, entry);
+
     m_communicationChannel->set(key, entry, REDIS_ASIC_STATE_COMMAND_GET_STATS);
 
-    return waitForGetStatsResponse(object_type, number_of_counters, counter_ids, counters);
+    auto status = waitForGetStatsResponse(object_type, number_of_counters, counter_ids, counters);
+
+    // record raw 64 bit values, so stats of any value type can be replayed
+    // bit exact by virtual linecard
+
+    std::vector<uint64_t> values;
+
+    if (status == LAI_STATUS_SUCCESS)
+    {
+        for (uint32_t idx = 0; idx < number_of_counters; idx++)
+        {
+            values.push_back(counters[idx].u64);
+        }
+    }
+
+    m_recorder->recordGenericGetStatsResponse(status, (uint32_t)values.size(), values.data());
+
+    return status;
 }
 
 lai_status_t RedisRemoteLaiInterface::waitForGetStatsResponse(
@@ -713,12 +1009,16 @@ lai_status_t RedisRemoteLaiInterface::waitForGetStatsResponse(
 
         for (uint32_t idx = 0; idx < number_of_counters; idx++)
         {
-            auto stat_metadata  = lai_metadata_get_stat_metadata(object_type, counter_ids[idx]);
-            if (stat_metadata->statvaluetype == LAI_STAT_VALUE_TYPE_UINT64) { 
-                counters[idx].u64 = stoull(fvValue(values[idx]));
-            } else if (stat_metadata->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE) {
-                counters[idx].d64 = stod(fvValue(values[idx]));
+            auto stat_metadata  = laimeta::MetadataIndex::getInstance().getStatMetadata(object_type, counter_ids[idx]);
+
+            if (stat_metadata == NULL)
+            {
+                SWSS_LOG_THROW("failed to find stat metadata for %s stat %d",
+                        lai_serialize_object_type(object_type).c_str(),
+                        counter_ids[idx]);
             }
+
+            lai_deserialize_stat_value(*stat_metadata, fvValue(values[idx]), counters[idx]);
         }
     }
 
@@ -750,7 +1050,7 @@ lai_status_t RedisRemoteLaiInterface::clearStats(
 {
     SWSS_LOG_ENTER();
 
-    auto stats_enum = lai_metadata_get_object_type_info(object_type)->statenum;
+    auto stats_enum = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(object_type)->statenum;
 
     auto values = serialize_counter_id_list(stats_enum, number_of_counters, counter_ids);
 
@@ -793,7 +1093,7 @@ lai_status_t RedisRemoteLaiInterface::getAlarms(
 {
     SWSS_LOG_ENTER();
 
-    auto alarms_enum = lai_metadata_get_object_type_info(object_type)->alarmenum;
+    auto alarms_enum = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(object_type)->alarmenum;
 
     auto entry = serialize_alarm_id_list(alarms_enum, number_of_alarms, alarm_ids);
 
@@ -846,7 +1146,7 @@ lai_status_t RedisRemoteLaiInterface::clearAlarms(
 {
     SWSS_LOG_ENTER();
 
-    auto alarms_enum = lai_metadata_get_object_type_info(object_type)->alarmenum;
+    auto alarms_enum = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(object_type)->alarmenum;
 
     auto values = serialize_alarm_id_list(alarms_enum, number_of_alarms, alarm_ids);
 
@@ -955,7 +1255,7 @@ lai_status_t RedisRemoteLaiInterface::queryAttributeCapability(
     auto linecardIdStr = lai_serialize_object_id(linecardId);
     auto objectTypeStr = lai_serialize_object_type(objectType);
 
-    auto meta = lai_metadata_get_attr_metadata(objectType, attrId);
+    auto meta = laimeta::MetadataIndex::getInstance().getAttrMetadata(objectType, attrId);
 
     if (meta == NULL)
     {
@@ -1041,7 +1341,7 @@ lai_status_t RedisRemoteLaiInterface::queryAattributeEnumValuesCapability(
     auto linecard_id_str = lai_serialize_object_id(linecardId);
     auto object_type_str = lai_serialize_object_type(objectType);
 
-    auto meta = lai_metadata_get_attr_metadata(objectType, attrId);
+    auto meta = laimeta::MetadataIndex::getInstance().getAttrMetadata(objectType, attrId);
 
     if (meta == NULL)
     {
@@ -1224,6 +1524,10 @@ void RedisRemoteLaiInterface::handleNotification(
 
     m_recorder->recordNotification(name, serializedNotification, values);
 
+    // notification may carry read only state change of any object
+
+    m_readCache->clear();
+
     auto notification = NotificationFactory::deserialize(name, serializedNotification);
 
     if (notification)
@@ -1340,6 +1644,11 @@ void RedisRemoteLaiInterface::clear_local_state()
                 m_contextConfig->m_scc,
                 m_redisVidIndexGenerator);
 
+    if (m_readCache)
+    {
+        m_readCache->clear();
+    }
+
     auto meta = m_meta.lock();
 
     if (meta)
@@ -1,4 +1,5 @@
 #include "VirtualObjectIdManager.h"
+#include "ObjectIdLayout.h"
 
 #include "meta/lai_serialize.h"
 #include "swss/logger.h"
@@ -8,72 +9,17 @@ extern "C" {
 #include "laimetadata.h"
 }
 
-#define LAI_OBJECT_ID_BITS_SIZE (8 * sizeof(lai_object_id_t))
-
-static_assert(LAI_OBJECT_ID_BITS_SIZE == 64, "lai_object_id_t must have 64 bits");
 static_assert(sizeof(lai_object_id_t) == sizeof(uint64_t), "LAI object ID size should be uint64_t");
 
-#define LAI_REDIS_LINECARD_INDEX_BITS_SIZE ( 8 )
-#define LAI_REDIS_LINECARD_INDEX_MAX ( (1ULL << LAI_REDIS_LINECARD_INDEX_BITS_SIZE) - 1 )
-#define LAI_REDIS_LINECARD_INDEX_MASK (LAI_REDIS_LINECARD_INDEX_MAX)
-
-#define LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE ( 8 )
-#define LAI_REDIS_GLOBAL_CONTEXT_MAX ( (1ULL << LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE) - 1 )
-#define LAI_REDIS_GLOBAL_CONTEXT_MASK (LAI_REDIS_GLOBAL_CONTEXT_MAX)
-
-#define LAI_REDIS_OBJECT_TYPE_BITS_SIZE ( 8 )
-#define LAI_REDIS_OBJECT_TYPE_MAX ( (1ULL << LAI_REDIS_OBJECT_TYPE_BITS_SIZE) - 1 )
-#define LAI_REDIS_OBJECT_TYPE_MASK (LAI_REDIS_OBJECT_TYPE_MAX)
-
-#define LAI_REDIS_OBJECT_INDEX_BITS_SIZE ( 40 )
-#define LAI_REDIS_OBJECT_INDEX_MAX ( (1ULL << LAI_REDIS_OBJECT_INDEX_BITS_SIZE) - 1 )
-#define LAI_REDIS_OBJECT_INDEX_MASK (LAI_REDIS_OBJECT_INDEX_MAX)
-
-#define LAI_REDIS_OBJECT_ID_BITS_SIZE (      \
-        LAI_REDIS_LINECARD_INDEX_BITS_SIZE +   \
-        LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE + \
-        LAI_REDIS_OBJECT_TYPE_BITS_SIZE +    \
-        LAI_REDIS_OBJECT_INDEX_BITS_SIZE )
-
-static_assert(LAI_REDIS_OBJECT_ID_BITS_SIZE == LAI_OBJECT_ID_BITS_SIZE, "redis object id size must be equal to LAI object id size");
-
-/*
- * This condition must be met, since we need to be able to encode LAI object
- * type in object id on defined number of bits.
- */
-static_assert(LAI_OBJECT_TYPE_EXTENSIONS_MAX < LAI_REDIS_OBJECT_TYPE_MAX, "redis max object type value must be greater than supported LAI max object type value");
-
-/*
- * Current OBJECT ID format:
- *
- * bits 63..56 - linecard index
- * bits 55..48 - LAI object type
- * bits 47..40 - global context
- * bits 40..0  - object index
- *
- * So large number of bits is required, otherwise we would need to have map of
- * OID to some struct that will have all those values.  But having all this
- * information in OID itself is more convenient.
- */
-
-#define LAI_REDIS_GET_OBJECT_INDEX(oid) \
-    ( ((uint64_t)oid) & ( LAI_REDIS_OBJECT_INDEX_MASK ) )
-
-#define LAI_REDIS_GET_GLOBAL_CONTEXT(oid) \
-    ( (((uint64_t)oid) >> (LAI_REDIS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_REDIS_GLOBAL_CONTEXT_MASK ) )
-
-#define LAI_REDIS_GET_OBJECT_TYPE(oid) \
-    ( (((uint64_t)oid) >> ( LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE + LAI_REDIS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_REDIS_OBJECT_TYPE_MASK ) )
-
-#define LAI_REDIS_GET_LINECARD_INDEX(oid) \
-    ( (((uint64_t)oid) >> ( LAI_REDIS_OBJECT_TYPE_BITS_SIZE + LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE + LAI_REDIS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_REDIS_LINECARD_INDEX_MASK ) )
+typedef lairedis::RedisObjectIdLayout Layout;
 
 #define LAI_REDIS_TEST_OID (0x0123456789abcdef)
 
-static_assert(LAI_REDIS_GET_LINECARD_INDEX(LAI_REDIS_TEST_OID) == 0x01, "test linecard index");
-static_assert(LAI_REDIS_GET_OBJECT_TYPE(LAI_REDIS_TEST_OID) == 0x23, "test object type");
-static_assert(LAI_REDIS_GET_GLOBAL_CONTEXT(LAI_REDIS_TEST_OID) == 0x45, "test global context");
-static_assert(LAI_REDIS_GET_OBJECT_INDEX(LAI_REDIS_TEST_OID) == 0x6789abcdef, "test object index");
+static_assert(Layout::getLinecardIndex(LAI_REDIS_TEST_OID) == 0x01, "test linecard index");
+static_assert(Layout::getObjectType(LAI_REDIS_TEST_OID) == 0x23, "test object type");
+static_assert(Layout::getGlobalContext(LAI_REDIS_TEST_OID) == 0x45, "test global context");
+static_assert(Layout::getObjectIndex(LAI_REDIS_TEST_OID) == 0x6789abcdef, "test object index");
+static_assert(Layout::construct((lai_object_type_t)0x23, 0x01, 0x6789abcdef, 0x45) == LAI_REDIS_TEST_OID, "test construct");
 
 using namespace lairedis;
 
@@ -87,11 +33,11 @@ VirtualObjectIdManager::VirtualObjectIdManager(
 {
     SWSS_LOG_ENTER();
 
-    if (globalContext > LAI_REDIS_GLOBAL_CONTEXT_MAX)
+    if (globalContext > Layout::GLOBAL_CONTEXT_MAX)
     {
-        SWSS_LOG_THROW("specified globalContext(0x%x) > maximum global context 0x%llx",
+        SWSS_LOG_THROW("specified globalContext(0x%x) > maximum global context 0x%" PRIx64,
                 globalContext,
-                LAI_REDIS_GLOBAL_CONTEXT_MAX);
+                Layout::GLOBAL_CONTEXT_MAX);
     }
 }
 
@@ -126,9 +72,9 @@ lai_object_id_t VirtualObjectIdManager::laiLinecardIdQuery(
     // - if object id has existing linecard index
     // but then this method can't be made static
 
-    uint32_t linecardIndex = (uint32_t)LAI_REDIS_GET_LINECARD_INDEX(objectId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(objectId);
 
-    uint32_t globalContext = (uint32_t)LAI_REDIS_GET_GLOBAL_CONTEXT(objectId);
+    uint32_t globalContext = Layout::getGlobalContext(objectId);
 
     return constructObjectId(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, globalContext);
 }
@@ -143,7 +89,7 @@ lai_object_type_t VirtualObjectIdManager::laiObjectTypeQuery(
         return LAI_OBJECT_TYPE_NULL;
     }
 
-    lai_object_type_t objectType = (lai_object_type_t)(LAI_REDIS_GET_OBJECT_TYPE(objectId));
+    lai_object_type_t objectType = Layout::getObjectType(objectId);
 
     if (objectType == LAI_OBJECT_TYPE_NULL || objectType >= LAI_OBJECT_TYPE_EXTENSIONS_MAX)
     {
@@ -179,7 +125,7 @@ uint32_t VirtualObjectIdManager::allocateNewLinecardIndex()
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t index = 0; index < LAI_REDIS_LINECARD_INDEX_MAX; ++index)
+    for (uint32_t index = 0; index < Layout::LINECARD_INDEX_MAX; ++index)
     {
         if (m_linecardIndexes.find(index) != m_linecardIndexes.end())
             continue;
@@ -237,15 +183,15 @@ lai_object_id_t VirtualObjectIdManager::allocateNewObjectId(
                 lai_serialize_object_type(linecardObjectType).c_str());
     }
 
-    uint32_t linecardIndex = (uint32_t)LAI_REDIS_GET_LINECARD_INDEX(linecardId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(linecardId);
 
     uint64_t objectIndex = m_oidIndexGenerator->increment(); // get new object index
 
-    if (objectIndex > LAI_REDIS_OBJECT_INDEX_MAX)
+    if (objectIndex > Layout::OBJECT_INDEX_MAX)
     {
-        SWSS_LOG_THROW("no more object indexes available, given: 0x%" PRIu64 " but limit is 0x%llu",
+        SWSS_LOG_THROW("no more object indexes available, given: 0x%" PRIx64 " but limit is 0x%" PRIx64,
                 objectIndex,
-                LAI_REDIS_OBJECT_INDEX_MAX);
+                Layout::OBJECT_INDEX_MAX);
     }
 
     lai_object_id_t objectId = constructObjectId(objectType, linecardIndex, objectIndex, m_globalContext);
@@ -272,9 +218,9 @@ lai_object_id_t VirtualObjectIdManager::allocateNewLinecardObjectId(
 
     uint32_t linecardIndex = config->m_linecardIndex;
 
-    if (linecardIndex > LAI_REDIS_LINECARD_INDEX_MAX)
+    if (linecardIndex > Layout::LINECARD_INDEX_MAX)
     {
-        SWSS_LOG_THROW("linecard index %u > %llu (max)", linecardIndex, LAI_REDIS_LINECARD_INDEX_MAX);
+        SWSS_LOG_THROW("linecard index %u > %" PRIu64 " (max)", linecardIndex, Layout::LINECARD_INDEX_MAX);
     }
 
     m_linecardIndexes.insert(linecardIndex);
@@ -296,7 +242,7 @@ void VirtualObjectIdManager::releaseObjectId(
 
     if (laiObjectTypeQuery(objectId) == LAI_OBJECT_TYPE_LINECARD)
     {
-        releaseLinecardIndex((uint32_t)LAI_REDIS_GET_LINECARD_INDEX(objectId));
+        releaseLinecardIndex(Layout::getLinecardIndex(objectId));
     }
 }
 
@@ -308,11 +254,7 @@ lai_object_id_t VirtualObjectIdManager::constructObjectId(
 {
     SWSS_LOG_ENTER();
 
-    return (lai_object_id_t)(
-            ((uint64_t)linecardIndex << (LAI_REDIS_OBJECT_TYPE_BITS_SIZE + LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE + LAI_REDIS_OBJECT_INDEX_BITS_SIZE)) |
-            ((uint64_t)objectType << (LAI_REDIS_GLOBAL_CONTEXT_BITS_SIZE + LAI_REDIS_OBJECT_INDEX_BITS_SIZE)) |
-            ((uint64_t)globalContext << (LAI_REDIS_OBJECT_INDEX_BITS_SIZE)) |
-            objectIndex);
+    return Layout::construct(objectType, linecardIndex, objectIndex, globalContext);
 }
 
 lai_object_id_t VirtualObjectIdManager::linecardIdQuery(
@@ -340,8 +282,8 @@ lai_object_id_t VirtualObjectIdManager::linecardIdQuery(
         return objectId;
     }
 
-    uint32_t linecardIndex = (uint32_t)LAI_REDIS_GET_LINECARD_INDEX(objectId);
-    uint32_t globalContext = (uint32_t)LAI_REDIS_GET_GLOBAL_CONTEXT(objectId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(objectId);
+    uint32_t globalContext = Layout::getGlobalContext(objectId);
 
     return constructObjectId(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, globalContext);
 }
@@ -356,7 +298,7 @@ lai_object_type_t VirtualObjectIdManager::objectTypeQuery(
         return LAI_OBJECT_TYPE_NULL;
     }
 
-    lai_object_type_t objectType = (lai_object_type_t)(LAI_REDIS_GET_OBJECT_TYPE(objectId));
+    lai_object_type_t objectType = Layout::getObjectType(objectId);
 
     if (!lai_metadata_is_object_type_valid(objectType))
     {
@@ -376,7 +318,7 @@ uint32_t VirtualObjectIdManager::getLinecardIndex(
 
     auto linecardId = linecardIdQuery(objectId);
 
-    return (uint32_t)LAI_REDIS_GET_LINECARD_INDEX(linecardId);
+    return Layout::getLinecardIndex(linecardId);
 }
 
 uint32_t VirtualObjectIdManager::getGlobalContext(
@@ -386,7 +328,7 @@ uint32_t VirtualObjectIdManager::getGlobalContext(
 
     auto linecardId = linecardIdQuery(objectId);
 
-    return (uint32_t)LAI_REDIS_GET_GLOBAL_CONTEXT(linecardId);
+    return Layout::getGlobalContext(linecardId);
 }
 
 uint64_t VirtualObjectIdManager::getObjectIndex(
@@ -394,7 +336,7 @@ uint64_t VirtualObjectIdManager::getObjectIndex(
 {
     SWSS_LOG_ENTER();
 
-    return (uint32_t)LAI_REDIS_GET_OBJECT_INDEX(objectId);
+    return Layout::getObjectIndex(objectId);
 }
 
 lai_object_id_t VirtualObjectIdManager::updateObjectIndex(
@@ -408,9 +350,9 @@ lai_object_id_t VirtualObjectIdManager::updateObjectIndex(
         SWSS_LOG_THROW("can't update object index on NULL_OBJECT_ID");
     }
 
-    if (objectIndex > LAI_REDIS_OBJECT_INDEX_MAX)
+    if (objectIndex > Layout::OBJECT_INDEX_MAX)
     {
-        SWSS_LOG_THROW("object index %" PRIu64 " over maximum %llu", objectIndex, LAI_REDIS_OBJECT_INDEX_MAX);
+        SWSS_LOG_THROW("object index %" PRIu64 " over maximum %" PRIu64, objectIndex, Layout::OBJECT_INDEX_MAX);
     }
 
     lai_object_type_t objectType = objectTypeQuery(objectId);
@@ -421,8 +363,8 @@ lai_object_id_t VirtualObjectIdManager::updateObjectIndex(
                 lai_serialize_object_id(objectId).c_str());
     }
 
-    uint32_t linecardIndex = (uint32_t)LAI_REDIS_GET_LINECARD_INDEX(objectId);
-    uint32_t globalContext = (uint32_t)LAI_REDIS_GET_GLOBAL_CONTEXT(objectId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(objectId);
+    uint32_t globalContext = Layout::getGlobalContext(objectId);
 
     return constructObjectId(objectType, linecardIndex, objectIndex, globalContext);
 }
@@ -148,5 +148,24 @@ lai_status_t lai_dbg_generate_dump(
 {
     SWSS_LOG_ENTER();
 
-    return LAI_STATUS_NOT_IMPLEMENTED;
+    return redis_lai->dbgGenerateDump(dump_file_name);
+}
+
+lai_status_t lai_redis_bulk_get(
+        _In_ lai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    return redis_lai->bulkGet(
+            object_type,
+            object_count,
+            object_id,
+            attr_count,
+            attr_list,
+            object_statuses);
 }
@@ -0,0 +1,107 @@
+#pragma once
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include <map>
+#include <vector>
+
+namespace laimeta
+{
+    /**
+     * @brief Map keyed by attribute id.
+     *
+     * Attribute ids below MAX_FLAT_ATTR_ID are stored in flat vector indexed
+     * by attribute id, custom range attributes go to ordered map, so slots
+     * are visited in attribute id order.
+     */
+    template <typename T>
+    class AttrIdMap
+    {
+        public:
+
+            static constexpr lai_attr_id_t MAX_FLAT_ATTR_ID = 0x1000;
+
+        public:
+
+            /**
+             * @brief Get slot for attribute id, missing slot is created with
+             * default value.
+             */
+            T& operator[](
+                    _In_ lai_attr_id_t id)
+            {
+                // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                if (id >= MAX_FLAT_ATTR_ID)
+                {
+                    return m_customSlots[id];
+                }
+
+                if ((size_t)id >= m_flatSlots.size())
+                {
+                    m_flatSlots.resize((size_t)id + 1);
+                }
+
+                return m_flatSlots[id];
+            }
+
+            /**
+             * @return Slot for attribute id or nullptr if slot was not
+             * created.
+             */
+            const T* find(
+                    _In_ lai_attr_id_t id) const
+            {
+                // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                if (id >= MAX_FLAT_ATTR_ID)
+                {
+                    auto it = m_customSlots.find(id);
+
+                    return (it == m_customSlots.end()) ? nullptr : &it->second;
+                }
+
+                return ((size_t)id < m_flatSlots.size()) ? &m_flatSlots[id] : nullptr;
+            }
+
+            /**
+             * @brief Number of slots, including default valued flat slots.
+             */
+            size_t size() const
+            {
+                // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                return m_flatSlots.size() + m_customSlots.size();
+            }
+
+            /**
+             * @brief Call function for every slot in attribute id order.
+             */
+            template <typename F>
+            void forEach(
+                    _In_ F f) const
+            {
+                // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+                for (auto& slot: m_flatSlots)
+                {
+                    f(slot);
+                }
+
+                for (auto& kvp: m_customSlots)
+                {
+                    f(kvp.second);
+                }
+            }
+
+        private:
+
+            std::vector<T> m_flatSlots;
+
+            std::map<lai_attr_id_t, T> m_customSlots;
+    };
+}
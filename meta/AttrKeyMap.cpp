@@ -1,6 +1,9 @@
 #include "AttrKeyMap.h"
 
 #include "lai_serialize.h"
+#include "MetadataIndex.h"
+
+#include <map>
 
 using namespace laimeta;
 
@@ -9,65 +12,73 @@ void AttrKeyMap::clear()
     SWSS_LOG_ENTER();
 
     m_map.clear();
+    m_attrKeys.clear();
 }
 
 void AttrKeyMap::insert(
-        _In_ const std::string& metaKey,
-        _In_ const std::string& attrKey)
+        _In_ const lai_object_meta_key_t& metaKey,
+        _In_ const AttrKey& attrKey)
 {
     SWSS_LOG_ENTER();
 
-    m_map[metaKey] = attrKey;
-}
+    eraseMetaKey(metaKey);
+
+    auto& entry = m_map[metaKey.objectkey.key.object_id];
 
+    entry.m_metaKey = metaKey;
+    entry.m_attrKey = attrKey;
+
+    m_attrKeys[attrKey]++;
+}
 
 void AttrKeyMap::eraseMetaKey(
-        _In_ const std::string& metaKey)
+        _In_ const lai_object_meta_key_t& metaKey)
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_map.find(metaKey);
+    auto it = m_map.find(metaKey.objectkey.key.object_id);
 
     if (it != m_map.end())
     {
-        SWSS_LOG_DEBUG("erasing attributes key %s", it->second.c_str());
+        SWSS_LOG_DEBUG("erasing attributes key %s", serializeKey(it->second.m_attrKey).c_str());
+
+        auto kit = m_attrKeys.find(it->second.m_attrKey);
+
+        if (kit != m_attrKeys.end() && --kit->second == 0)
+        {
+            m_attrKeys.erase(kit);
+        }
 
         m_map.erase(it);
     }
 }
 
 bool AttrKeyMap::attrKeyExists(
-        _In_ const std::string& attrKey) const
+        _In_ const AttrKey& attrKey) const
 {
     SWSS_LOG_ENTER();
 
-    for (auto& it: m_map)
-    {
-        if (it.second == attrKey)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return m_attrKeys.find(attrKey) != m_attrKeys.end();
 }
 
-std::string AttrKeyMap::constructKey(
+AttrKeyMap::AttrKey AttrKeyMap::constructKey(
         _In_ const lai_object_meta_key_t& metaKey,
         _In_ uint32_t attrCount,
         _In_ const lai_attribute_t* attrList)
 {
     SWSS_LOG_ENTER();
 
+    auto& index = MetadataIndex::getInstance();
+
     // Use map to make sure that keys will be always sorted by attr id.
 
-    std::map<int32_t, std::string> keys;
+    std::map<int32_t, AttrKey> keys;
 
     for (uint32_t idx = 0; idx < attrCount; ++idx)
     {
         const auto& attr = attrList[idx];
 
-        auto* md = lai_metadata_get_attr_metadata(metaKey.objecttype, attr.id);
+        auto* md = index.getAttrMetadata(metaKey.objecttype, attr.id);
 
         if (!md)
         {
@@ -83,7 +94,9 @@ std::string AttrKeyMap::constructKey(
             continue;
         }
 
-        std::string name = md->attridname + std::string(":");
+        auto& key = keys[md->attrid];
+
+        key.push_back(index.getAttrHandle(md));
 
         switch (md->attrvaluetype)
         {
@@ -91,36 +104,38 @@ std::string AttrKeyMap::constructKey(
 
                 // NOTE: this list should be sorted
 
+                key.push_back(value.u32list.count);
+
                 for (uint32_t i = 0; i < value.u32list.count; ++i)
                 {
-                    name += std::to_string(value.u32list.list[i]);
-
-                    if (i != value.u32list.count - 1)
-                    {
-                        name += ",";
-                    }
+                    key.push_back(value.u32list.list[i]);
                 }
 
                 break;
 
             case LAI_ATTR_VALUE_TYPE_INT32:
-                name += std::to_string(value.s32); // if enum then get enum name?
+                key.push_back(1);
+                key.push_back((uint64_t)(int64_t)value.s32); // if enum then get enum name?
                 break;
 
             case LAI_ATTR_VALUE_TYPE_UINT32:
-                name += std::to_string(value.u32);
+                key.push_back(1);
+                key.push_back(value.u32);
                 break;
 
             case LAI_ATTR_VALUE_TYPE_UINT8:
-                name += std::to_string(value.u8);
+                key.push_back(1);
+                key.push_back(value.u8);
                 break;
 
             case LAI_ATTR_VALUE_TYPE_UINT16:
-                name += std::to_string(value.u16);
+                key.push_back(1);
+                key.push_back(value.u16);
                 break;
 
             case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                name += lai_serialize_object_id(value.oid);
+                key.push_back(1);
+                key.push_back(value.oid);
                 break;
 
             default:
@@ -129,33 +144,104 @@ std::string AttrKeyMap::constructKey(
                 SWSS_LOG_THROW("FATAL: attribute %s marked as key, but have invalid serialization type, FIXME",
                         md->attridname);
         }
-
-        keys[md->attrid] = name;
     }
 
-    std::string key;
+    AttrKey key;
 
     for (auto& k: keys)
     {
-        key += k.second + ";";
+        key.insert(key.end(), k.second.begin(), k.second.end());
     }
 
-    SWSS_LOG_DEBUG("constructed key: %s", key.c_str());
+    return key;
+}
+
+std::string AttrKeyMap::serializeKey(
+        _In_ const AttrKey& attrKey)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = MetadataIndex::getInstance();
+
+    std::string key;
+
+    size_t idx = 0;
+
+    while (idx + 1 < attrKey.size())
+    {
+        auto md = index.getAttrMetadataByHandle((uint32_t)attrKey[idx]);
+
+        size_t count = (size_t)attrKey[idx + 1];
+
+        idx += 2;
+
+        if (md == nullptr || idx + count > attrKey.size())
+        {
+            key += "INVALID;";
+            break;
+        }
+
+        key += md->attridname;
+        key += ":";
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint64_t value = attrKey[idx + i];
+
+            switch (md->attrvaluetype)
+            {
+                case LAI_ATTR_VALUE_TYPE_INT32:
+                    key += std::to_string((int32_t)value);
+                    break;
+
+                case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                    key += lai_serialize_object_id(value);
+                    break;
+
+                default:
+                    key += std::to_string(value);
+                    break;
+            }
+
+            if (i != count - 1)
+            {
+                key += ",";
+            }
+        }
+
+        key += ";";
+
+        idx += count;
+    }
 
     return key;
 }
 
-std::vector<std::string> AttrKeyMap::getAllKeys() const
+std::size_t AttrKeyMap::AttrKeyHasher::operator()(
+        _In_ const AttrKey& attrKey) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    uint64_t hash = attrKey.size();
+
+    for (auto value: attrKey)
+    {
+        hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+
+    return (std::size_t)hash;
+}
+
+std::vector<lai_object_meta_key_t> AttrKeyMap::getAllKeys() const
 {
     SWSS_LOG_ENTER();
 
-    std::vector<std::string> vec;
+    std::vector<lai_object_meta_key_t> vec;
 
     for (auto& it: m_map)
     {
-        vec.push_back(it.first);
+        vec.push_back(it.second.m_metaKey);
     }
 
     return vec;
 }
-
@@ -12,6 +12,17 @@ namespace laimeta
 {
     class AttrKeyMap
     {
+        public:
+
+            /**
+             * @brief Attribute key.
+             *
+             * For each attribute marked as key, ordered by attribute id:
+             * interned attribute name handle, values count and values.
+             * Comparing and hashing keys are integer operations.
+             */
+            typedef std::vector<uint64_t> AttrKey;
+
         public:
 
             AttrKeyMap() = default;
@@ -23,39 +34,66 @@ namespace laimeta
             void clear();
 
             bool attrKeyExists(
-                    _In_ const std::string& attrKey) const;
+                    _In_ const AttrKey& attrKey) const;
 
             void insert(
-                    _In_ const std::string& metaKey,
-                    _In_ const std::string& attrKey);
+                    _In_ const lai_object_meta_key_t& metaKey,
+                    _In_ const AttrKey& attrKey);
 
             void eraseMetaKey(
-                    _In_ const std::string& metaKey);
+                    _In_ const lai_object_meta_key_t& metaKey);
 
             /**
              * @brief Construct key based on attributes marked as keys.
              */
-            static std::string constructKey(
+            static AttrKey constructKey(
                     _In_ const lai_object_meta_key_t& metaKey,
                     _In_ uint32_t attrCount,
                     _In_ const lai_attribute_t* attrList);
 
-            std::vector<std::string> getAllKeys() const;
+            /**
+             * @brief Serialize key to string for logging.
+             */
+            static std::string serializeKey(
+                    _In_ const AttrKey& attrKey);
+
+            std::vector<lai_object_meta_key_t> getAllKeys() const;
+
+        private:
+
+            struct AttrKeyHasher
+            {
+                std::size_t operator()(
+                        _In_ const AttrKey& attrKey) const;
+            };
+
+            typedef struct _Entry
+            {
+                lai_object_meta_key_t m_metaKey;
+
+                AttrKey m_attrKey;
+
+            } Entry;
 
         private:
 
             /**
              * @brief map holding attribute keys.
              *
-             * Key is serialized meta key.
+             * Key is object id from meta key.
              *
-             * Value is constructed key from attributes.
+             * Value is meta key and constructed key from attributes.
              *
              * Map must contain meta Key and attr Key, since when we are removing
              * object, we only have meta Key, and we can't construct attr Key (we
              * could since we have local db, but this way is safer).
              */
-            std::unordered_map<std::string, std::string> m_map;
+            std::unordered_map<lai_object_id_t, Entry> m_map;
+
+            /**
+             * @brief Number of objects using given attribute key.
+             */
+            std::unordered_map<AttrKey, uint32_t, AttrKeyHasher> m_attrKeys;
     };
 
 }
@@ -37,7 +37,7 @@ lai_status_t  DummyLaiInterface::uninitialize(void)
     return LAI_STATUS_SUCCESS;
 }
 
-lai_status_t  DummyLaiInterface::linkCheck(void)
+lai_status_t  DummyLaiInterface::linkCheck(_Out_ bool *up)
 {
     SWSS_LOG_ENTER();
 
@@ -86,6 +86,65 @@ lai_status_t DummyLaiInterface::get(
     return m_status;
 }
 
+lai_status_t DummyLaiInterface::getStats(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const lai_stat_id_t *counter_ids,
+        _Out_ lai_stat_value_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    return m_status;
+}
+
+lai_status_t DummyLaiInterface::getStatsExt(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const lai_stat_id_t *counter_ids,
+        _In_ lai_stats_mode_t mode,
+        _Out_ lai_stat_value_t *counters)
+{
+    SWSS_LOG_ENTER();
+
+    return m_status;
+}
+
+lai_status_t DummyLaiInterface::clearStats(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const lai_stat_id_t *counter_ids)
+{
+    SWSS_LOG_ENTER();
+
+    return m_status;
+}
+
+lai_status_t DummyLaiInterface::getAlarms(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ uint32_t number_of_alarms,
+        _In_ const lai_alarm_type_t *alarm_ids,
+        _Out_ lai_alarm_info_t *alarm_info)
+{
+    SWSS_LOG_ENTER();
+
+    return m_status;
+}
+
+lai_status_t DummyLaiInterface::clearAlarms(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ uint32_t number_of_alarms,
+        _In_ const lai_alarm_type_t *alarm_ids)
+{
+    SWSS_LOG_ENTER();
+
+    return m_status;
+}
+
 lai_status_t DummyLaiInterface::objectTypeGetAvailability(
         _In_ lai_object_id_t linecardId,
         _In_ lai_object_type_t objectType,
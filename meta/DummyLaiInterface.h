@@ -59,6 +59,44 @@ namespace laimeta
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list) override;
 
+        public: // stats API
+
+            virtual lai_status_t getStats(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const lai_stat_id_t *counter_ids,
+                    _Out_ lai_stat_value_t *counters) override;
+
+            virtual lai_status_t getStatsExt(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const lai_stat_id_t *counter_ids,
+                    _In_ lai_stats_mode_t mode,
+                    _Out_ lai_stat_value_t *counters) override;
+
+            virtual lai_status_t clearStats(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ uint32_t number_of_counters,
+                    _In_ const lai_stat_id_t *counter_ids) override;
+
+        public: // alarms API
+
+            virtual lai_status_t getAlarms(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ uint32_t number_of_alarms,
+                    _In_ const lai_alarm_type_t *alarm_ids,
+                    _Out_ lai_alarm_info_t *alarm_info) override;
+
+            virtual lai_status_t clearAlarms(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ uint32_t number_of_alarms,
+                    _In_ const lai_alarm_type_t *alarm_ids) override;
+
         public: // SAI API
 
             virtual lai_status_t objectTypeGetAvailability(
@@ -1,6 +1,7 @@
 #include "LaiAttributeList.h"
 
 #include "lai_serialize.h"
+#include "MetadataIndex.h"
 
 using namespace laimeta;
 
@@ -15,30 +16,7 @@ LaiAttributeList::LaiAttributeList(
 
     for (size_t i = 0; i < attr_count; ++i)
     {
-        const std::string &str_attr_id = fvField(values[i]);
-        const std::string &str_attr_value = fvValue(values[i]);
-
-        if (str_attr_id == "NULL")
-        {
-            continue;
-        }
-
-        lai_attribute_t attr;
-        memset(&attr, 0, sizeof(lai_attribute_t));
-
-        lai_deserialize_attr_id(str_attr_id, attr.id);
-
-        auto meta = lai_metadata_get_attr_metadata(objectType, attr.id);
-
-        if (meta == NULL)
-        {
-            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
-        }
-
-        lai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
-
-        m_attr_list.push_back(attr);
-        m_attr_value_type_list.push_back(meta->attrvaluetype);
+        addAttr(objectType, fvField(values[i]), fvValue(values[i]), countOnly);
     }
 }
 
@@ -51,34 +29,60 @@ LaiAttributeList::LaiAttributeList(
 
     for (auto it = hash.begin(); it != hash.end(); it++)
     {
-        const std::string &str_attr_id = it->first;
-        const std::string &str_attr_value = it->second;
+        addAttr(objectType, it->first, it->second, countOnly);
+    }
+}
 
-        if (str_attr_id == "NULL")
-        {
-            continue;
-        }
+LaiAttributeList::~LaiAttributeList()
+{
+    SWSS_LOG_ENTER();
 
-        lai_attribute_t attr;
-        memset(&attr, 0, sizeof(lai_attribute_t));
+    freeAttrs();
+}
 
-        lai_deserialize_attr_id(str_attr_id, attr.id);
+void LaiAttributeList::addAttr(
+        _In_ const lai_object_type_t objectType,
+        _In_ const std::string &str_attr_id,
+        _In_ const std::string &str_attr_value,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    if (str_attr_id == "NULL")
+    {
+        return;
+    }
 
-        auto meta = lai_metadata_get_attr_metadata(objectType, attr.id);
+    lai_attribute_t attr;
+    memset(&attr, 0, sizeof(lai_attribute_t));
 
-        if (meta == NULL)
-        {
-            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
-        }
+    auto& index = MetadataIndex::getInstance();
 
-        lai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
+    // interned name resolves attribute id and metadata in single lookup
+
+    auto meta = index.getAttrMetadata(str_attr_id);
+
+    if (meta == NULL || meta->objecttype != objectType)
+    {
+        lai_deserialize_attr_id(str_attr_id, attr.id);
 
-        m_attr_list.push_back(attr);
-        m_attr_value_type_list.push_back(meta->attrvaluetype);
+        meta = index.getAttrMetadata(objectType, attr.id);
     }
+
+    if (meta == NULL)
+    {
+        SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
+    }
+
+    attr.id = meta->attrid;
+
+    lai_deserialize_attr_value(str_attr_value, *meta, attr, countOnly);
+
+    m_attr_list.push_back(attr);
+    m_attr_value_type_list.push_back(meta->attrvaluetype);
 }
 
-LaiAttributeList::~LaiAttributeList()
+void LaiAttributeList::freeAttrs()
 {
     SWSS_LOG_ENTER();
 
@@ -92,6 +96,26 @@ LaiAttributeList::~LaiAttributeList()
 
         lai_deserialize_free_attribute_value(serialization_type, attr);
     }
+
+    m_attr_list.clear();
+    m_attr_value_type_list.clear();
+}
+
+void LaiAttributeList::reset(
+        _In_ const lai_object_type_t objectType,
+        _In_ const std::vector<swss::FieldValueTuple> &values,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    freeAttrs();
+
+    size_t attr_count = values.size();
+
+    for (size_t i = 0; i < attr_count; ++i)
+    {
+        addAttr(objectType, fvField(values[i]), fvValue(values[i]), countOnly);
+    }
 }
 
 std::vector<swss::FieldValueTuple> LaiAttributeList::serialize_attr_list(
@@ -104,27 +128,41 @@ std::vector<swss::FieldValueTuple> LaiAttributeList::serialize_attr_list(
 
     std::vector<swss::FieldValueTuple> entry;
 
+    serialize_attr_list(objectType, attr_count, attr_list, countOnly, entry);
+
+    return entry;
+}
+
+void LaiAttributeList::serialize_attr_list(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list,
+        _In_ bool countOnly,
+        _Inout_ std::vector<swss::FieldValueTuple>& entry)
+{
+    SWSS_LOG_ENTER();
+
+    entry.resize(attr_count);
+
     for (uint32_t index = 0; index < attr_count; ++index)
     {
         const lai_attribute_t *attr = &attr_list[index];
 
-        auto meta = lai_metadata_get_attr_metadata(objectType, attr->id);
+        auto meta = MetadataIndex::getInstance().getAttrMetadata(objectType, attr->id);
 
         if (meta == NULL)
         {
             SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr->id);
         }
 
-        std::string str_attr_id = lai_serialize_attr_id(*meta);
+        auto& fvt = entry[index];
 
-        std::string str_attr_value = lai_serialize_attr_value(*meta, *attr, countOnly);
+        fvField(fvt).assign(meta->attridname);
 
-        swss::FieldValueTuple fvt(str_attr_id, str_attr_value);
+        fvValue(fvt).clear();
 
-        entry.push_back(fvt);
+        lai_serialize_attr_value_append(fvValue(fvt), *meta, *attr, countOnly);
     }
-
-    return entry;
 }
 
 lai_attribute_t* LaiAttributeList::get_attr_list()
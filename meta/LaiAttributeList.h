@@ -34,17 +34,50 @@ namespace laimeta
 
             uint32_t get_attr_count();
 
+            /**
+             * @brief Replace attributes with deserialized values.
+             *
+             * Previous attribute values are released, but list storage is
+             * kept, so the same object can be reused for many messages.
+             */
+            void reset(
+                    _In_ const lai_object_type_t object_type,
+                    _In_ const std::vector<swss::FieldValueTuple> &values,
+                    _In_ bool countOnly);
+
             static std::vector<swss::FieldValueTuple> serialize_attr_list(
                     _In_ lai_object_type_t object_type,
                     _In_ uint32_t attr_count,
                     _In_ const lai_attribute_t *attr_list,
                     _In_ bool countOnly);
 
+            /**
+             * @brief Serialize attributes into caller entry.
+             *
+             * Entry is resized to attr_count and existing field and value
+             * strings are overwritten in place, so when the same entry is
+             * passed on every call their buffers are reused.
+             */
+            static void serialize_attr_list(
+                    _In_ lai_object_type_t object_type,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list,
+                    _In_ bool countOnly,
+                    _Inout_ std::vector<swss::FieldValueTuple>& entry);
+
         private:
 
             LaiAttributeList(const LaiAttributeList&);
             LaiAttributeList& operator=(const LaiAttributeList&);
 
+            void addAttr(
+                    _In_ const lai_object_type_t object_type,
+                    _In_ const std::string &str_attr_id,
+                    _In_ const std::string &str_attr_value,
+                    _In_ bool countOnly);
+
+            void freeAttrs();
+
             std::vector<lai_attribute_t> m_attr_list;
             std::vector<lai_attr_value_type_t> m_attr_value_type_list;
     };
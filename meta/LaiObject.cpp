@@ -27,7 +27,9 @@ bool LaiObject::hasAttr(
 {
     SWSS_LOG_ENTER();
 
-    return m_attrs.find(id) != m_attrs.end();
+    auto attr = m_attrs.find(id);
+
+    return attr && *attr;
 }
 
 const lai_object_meta_key_t& LaiObject::getMetaKey() const
@@ -59,10 +61,10 @@ std::shared_ptr<LaiAttrWrapper> LaiObject::getAttr(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_attrs.find(id);
+    auto attr = m_attrs.find(id);
 
-    if (it != m_attrs.end())
-        return it->second;
+    if (attr)
+        return *attr;
 
     return nullptr;
 }
@@ -73,9 +75,10 @@ std::vector<std::shared_ptr<LaiAttrWrapper>> LaiObject::getAttributes() const
 
     std::vector<std::shared_ptr<LaiAttrWrapper>> values;
 
-    for (auto&kvp: m_attrs)
-        values.push_back(kvp.second);
+    m_attrs.forEach([&](const std::shared_ptr<LaiAttrWrapper>& attr) {
+            if (attr)
+                values.push_back(attr);
+            });
 
     return values;
 }
-
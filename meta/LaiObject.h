@@ -1,9 +1,9 @@
 #pragma once
 
 #include "LaiAttrWrapper.h"
+#include "AttrIdMap.h"
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 
 namespace laimeta
@@ -47,6 +47,6 @@ namespace laimeta
 
             lai_object_meta_key_t m_metaKey;
 
-            std::unordered_map<lai_attr_id_t, std::shared_ptr<LaiAttrWrapper>> m_attrs;
+            AttrIdMap<std::shared_ptr<LaiAttrWrapper>> m_attrs;
     };
 }
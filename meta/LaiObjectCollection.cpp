@@ -1,4 +1,5 @@
 #include "LaiObjectCollection.h"
+#include "MetadataIndex.h"
 
 #include "lai_serialize.h"
 
@@ -8,7 +9,39 @@ void LaiObjectCollection::clear()
 {
     SWSS_LOG_ENTER();
 
-    m_objects.clear();
+    m_slots.clear();
+    m_freeSlots.clear();
+    m_oidToSlot.clear();
+    m_objectTypeSlots.clear();
+    m_linecardSlots.clear();
+}
+
+const LaiObjectCollection::Slot* LaiObjectCollection::findSlot(
+        _In_ const lai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!MetadataIndex::getInstance().isObjectIdType(metaKey.objecttype))
+    {
+        SWSS_LOG_THROW("not handled: %s",
+                lai_serialize_object_meta_key(metaKey).c_str());
+    }
+
+    auto it = m_oidToSlot.find(metaKey.objectkey.key.object_id);
+
+    if (it == m_oidToSlot.end())
+    {
+        return nullptr;
+    }
+
+    auto& slot = m_slots[it->second];
+
+    if (slot.m_object->getObjectType() != metaKey.objecttype)
+    {
+        return nullptr;
+    }
+
+    return &slot;
 }
 
 bool LaiObjectCollection::objectExists(
@@ -16,13 +49,14 @@ bool LaiObjectCollection::objectExists(
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_objects.find(metaKey) != m_objects.end();
+    bool exists = findSlot(metaKey) != nullptr;
 
     return exists;
 }
 
 void LaiObjectCollection::createObject(
-        _In_ const lai_object_meta_key_t& metaKey)
+        _In_ const lai_object_meta_key_t& metaKey,
+        _In_ lai_object_id_t linecardId)
 {
     SWSS_LOG_ENTER();
 
@@ -34,7 +68,88 @@ void LaiObjectCollection::createObject(
                 lai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey] = obj;
+    lai_object_id_t oid = metaKey.objectkey.key.object_id;
+
+    if (m_oidToSlot.find(oid) != m_oidToSlot.end())
+    {
+        SWSS_LOG_THROW("FATAL: oid %s already exists with different object type than %s",
+                lai_serialize_object_id(oid).c_str(),
+                lai_serialize_object_meta_key(metaKey).c_str());
+    }
+
+    size_t slotIndex;
+
+    if (m_freeSlots.empty())
+    {
+        slotIndex = m_slots.size();
+
+        m_slots.emplace_back();
+    }
+    else
+    {
+        slotIndex = m_freeSlots.back();
+
+        m_freeSlots.pop_back();
+    }
+
+    size_t ot = (size_t)metaKey.objecttype;
+
+    if (ot >= m_objectTypeSlots.size())
+    {
+        m_objectTypeSlots.resize(ot + 1);
+    }
+
+    auto& linecardSlots = m_linecardSlots[linecardId];
+
+    auto& slot = m_slots[slotIndex];
+
+    slot.m_object = obj;
+    slot.m_linecardId = linecardId;
+    slot.m_objectTypePos = m_objectTypeSlots[ot].size();
+    slot.m_linecardPos = linecardSlots.size();
+
+    m_objectTypeSlots[ot].push_back(slotIndex);
+
+    linecardSlots.push_back(slotIndex);
+
+    m_oidToSlot[oid] = slotIndex;
+}
+
+void LaiObjectCollection::removeFromIndex(
+        _Inout_ std::vector<size_t>& index,
+        _In_ size_t pos,
+        _Inout_ std::vector<Slot>& slots,
+        _In_ size_t Slot::*member)
+{
+    SWSS_LOG_ENTER();
+
+    // swap with last entry, so removal don't need to shift index
+
+    size_t last = index.back();
+
+    index[pos] = last;
+
+    slots[last].*member = pos;
+
+    index.pop_back();
+}
+
+void LaiObjectCollection::releaseSlot(
+        _In_ size_t slotIndex)
+{
+    SWSS_LOG_ENTER();
+
+    auto& slot = m_slots[slotIndex];
+
+    auto& metaKey = slot.m_object->getMetaKey();
+
+    removeFromIndex(m_objectTypeSlots[metaKey.objecttype], slot.m_objectTypePos, m_slots, &Slot::m_objectTypePos);
+
+    m_oidToSlot.erase(metaKey.objectkey.key.object_id);
+
+    slot.m_object = nullptr;
+
+    m_freeSlots.push_back(slotIndex);
 }
 
 void LaiObjectCollection::removeObject(
@@ -42,13 +157,46 @@ void LaiObjectCollection::removeObject(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto slot = findSlot(metaKey);
+
+    if (slot == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 lai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects.erase(metaKey);
+    size_t slotIndex = m_oidToSlot.at(metaKey.objectkey.key.object_id);
+
+    auto it = m_linecardSlots.find(slot->m_linecardId);
+
+    removeFromIndex(it->second, slot->m_linecardPos, m_slots, &Slot::m_linecardPos);
+
+    if (it->second.empty())
+    {
+        m_linecardSlots.erase(it);
+    }
+
+    releaseSlot(slotIndex);
+}
+
+void LaiObjectCollection::removeObjectsByLinecard(
+        _In_ lai_object_id_t linecardId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_linecardSlots.find(linecardId);
+
+    if (it == m_linecardSlots.end())
+    {
+        return;
+    }
+
+    for (auto slotIndex: it->second)
+    {
+        releaseSlot(slotIndex);
+    }
+
+    m_linecardSlots.erase(it);
 }
 
 void LaiObjectCollection::setObjectAttr(
@@ -58,13 +206,15 @@ void LaiObjectCollection::setObjectAttr(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto slot = findSlot(metaKey);
+
+    if (slot == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                lai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    m_objects[metaKey]->setAttr(&md, attr);
+    slot->m_object->setAttr(&md, attr);
 }
 
 std::shared_ptr<LaiAttrWrapper> LaiObjectCollection::getObjectAttr(
@@ -79,9 +229,9 @@ std::shared_ptr<LaiAttrWrapper> LaiObjectCollection::getObjectAttr(
      * should make exists check before.
      */
 
-    auto it = m_objects.find(metaKey);
+    auto slot = findSlot(metaKey);
 
-    if (it == m_objects.end())
+    if (slot == nullptr)
     {
         SWSS_LOG_ERROR("object key %s not found",
                 lai_serialize_object_meta_key(metaKey).c_str());
@@ -89,7 +239,7 @@ std::shared_ptr<LaiAttrWrapper> LaiObjectCollection::getObjectAttr(
         return nullptr;
     }
 
-    return it->second->getAttr(id);
+    return slot->m_object->getAttr(id);
 }
 
 std::vector<std::shared_ptr<LaiObject>> LaiObjectCollection::getObjectsByObjectType(
@@ -99,10 +249,18 @@ std::vector<std::shared_ptr<LaiObject>> LaiObjectCollection::getObjectsByObjectT
 
     std::vector<std::shared_ptr<LaiObject>> vec;
 
-    for (auto& kvp: m_objects)
+    if ((size_t)objectType >= m_objectTypeSlots.size())
     {
-        if (kvp.second->getObjectType() == objectType)
-            vec.push_back(kvp.second);
+        return vec;
+    }
+
+    auto& index = m_objectTypeSlots[objectType];
+
+    vec.reserve(index.size());
+
+    for (auto slotIndex: index)
+    {
+        vec.push_back(m_slots[slotIndex].m_object);
     }
 
     return vec;
@@ -113,13 +271,15 @@ std::shared_ptr<LaiObject> LaiObjectCollection::getObject(
 {
     SWSS_LOG_ENTER();
 
-    if (!objectExists(metaKey))
+    auto slot = findSlot(metaKey);
+
+    if (slot == nullptr)
     {
         SWSS_LOG_THROW("FATAL: object %s doesn't exist",
                 lai_serialize_object_meta_key(metaKey).c_str());
     }
 
-    return m_objects.at(metaKey);
+    return slot->m_object;
 }
 
 std::vector<lai_object_meta_key_t> LaiObjectCollection::getAllKeys() const
@@ -128,10 +288,34 @@ std::vector<lai_object_meta_key_t> LaiObjectCollection::getAllKeys() const
 
     std::vector<lai_object_meta_key_t> vec;
 
-    for (auto& it: m_objects)
+    vec.reserve(m_oidToSlot.size());
+
+    for (auto& it: m_oidToSlot)
     {
-        vec.push_back(it.first);
+        vec.push_back(m_slots[it.second].m_object->getMetaKey());
     }
 
     return vec;
 }
+
+bool LaiObjectCollection::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_oidToSlot.empty();
+}
+
+std::shared_ptr<LaiObject> LaiObjectCollection::findObject(
+        _In_ lai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_oidToSlot.find(oid);
+
+    if (it == m_oidToSlot.end())
+    {
+        return nullptr;
+    }
+
+    return m_slots[it->second].m_object;
+}
@@ -2,7 +2,6 @@
 
 #include "LaiAttrWrapper.h"
 #include "LaiObject.h"
-#include "MetaKeyHasher.h"
 
 #include <string>
 #include <unordered_map>
@@ -11,6 +10,13 @@
 
 namespace laimeta
 {
+    /**
+     * @brief Collection of objects tracked by metadata.
+     *
+     * All LAI objects are object id based, so objects are stored in slot
+     * vector indexed by OID hash map, with per object type and per linecard
+     * slot indexes. Released slots are reused by next created objects.
+     */
     class LaiObjectCollection
     {
         public:
@@ -31,11 +37,20 @@ namespace laimeta
                     _In_ const lai_object_meta_key_t& metaKey) const;
 
             void createObject(
-                    _In_ const lai_object_meta_key_t& metaKey);
+                    _In_ const lai_object_meta_key_t& metaKey,
+                    _In_ lai_object_id_t linecardId);
 
             void removeObject(
                     _In_ const lai_object_meta_key_t& metaKey);
 
+            /**
+             * @brief Remove all objects created on given linecard.
+             *
+             * Including linecard object itself.
+             */
+            void removeObjectsByLinecard(
+                    _In_ lai_object_id_t linecardId);
+
             void setObjectAttr(
                     _In_ const lai_object_meta_key_t& metaKey,
                     _In_ const lai_attr_metadata_t& md,
@@ -56,8 +71,57 @@ namespace laimeta
 
             std::vector<lai_object_meta_key_t> getAllKeys() const;
 
+            bool empty() const;
+
+            /**
+             * @brief Get object by object id, returns nullptr if object
+             * doesn't exist.
+             */
+            std::shared_ptr<LaiObject> findObject(
+                    _In_ lai_object_id_t oid) const;
+
+        private:
+
+            typedef struct _Slot
+            {
+                std::shared_ptr<LaiObject> m_object;
+
+                lai_object_id_t m_linecardId;
+
+                /**
+                 * @brief Position of this slot in object type index.
+                 */
+                size_t m_objectTypePos;
+
+                /**
+                 * @brief Position of this slot in linecard index.
+                 */
+                size_t m_linecardPos;
+
+            } Slot;
+
+            const Slot* findSlot(
+                    _In_ const lai_object_meta_key_t& metaKey) const;
+
+            void releaseSlot(
+                    _In_ size_t slotIndex);
+
+            static void removeFromIndex(
+                    _Inout_ std::vector<size_t>& index,
+                    _In_ size_t pos,
+                    _Inout_ std::vector<Slot>& slots,
+                    _In_ size_t Slot::*member);
+
         private:
 
-            std::unordered_map<lai_object_meta_key_t, std::shared_ptr<LaiObject>, MetaKeyHasher, MetaKeyHasher> m_objects;
+            std::vector<Slot> m_slots;
+
+            std::vector<size_t> m_freeSlots;
+
+            std::unordered_map<lai_object_id_t, size_t> m_oidToSlot;
+
+            std::vector<std::vector<size_t>> m_objectTypeSlots;
+
+            std::unordered_map<lai_object_id_t, std::vector<size_t>> m_linecardSlots;
     };
 }
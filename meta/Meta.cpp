@@ -9,6 +9,7 @@
 #include <inttypes.h>
 
 #include <set>
+#include <algorithm>
 
 // TODO add validation for all oids belong to the same linecard
 
@@ -37,7 +38,8 @@ using namespace laimeta;
 
 Meta::Meta(
         _In_ std::shared_ptr<lairedis::LaiInterface> impl):
-    m_implementation(impl)
+    m_implementation(impl),
+    m_metadataIndex(MetadataIndex::getInstance())
 {
     SWSS_LOG_ENTER();
 
@@ -47,6 +49,8 @@ Meta::Meta(
     // then warm boot must be per each linecard
 
     m_warmBoot = false;
+
+    m_snapshot = std::make_shared<MetaSnapshot>();
 }
 
 lai_status_t Meta::initialize(
@@ -91,6 +95,8 @@ void Meta::meta_init_db()
     m_attrKeys.clear();
     m_portRelatedSet.clear();
 
+    std::atomic_store(&m_snapshot, std::shared_ptr<const MetaSnapshot>(std::make_shared<MetaSnapshot>()));
+
     // m_meta_unittests_set_readonly_set.clear();
     // m_unittestsEnabled = false
 
@@ -106,7 +112,42 @@ bool Meta::isEmpty()
     return m_portRelatedSet.getAllPorts().empty()
         && m_oids.getAllOids().empty()
         && m_attrKeys.getAllKeys().empty()
-        && m_laiObjectCollection.getAllKeys().empty();
+        && m_laiObjectCollection.empty();
+}
+
+std::shared_ptr<const MetaSnapshot> Meta::getSnapshot() const
+{
+    SWSS_LOG_ENTER();
+
+    return std::atomic_load(&m_snapshot);
+}
+
+void Meta::publishSnapshot(
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    m_changedOids.clear();
+
+    if (objectId != LAI_NULL_OBJECT_ID)
+    {
+        m_changedOids.push_back(objectId);
+    }
+
+    m_oids.takeChangedOids(m_changedOids);
+
+    if (m_changedOids.empty())
+    {
+        return;
+    }
+
+    std::sort(m_changedOids.begin(), m_changedOids.end());
+
+    m_changedOids.erase(std::unique(m_changedOids.begin(), m_changedOids.end()), m_changedOids.end());
+
+    auto snapshot = m_snapshot->update(m_changedOids, m_laiObjectCollection, m_oids);
+
+    std::atomic_store(&m_snapshot, snapshot);
 }
 
 lai_status_t Meta::remove(
@@ -145,6 +186,8 @@ lai_status_t Meta::remove(
     if (status == LAI_STATUS_SUCCESS)
     {
         meta_generic_validation_post_remove(meta_key);
+
+        publishSnapshot(meta_key.objectkey.key.object_id);
     }
 
     return status;
@@ -202,6 +245,8 @@ lai_status_t Meta::create(
         }
 
         meta_generic_validation_post_create(meta_key, linecard_id, attr_count, attr_list);
+
+        publishSnapshot(meta_key.objectkey.key.object_id);
     }
 
     return status;
@@ -244,6 +289,8 @@ lai_status_t Meta::set(
     if (status == LAI_STATUS_SUCCESS)
     {
         meta_generic_validation_post_set(meta_key, attr);
+
+        publishSnapshot(meta_key.objectkey.key.object_id);
     }
 
     return status;
@@ -285,11 +332,128 @@ lai_status_t Meta::get(
         }
 
         meta_generic_validation_post_get(meta_key, linecard_id, attr_count, attr_list);
+
+        publishSnapshot(LAI_NULL_OBJECT_ID); // get may snoop new objects
     }
 
     return status;
 }
 
+lai_status_t Meta::bulkGet(
+        _In_ lai_object_type_t object_type,
+        _In_ uint32_t object_count,
+        _In_ const lai_object_id_t *object_id,
+        _In_ const uint32_t *attr_count,
+        _Inout_ lai_attribute_t **attr_list,
+        _Out_ lai_status_t *object_statuses)
+{
+    SWSS_LOG_ENTER();
+
+    if (object_count < 1)
+    {
+        SWSS_LOG_ERROR("expected at least 1 object to get");
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    if (object_id == nullptr || attr_count == nullptr || attr_list == nullptr || object_statuses == nullptr)
+    {
+        SWSS_LOG_ERROR("bulk get parameter is NULL");
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    /*
+     * Each object is validated on its own and gets its own status, only
+     * valid objects are passed to implementation.
+     */
+
+    std::vector<uint32_t> valid;
+
+    valid.reserve(object_count);
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        lai_object_id_t oid = object_id[idx];
+
+        lai_status_t status = meta_lai_validate_oid(object_type, &oid, LAI_NULL_OBJECT_ID, false);
+
+        if (status == LAI_STATUS_SUCCESS)
+        {
+            lai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = oid } } };
+
+            status = meta_generic_validation_get(meta_key, attr_count[idx], attr_list[idx]);
+        }
+
+        object_statuses[idx] = status;
+
+        if (status == LAI_STATUS_SUCCESS)
+        {
+            valid.push_back(idx);
+        }
+    }
+
+    if (valid.empty())
+    {
+        return LAI_STATUS_FAILURE;
+    }
+
+    lai_status_t status;
+
+    if (valid.size() == object_count)
+    {
+        status = m_implementation->bulkGet(object_type, object_count, object_id, attr_count, attr_list, object_statuses);
+    }
+    else
+    {
+        uint32_t count = (uint32_t)valid.size();
+
+        std::vector<lai_object_id_t> ids(count);
+        std::vector<uint32_t> counts(count);
+        std::vector<lai_attribute_t*> lists(count);
+        std::vector<lai_status_t> statuses(count, LAI_STATUS_FAILURE);
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            ids[idx] = object_id[valid[idx]];
+            counts[idx] = attr_count[valid[idx]];
+            lists[idx] = attr_list[valid[idx]];
+        }
+
+        m_implementation->bulkGet(object_type, count, ids.data(), counts.data(), lists.data(), statuses.data());
+
+        for (uint32_t idx = 0; idx < count; idx++)
+        {
+            object_statuses[valid[idx]] = statuses[idx];
+        }
+
+        status = LAI_STATUS_FAILURE;
+    }
+
+    for (uint32_t idx = 0; idx < object_count; idx++)
+    {
+        if (object_statuses[idx] != LAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        lai_object_meta_key_t meta_key = { .objecttype = object_type, .objectkey = { .key = { .object_id  = object_id[idx] } } };
+
+        lai_object_id_t linecard_id = linecardIdQuery(object_id[idx]);
+
+        if (!m_oids.objectReferenceExists(linecard_id))
+        {
+            SWSS_LOG_ERROR("linecard id 0x%" PRIx64 " doesn't exist", linecard_id);
+        }
+
+        meta_generic_validation_post_get(meta_key, linecard_id, attr_count[idx], attr_list[idx]);
+    }
+
+    publishSnapshot(LAI_NULL_OBJECT_ID); // get may snoop new objects
+
+    return status;
+}
+
 #define PARAMETER_CHECK_IF_NOT_NULL(param) {                                                \
     if ((param) == nullptr) {                                                               \
         SWSS_LOG_ERROR("parameter " # param " is NULL");                                    \
@@ -336,7 +500,7 @@ lai_status_t Meta::objectTypeGetAvailability(
     PARAMETER_CHECK_IF_NOT_NULL(attrList);
     PARAMETER_CHECK_IF_NOT_NULL(count);
 
-    auto info = lai_metadata_get_object_type_info(objectType);
+    auto info = m_metadataIndex.getObjectTypeInfo(objectType);
 
     PARAMETER_CHECK_IF_NOT_NULL(info);
 
@@ -346,7 +510,7 @@ lai_status_t Meta::objectTypeGetAvailability(
     {
         auto id = attrList[idx].id;
 
-        auto mdp = lai_metadata_get_attr_metadata(objectType, id);
+        auto mdp = m_metadataIndex.getAttrMetadata(objectType, id);
 
         if (mdp == nullptr)
         {
@@ -414,7 +578,7 @@ lai_status_t Meta::queryAttributeCapability(
     PARAMETER_CHECK_OID_EXISTS(linecardId, LAI_OBJECT_TYPE_LINECARD);
     PARAMETER_CHECK_OBJECT_TYPE_VALID(objectType);
 
-    auto mdp = lai_metadata_get_attr_metadata(objectType, attrId);
+    auto mdp = m_metadataIndex.getAttrMetadata(objectType, attrId);
 
     if (!mdp)
     {
@@ -444,7 +608,7 @@ lai_status_t Meta::queryAattributeEnumValuesCapability(
     PARAMETER_CHECK_OID_EXISTS(linecardId, LAI_OBJECT_TYPE_LINECARD);
     PARAMETER_CHECK_OBJECT_TYPE_VALID(objectType);
 
-    auto mdp = lai_metadata_get_attr_metadata(objectType, attrId);
+    auto mdp = m_metadataIndex.getAttrMetadata(objectType, attrId);
 
     if (!mdp)
     {
@@ -528,7 +692,7 @@ lai_status_t Meta::meta_validate_stats(
 
     CHECK_STATUS_SUCCESS(status);
 
-    auto info = lai_metadata_get_object_type_info(object_type);
+    auto info = m_metadataIndex.getObjectTypeInfo(object_type);
 
     PARAMETER_CHECK_IF_NOT_NULL(info);
 
@@ -647,7 +811,7 @@ lai_status_t Meta::meta_validate_alarms(
 
     CHECK_STATUS_SUCCESS(status);
 
-    auto info = lai_metadata_get_object_type_info(object_type);
+    auto info = m_metadataIndex.getObjectTypeInfo(object_type);
 
     PARAMETER_CHECK_IF_NOT_NULL(info);
 
@@ -775,30 +939,20 @@ void Meta::clean_after_linecard_remove(
 
     // clear attr keys
 
-    for (auto& key: m_attrKeys.getAllKeys())
+    for (auto& mk: m_attrKeys.getAllKeys())
     {
-        lai_object_meta_key_t mk;
-        lai_deserialize_object_meta_key(key, mk);
-
         // we guarantee that linecard_id is first in the key structure so we can
         // use that as object_id as well
 
         if (linecardIdQuery(mk.objectkey.key.object_id) == linecardId)
         {
-            m_attrKeys.eraseMetaKey(key);
+            m_attrKeys.eraseMetaKey(mk);
         }
     }
 
-    for (auto& mk: m_laiObjectCollection.getAllKeys())
-    {
-        // we guarantee that linecard_id is first in the key structure so we can
-        // use that as object_id as well
+    // objects are indexed by linecard on create
 
-        if (linecardIdQuery(mk.objectkey.key.object_id) == linecardId)
-        {
-            m_laiObjectCollection.removeObject(mk);
-        }
-    }
+    m_laiObjectCollection.removeObjectsByLinecard(linecardId);
 
     SWSS_LOG_NOTICE("removed all objects related to linecard %s",
             lai_serialize_object_id(linecardId).c_str());
@@ -817,7 +971,7 @@ lai_status_t Meta::meta_generic_validation_remove(
         return LAI_STATUS_INVALID_PARAMETER;
     }
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -1034,7 +1188,7 @@ lai_status_t Meta::meta_lai_validate_oid(
 
     const char* otname =  lai_metadata_get_enum_value_name(&lai_metadata_enum_lai_object_type_t, object_type);
 
-    auto info = lai_metadata_get_object_type_info(object_type);
+    auto info = m_metadataIndex.getObjectTypeInfo(object_type);
 
     if (info->isnonobjectid)
     {
@@ -1116,13 +1270,15 @@ void Meta::meta_generic_validation_post_remove(
 
     // get all attributes that was set
 
+    std::vector<lai_attribute_t> attrs;
+
     for (auto&it: m_laiObjectCollection.getObject(meta_key)->getAttributes())
     {
         const lai_attribute_t* attr = it->getLaiAttr();
 
-        auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
+        attrs.push_back(*attr); // shallow copy, only used for reference counting
 
-        const lai_attribute_value_t& value = attr->value;
+        auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
         const lai_attr_metadata_t& md = *mdp;
 
@@ -1146,11 +1302,8 @@ void Meta::meta_generic_validation_post_remove(
                 break;
 
             case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                m_oids.objectReferenceDecrement(value.oid);
-                break;
-
             case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                m_oids.objectReferenceDecrement(value.objlist);
+                // decreased in batch below
                 break;
 
             case LAI_ATTR_VALUE_TYPE_UINT8_LIST:
@@ -1169,10 +1322,12 @@ void Meta::meta_generic_validation_post_remove(
         }
     }
 
+    m_oids.objectReferenceDecrement(meta_key.objecttype, (uint32_t)attrs.size(), attrs.data());
+
     // we don't keep track of fdb, neighbor, route since
     // those are safe to remove any time (leafs)
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -1200,9 +1355,7 @@ void Meta::meta_generic_validation_post_remove(
 
     m_laiObjectCollection.removeObject(meta_key);
 
-    std::string metaKey = lai_serialize_object_meta_key(meta_key);
-
-    m_attrKeys.eraseMetaKey(metaKey);
+    m_attrKeys.eraseMetaKey(meta_key);
 
 }
 
@@ -1243,7 +1396,7 @@ lai_status_t Meta::meta_generic_validation_create(
 
         for (uint32_t i = 0; i < attr_count; ++i)
         {
-            auto meta = lai_metadata_get_attr_metadata(LAI_OBJECT_TYPE_LINECARD, attr_list[i].id);
+            auto meta = m_metadataIndex.getAttrMetadata(LAI_OBJECT_TYPE_LINECARD, attr_list[i].id);
 
             if (meta == NULL)
             {
@@ -1325,7 +1478,7 @@ lai_status_t Meta::meta_generic_validation_create(
     {
         const lai_attribute_t* attr = &attr_list[idx];
 
-        auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
+        auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
         if (mdp == NULL)
         {
@@ -1496,7 +1649,7 @@ lai_status_t Meta::meta_generic_validation_create(
 
     // we are creating object, no need for check if exists (only key values needs to be checked)
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -1579,7 +1732,7 @@ lai_status_t Meta::meta_generic_validation_create(
             const auto& c = *md.conditions[index];
 
             // conditions may only be on the same object type
-            const auto& cmd = *lai_metadata_get_attr_metadata(meta_key.objecttype, c.attrid);
+            const auto& cmd = *m_metadataIndex.getAttrMetadata(meta_key.objecttype, c.attrid);
 
             const lai_attribute_value_t* cvalue = cmd.defaultvalue;
 
@@ -1644,12 +1797,12 @@ lai_status_t Meta::meta_generic_validation_create(
 
     if (haskeys)
     {
-        std::string key = AttrKeyMap::constructKey(meta_key, attr_count, attr_list);
+        auto key = AttrKeyMap::constructKey(meta_key, attr_count, attr_list);
 
         // since we didn't created oid yet, we don't know if attribute key exists, check all
         if (m_attrKeys.attrKeyExists(key))
         {
-            SWSS_LOG_ERROR("attribute key %s already exists, can't create", key.c_str());
+            SWSS_LOG_ERROR("attribute key %s already exists, can't create", AttrKeyMap::serializeKey(key).c_str());
 
             return LAI_STATUS_INVALID_PARAMETER;
         }
@@ -1671,7 +1824,7 @@ lai_status_t Meta::meta_generic_validation_set(
         return LAI_STATUS_INVALID_PARAMETER;
     }
 
-    auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
+    auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
     if (mdp == NULL)
     {
@@ -1716,7 +1869,7 @@ lai_status_t Meta::meta_generic_validation_set(
 
     lai_object_id_t linecard_id = LAI_NULL_OBJECT_ID;
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (!info->isnonobjectid)
     {
@@ -1979,7 +2132,7 @@ lai_status_t Meta::meta_generic_validation_get(
     {
         const lai_attribute_t* attr = &attr_list[i];
 
-        auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
+        auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
         if (mdp == NULL)
         {
@@ -2117,7 +2270,7 @@ lai_status_t Meta::meta_generic_validation_get(
         return LAI_STATUS_INVALID_PARAMETER;
     }
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -2175,7 +2328,7 @@ void Meta::meta_generic_validation_post_get(
     {
         const lai_attribute_t* attr = &attr_list[idx];
 
-        auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
+        auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
         const lai_attribute_value_t& value = attr->value;
 
@@ -2453,7 +2606,7 @@ lai_status_t Meta::meta_generic_validate_non_object_on_create(
      * check in object hash whether this object exists.
      */
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (!info->isnonobjectid)
     {
@@ -2549,7 +2702,7 @@ lai_object_id_t Meta::meta_extract_linecard_id(
      * We assume here that objecttype in meta key is in valid range.
      */
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -2607,7 +2760,7 @@ std::vector<const lai_attr_metadata_t*> Meta::get_attributes_metadata(
 
     SWSS_LOG_DEBUG("objecttype: %s", lai_serialize_object_type(objecttype).c_str());
 
-    auto meta = lai_metadata_get_object_type_info(objecttype)->attrmetadata;
+    auto meta = m_metadataIndex.getObjectTypeInfo(objecttype)->attrmetadata;
 
     std::vector<const lai_attr_metadata_t*> attrs;
 
@@ -2733,7 +2886,7 @@ void Meta::meta_generic_validation_post_get_objlist(
 
             if (!m_laiObjectCollection.objectExists(key))
             {
-                m_laiObjectCollection.createObject(key);
+                m_laiObjectCollection.createObject(key, linecardIdQuery(oid));
             }
         }
 
@@ -2780,10 +2933,10 @@ void Meta::meta_generic_validation_post_create(
     }
     else
     {
-        m_laiObjectCollection.createObject(meta_key);
+        m_laiObjectCollection.createObject(meta_key, linecard_id);
     }
 
-    auto info = lai_metadata_get_object_type_info(meta_key.objecttype);
+    auto info = m_metadataIndex.getObjectTypeInfo(meta_key.objecttype);
 
     if (info->isnonobjectid)
     {
@@ -2885,9 +3038,7 @@ void Meta::meta_generic_validation_post_create(
     {
         const lai_attribute_t* attr = &attr_list[idx];
 
-        auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
-
-        const lai_attribute_value_t& value = attr->value;
+        auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
         const lai_attr_metadata_t& md = *mdp;
 
@@ -2917,11 +3068,8 @@ void Meta::meta_generic_validation_post_create(
                 break;
 
             case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-                m_oids.objectReferenceIncrement(value.oid);
-                break;
-
             case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-                m_oids.objectReferenceIncrement(value.objlist);
+                // increased in batch below
                 break;
 
             case LAI_ATTR_VALUE_TYPE_UINT8_LIST:
@@ -2943,13 +3091,13 @@ void Meta::meta_generic_validation_post_create(
         m_laiObjectCollection.setObjectAttr(meta_key, md, attr);
     }
 
+    m_oids.objectReferenceIncrement(meta_key.objecttype, attr_count, attr_list);
+
     if (haskeys)
     {
-        auto mKey = lai_serialize_object_meta_key(meta_key);
-
         auto attrKey = AttrKeyMap::constructKey(meta_key, attr_count, attr_list);
 
-        m_attrKeys.insert(mKey, attrKey);
+        m_attrKeys.insert(meta_key, attrKey);
     }
 }
 
@@ -2959,9 +3107,7 @@ void Meta::meta_generic_validation_post_set(
 {
     SWSS_LOG_ENTER();
 
-    auto mdp = lai_metadata_get_attr_metadata(meta_key.objecttype, attr->id);
-
-    const lai_attribute_value_t& value = attr->value;
+    auto mdp = m_metadataIndex.getAttrMetadata(meta_key.objecttype, attr->id);
 
     const lai_attr_metadata_t& md = *mdp;
 
@@ -3011,10 +3157,10 @@ void Meta::meta_generic_validation_post_set(
                 if (prev != NULL)
                 {
                     // decrease previous if it was set
-                    m_oids.objectReferenceDecrement(prev->getLaiAttr()->value.oid);
+                    m_oids.objectReferenceDecrement(meta_key.objecttype, 1, prev->getLaiAttr());
                 }
 
-                m_oids.objectReferenceIncrement(value.oid);
+                m_oids.objectReferenceIncrement(meta_key.objecttype, 1, attr);
 
                 break;
             }
@@ -3027,10 +3173,10 @@ void Meta::meta_generic_validation_post_set(
                 if (prev != NULL)
                 {
                     // decrease previous if it was set
-                    m_oids.objectReferenceDecrement(prev->getLaiAttr()->value.objlist);
+                    m_oids.objectReferenceDecrement(meta_key.objecttype, 1, prev->getLaiAttr());
                 }
 
-                m_oids.objectReferenceIncrement(value.objlist);
+                m_oids.objectReferenceIncrement(meta_key.objecttype, 1, attr);
 
                 break;
             }
@@ -3110,7 +3256,7 @@ lai_status_t Meta::meta_unittests_allow_readonly_set_once(
         return LAI_STATUS_FAILURE;
     }
 
-    auto *md = lai_metadata_get_attr_metadata(object_type, attr_id);
+    auto *md = m_metadataIndex.getAttrMetadata(object_type, attr_id);
 
     if (md == NULL)
     {
@@ -3206,3 +3352,17 @@ bool Meta::objectExists(
     return m_laiObjectCollection.objectExists(mk);
 }
 
+std::shared_ptr<LaiAttrWrapper> Meta::getObjectLocalAttr(
+        _In_ const lai_object_meta_key_t& metaKey,
+        _In_ lai_attr_id_t attrId)
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_laiObjectCollection.objectExists(metaKey))
+    {
+        return nullptr;
+    }
+
+    return m_laiObjectCollection.getObjectAttr(metaKey, attrId);
+}
+
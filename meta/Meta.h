@@ -7,6 +7,8 @@
 #include "PortRelatedSet.h"
 #include "AttrKeyMap.h"
 #include "OidRefCounter.h"
+#include "MetadataIndex.h"
+#include "MetaSnapshot.h"
 
 #include "swss/table.h"
 
@@ -62,6 +64,16 @@ namespace laimeta
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list) override;
 
+        public: // bulk QUAD oid
+
+            virtual lai_status_t bulkGet(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t object_count,
+                    _In_ const lai_object_id_t *object_id,
+                    _In_ const uint32_t *attr_count,
+                    _Inout_ lai_attribute_t **attr_list,
+                    _Out_ lai_status_t *object_statuses) override;
+
         public: // stats API
 
             virtual lai_status_t getStats(
@@ -137,6 +149,14 @@ namespace laimeta
 
             bool isEmpty();
 
+            /**
+             * @brief Get latest published snapshot of metadata database.
+             *
+             * Can be called from any thread without API lock, returned
+             * snapshot is immutable.
+             */
+            std::shared_ptr<const MetaSnapshot> getSnapshot() const;
+
         public: // notifications
 
             void meta_lai_on_linecard_state_change(
@@ -258,6 +278,20 @@ namespace laimeta
             bool objectExists(
                     _In_ const lai_object_meta_key_t& mk) const;
 
+        public: // local database
+
+            /**
+             * @brief Get attribute value from local metadata database.
+             *
+             * Value is present only for attributes passed on create or
+             * changed by successful set api.
+             *
+             * @return Attribute or nullptr if object or attribute don't exist.
+             */
+            std::shared_ptr<LaiAttrWrapper> getObjectLocalAttr(
+                    _In_ const lai_object_meta_key_t& metaKey,
+                    _In_ lai_attr_id_t attrId);
+
         private: // port helpers
 
             lai_status_t meta_port_remove_validation(
@@ -352,10 +386,27 @@ namespace laimeta
             void clean_after_linecard_remove(
                     _In_ lai_object_id_t linecardId);
 
+            /**
+             * @brief Publish new snapshot if any object or reference count
+             * changed since last publish.
+             *
+             * Attributes are modified only on object given to API call, all
+             * objects created or removed, also by snooping, are tracked by
+             * reference counter.
+             */
+            void publishSnapshot(
+                    _In_ lai_object_id_t objectId);
+
         private:
 
             std::shared_ptr<lairedis::LaiInterface> m_implementation;
 
+            /**
+             * @brief Cached object type and attribute metadata tables used by
+             * validation instead of metadata linear scans.
+             */
+            const MetadataIndex& m_metadataIndex;
+
         private: // database objects
 
 
@@ -381,6 +432,18 @@ namespace laimeta
 
             AttrKeyMap m_attrKeys;
 
+            /**
+             * @brief Latest published snapshot, accessed only by
+             * std::atomic_load/std::atomic_store.
+             */
+            std::shared_ptr<const MetaSnapshot> m_snapshot;
+
+            /**
+             * @brief Object ids changed by current API call, reused between
+             * calls to avoid allocation.
+             */
+            std::vector<lai_object_id_t> m_changedOids;
+
         private: // unittests
 
             std::set<std::string> m_meta_unittests_set_readonly_set;
@@ -1,5 +1,6 @@
 #include "MetaKeyHasher.h"
 #include "lai_serialize.h"
+#include "MetadataIndex.h"
 
 #include "swss/logger.h"
 
@@ -16,9 +17,9 @@ bool MetaKeyHasher::operator()(
     if (a.objecttype != b.objecttype)
         return false;
 
-    auto meta = lai_metadata_get_object_type_info(a.objecttype);
+    static const MetadataIndex& index = MetadataIndex::getInstance();
 
-    if (meta && meta->isobjectid)
+    if (index.isObjectIdType(a.objecttype))
         return a.objectkey.key.object_id == b.objectkey.key.object_id;
 
     SWSS_LOG_THROW("not implemented: %s",
@@ -34,9 +35,9 @@ std::size_t MetaKeyHasher::operator()(
 {
     // SWSS_LOG_ENTER(); // disabled for performance reasons
 
-    auto meta = lai_metadata_get_object_type_info(k.objecttype);
+    static const MetadataIndex& index = MetadataIndex::getInstance();
 
-    if (meta && meta->isobjectid)
+    if (index.isObjectIdType(k.objecttype))
     {
         // cast is required in case size_t is 4 bytes (arm)
         return (std::size_t)k.objectkey.key.object_id;
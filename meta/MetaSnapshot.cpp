@@ -0,0 +1,398 @@
+#include "MetaSnapshot.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+using namespace laimeta;
+
+MetaSnapshot::MetaSnapshot():
+    m_version(0),
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+uint64_t MetaSnapshot::hash(
+        _In_ lai_object_id_t oid)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    // splitmix64 finalizer, each step is invertible
+
+    uint64_t h = oid;
+
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+
+    return h;
+}
+
+uint32_t MetaSnapshot::slotIndex(
+        _In_ uint32_t bitmap,
+        _In_ uint32_t bit)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return (uint32_t)__builtin_popcount(bitmap & ((1U << bit) - 1));
+}
+
+std::shared_ptr<const MetaSnapshot::Node> MetaSnapshot::merge(
+        _In_ uint32_t shift,
+        _In_ const std::shared_ptr<const Entry>& first,
+        _In_ const std::shared_ptr<const Entry>& second)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t firstBit = (uint32_t)((hash(first->m_oid) >> shift) & NODE_MASK);
+    uint32_t secondBit = (uint32_t)((hash(second->m_oid) >> shift) & NODE_MASK);
+
+    auto node = std::make_shared<Node>();
+
+    if (firstBit == secondBit)
+    {
+        // hashes are unique, so they will differ on some deeper level
+
+        node->m_bitmap = 1U << firstBit;
+        node->m_slots.push_back({ merge(shift + NODE_BITS, first, second), nullptr });
+
+        return node;
+    }
+
+    node->m_bitmap = (1U << firstBit) | (1U << secondBit);
+
+    if (firstBit < secondBit)
+    {
+        node->m_slots.push_back({ nullptr, first });
+        node->m_slots.push_back({ nullptr, second });
+    }
+    else
+    {
+        node->m_slots.push_back({ nullptr, second });
+        node->m_slots.push_back({ nullptr, first });
+    }
+
+    return node;
+}
+
+std::shared_ptr<const MetaSnapshot::Node> MetaSnapshot::assoc(
+        _In_ const std::shared_ptr<const Node>& node,
+        _In_ uint32_t shift,
+        _In_ uint64_t hash,
+        _In_ const std::shared_ptr<const Entry>& entry,
+        _Inout_ size_t& size)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t bit = (uint32_t)((hash >> shift) & NODE_MASK);
+
+    if (!node)
+    {
+        auto leaf = std::make_shared<Node>();
+
+        leaf->m_bitmap = 1U << bit;
+        leaf->m_slots.push_back({ nullptr, entry });
+
+        size++;
+
+        return leaf;
+    }
+
+    uint32_t idx = slotIndex(node->m_bitmap, bit);
+
+    auto copy = std::make_shared<Node>(*node);
+
+    if ((node->m_bitmap & (1U << bit)) == 0)
+    {
+        copy->m_bitmap |= 1U << bit;
+        copy->m_slots.insert(copy->m_slots.begin() + idx, { nullptr, entry });
+
+        size++;
+
+        return copy;
+    }
+
+    auto& slot = copy->m_slots[idx];
+
+    if (slot.m_node)
+    {
+        slot.m_node = assoc(slot.m_node, shift + NODE_BITS, hash, entry, size);
+    }
+    else if (slot.m_entry->m_oid == entry->m_oid)
+    {
+        slot.m_entry = entry;
+    }
+    else
+    {
+        slot.m_node = merge(shift + NODE_BITS, slot.m_entry, entry);
+        slot.m_entry = nullptr;
+
+        size++;
+    }
+
+    return copy;
+}
+
+std::shared_ptr<const MetaSnapshot::Node> MetaSnapshot::dissoc(
+        _In_ const std::shared_ptr<const Node>& node,
+        _In_ uint32_t shift,
+        _In_ uint64_t hash,
+        _In_ lai_object_id_t oid,
+        _Inout_ size_t& size)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t bit = (uint32_t)((hash >> shift) & NODE_MASK);
+
+    if (!node || (node->m_bitmap & (1U << bit)) == 0)
+    {
+        return node;
+    }
+
+    uint32_t idx = slotIndex(node->m_bitmap, bit);
+
+    auto& slot = node->m_slots[idx];
+
+    std::shared_ptr<const Node> child;
+
+    if (slot.m_node)
+    {
+        child = dissoc(slot.m_node, shift + NODE_BITS, hash, oid, size);
+
+        if (child == slot.m_node)
+        {
+            return node;
+        }
+    }
+    else if (slot.m_entry->m_oid != oid)
+    {
+        return node;
+    }
+    else
+    {
+        size--;
+    }
+
+    auto copy = std::make_shared<Node>(*node);
+
+    if (child && child->m_slots.size() == 1 && child->m_slots[0].m_entry)
+    {
+        // single entry left in child, pull it up
+
+        copy->m_slots[idx] = { nullptr, child->m_slots[0].m_entry };
+    }
+    else if (child)
+    {
+        copy->m_slots[idx].m_node = child;
+    }
+    else
+    {
+        copy->m_bitmap &= ~(1U << bit);
+        copy->m_slots.erase(copy->m_slots.begin() + idx);
+    }
+
+    if (copy->m_slots.empty())
+    {
+        return nullptr;
+    }
+
+    return copy;
+}
+
+std::shared_ptr<const MetaSnapshot> MetaSnapshot::update(
+        _In_ const std::vector<lai_object_id_t>& changedOids,
+        _In_ const LaiObjectCollection& objects,
+        _In_ const OidRefCounter& oids) const
+{
+    SWSS_LOG_ENTER();
+
+    auto snapshot = std::make_shared<MetaSnapshot>();
+
+    snapshot->m_version = m_version + 1;
+    snapshot->m_size = m_size;
+    snapshot->m_root = m_root;
+
+    for (auto oid: changedOids)
+    {
+        auto obj = objects.findObject(oid);
+
+        bool hasReference = oids.objectReferenceExists(oid);
+
+        if (!obj && !hasReference)
+        {
+            snapshot->m_root = dissoc(snapshot->m_root, 0, hash(oid), oid, snapshot->m_size);
+            continue;
+        }
+
+        auto entry = std::make_shared<Entry>();
+
+        entry->m_oid = oid;
+
+        if (obj)
+        {
+            auto o = std::make_shared<Object>();
+
+            o->m_metaKey = obj->getMetaKey();
+            o->m_attrs = obj->getAttributes();
+
+            entry->m_object = o;
+        }
+
+        entry->m_hasReference = hasReference;
+        entry->m_referenceCount = hasReference ? oids.getObjectReferenceCount(oid) : 0;
+
+        snapshot->m_root = assoc(snapshot->m_root, 0, hash(oid), entry, snapshot->m_size);
+    }
+
+    return snapshot;
+}
+
+uint64_t MetaSnapshot::getVersion() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_version;
+}
+
+size_t MetaSnapshot::size() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_size;
+}
+
+const MetaSnapshot::Entry* MetaSnapshot::findEntry(
+        _In_ lai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t h = hash(oid);
+
+    const Node* node = m_root.get();
+
+    for (uint32_t shift = 0; node; shift += NODE_BITS)
+    {
+        uint32_t bit = (uint32_t)((h >> shift) & NODE_MASK);
+
+        if ((node->m_bitmap & (1U << bit)) == 0)
+        {
+            return nullptr;
+        }
+
+        auto& slot = node->m_slots[slotIndex(node->m_bitmap, bit)];
+
+        if (slot.m_entry)
+        {
+            return (slot.m_entry->m_oid == oid) ? slot.m_entry.get() : nullptr;
+        }
+
+        node = slot.m_node.get();
+    }
+
+    return nullptr;
+}
+
+bool MetaSnapshot::objectExists(
+        _In_ const lai_object_meta_key_t& metaKey) const
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = findEntry(metaKey.objectkey.key.object_id);
+
+    return entry && entry->m_object && entry->m_object->m_metaKey.objecttype == metaKey.objecttype;
+}
+
+bool MetaSnapshot::objectReferenceExists(
+        _In_ lai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = findEntry(oid);
+
+    return entry && entry->m_hasReference;
+}
+
+int32_t MetaSnapshot::getObjectReferenceCount(
+        _In_ lai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = findEntry(oid);
+
+    if (entry && entry->m_hasReference)
+    {
+        return entry->m_referenceCount;
+    }
+
+    SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference not in snapshot %" PRIu64, oid, m_version);
+}
+
+std::shared_ptr<LaiAttrWrapper> MetaSnapshot::getObjectAttr(
+        _In_ const lai_object_meta_key_t& metaKey,
+        _In_ lai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    if (!objectExists(metaKey))
+    {
+        return nullptr;
+    }
+
+    for (auto& attr: findEntry(metaKey.objectkey.key.object_id)->m_object->m_attrs)
+    {
+        if (attr->getAttrId() == id)
+        {
+            return attr;
+        }
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<const MetaSnapshot::Object> MetaSnapshot::getObject(
+        _In_ lai_object_id_t oid) const
+{
+    SWSS_LOG_ENTER();
+
+    auto entry = findEntry(oid);
+
+    return entry ? entry->m_object : nullptr;
+}
+
+void MetaSnapshot::collect(
+        _In_ const Node& node,
+        _Inout_ std::vector<lai_object_meta_key_t>& keys)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& slot: node.m_slots)
+    {
+        if (slot.m_node)
+        {
+            collect(*slot.m_node, keys);
+        }
+        else if (slot.m_entry->m_object)
+        {
+            keys.push_back(slot.m_entry->m_object->m_metaKey);
+        }
+    }
+}
+
+std::vector<lai_object_meta_key_t> MetaSnapshot::getAllKeys() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<lai_object_meta_key_t> vec;
+
+    if (m_root)
+    {
+        collect(*m_root, vec);
+    }
+
+    return vec;
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "LaiAttrWrapper.h"
+#include "LaiObjectCollection.h"
+#include "OidRefCounter.h"
+
+#include <memory>
+#include <vector>
+
+namespace laimeta
+{
+    /**
+     * @brief Immutable view of metadata database.
+     *
+     * Meta publishes new snapshot after each API call which modified objects
+     * or reference counts, so diagnostics, dumps and read caches can read
+     * consistent state without taking API mutex.
+     *
+     * Entries are kept in persistent hash array mapped trie keyed by object
+     * id. Each entry is immutable, new snapshot creates new entries only for
+     * changed object ids and copies only trie nodes on path to them, all
+     * other nodes and entries are shared with previous snapshot.
+     */
+    class MetaSnapshot
+    {
+        public:
+
+            typedef struct _Object
+            {
+                lai_object_meta_key_t m_metaKey;
+
+                std::vector<std::shared_ptr<LaiAttrWrapper>> m_attrs;
+
+            } Object;
+
+        public:
+
+            MetaSnapshot();
+
+            ~MetaSnapshot() = default;
+
+        private:
+
+            MetaSnapshot(const MetaSnapshot&) = delete;
+            MetaSnapshot& operator=(const MetaSnapshot&) = delete;
+
+        public:
+
+            /**
+             * @brief Create new snapshot with given object ids refreshed
+             * from current state of objects and reference counts.
+             */
+            std::shared_ptr<const MetaSnapshot> update(
+                    _In_ const std::vector<lai_object_id_t>& changedOids,
+                    _In_ const LaiObjectCollection& objects,
+                    _In_ const OidRefCounter& oids) const;
+
+        public:
+
+            uint64_t getVersion() const;
+
+            /**
+             * @brief Get number of object ids in snapshot, objects and
+             * references without objects.
+             */
+            size_t size() const;
+
+            bool objectExists(
+                    _In_ const lai_object_meta_key_t& metaKey) const;
+
+            bool objectReferenceExists(
+                    _In_ lai_object_id_t oid) const;
+
+            /**
+             * @brief Get reference count on given object.
+             *
+             * Throws if object reference don't exists.
+             */
+            int32_t getObjectReferenceCount(
+                    _In_ lai_object_id_t oid) const;
+
+            std::shared_ptr<LaiAttrWrapper> getObjectAttr(
+                    _In_ const lai_object_meta_key_t& metaKey,
+                    _In_ lai_attr_id_t id) const;
+
+            std::shared_ptr<const Object> getObject(
+                    _In_ lai_object_id_t oid) const;
+
+            std::vector<lai_object_meta_key_t> getAllKeys() const;
+
+        private:
+
+            typedef struct _Entry
+            {
+                lai_object_id_t m_oid;
+
+                std::shared_ptr<const Object> m_object;
+
+                bool m_hasReference;
+
+                int32_t m_referenceCount;
+
+            } Entry;
+
+            struct _Node;
+
+            /*
+             * Slot holds either child node or entry, never both.
+             */
+            typedef struct _Slot
+            {
+                std::shared_ptr<const struct _Node> m_node;
+
+                std::shared_ptr<const Entry> m_entry;
+
+            } Slot;
+
+            /*
+             * Slots are stored compressed, only for bits set in bitmap.
+             */
+            typedef struct _Node
+            {
+                uint32_t m_bitmap;
+
+                std::vector<Slot> m_slots;
+
+            } Node;
+
+            static constexpr uint32_t NODE_BITS = 5;
+
+            static constexpr uint32_t NODE_MASK = (1 << NODE_BITS) - 1;
+
+            /**
+             * @brief Bijective hash of object id.
+             *
+             * Object ids differ mostly on object index in lower bits, mixing
+             * spreads them over trie, and since function is bijective two
+             * object ids never have same hash.
+             */
+            static uint64_t hash(
+                    _In_ lai_object_id_t oid);
+
+            static uint32_t slotIndex(
+                    _In_ uint32_t bitmap,
+                    _In_ uint32_t bit);
+
+            static std::shared_ptr<const Node> assoc(
+                    _In_ const std::shared_ptr<const Node>& node,
+                    _In_ uint32_t shift,
+                    _In_ uint64_t hash,
+                    _In_ const std::shared_ptr<const Entry>& entry,
+                    _Inout_ size_t& size);
+
+            static std::shared_ptr<const Node> merge(
+                    _In_ uint32_t shift,
+                    _In_ const std::shared_ptr<const Entry>& first,
+                    _In_ const std::shared_ptr<const Entry>& second);
+
+            static std::shared_ptr<const Node> dissoc(
+                    _In_ const std::shared_ptr<const Node>& node,
+                    _In_ uint32_t shift,
+                    _In_ uint64_t hash,
+                    _In_ lai_object_id_t oid,
+                    _Inout_ size_t& size);
+
+            static void collect(
+                    _In_ const Node& node,
+                    _Inout_ std::vector<lai_object_meta_key_t>& keys);
+
+            const Entry* findEntry(
+                    _In_ lai_object_id_t oid) const;
+
+        private:
+
+            uint64_t m_version;
+
+            size_t m_size;
+
+            std::shared_ptr<const Node> m_root;
+    };
+}
@@ -0,0 +1,393 @@
+#include "MetadataIndex.h"
+
+#include "swss/logger.h"
+
+using namespace laimeta;
+
+MetadataIndex::MetadataIndex()
+{
+    SWSS_LOG_ENTER();
+
+    // enums used directly by serialize functions
+
+    addEnum(&lai_metadata_enum_lai_status_t);
+    addEnum(&lai_metadata_enum_lai_common_api_t);
+    addEnum(&lai_metadata_enum_lai_object_type_t);
+    addEnum(&lai_metadata_enum_lai_log_level_t);
+    addEnum(&lai_metadata_enum_lai_api_t);
+    addEnum(&lai_metadata_enum_lai_attr_value_type_t);
+    addEnum(&lai_metadata_enum_lai_alarm_severity_t);
+    addEnum(&lai_metadata_enum_lai_alarm_type_t);
+    addEnum(&lai_metadata_enum_lai_alarm_status_t);
+    addEnum(&lai_metadata_enum_lai_oper_status_t);
+
+    const lai_enum_metadata_t* otmeta = &lai_metadata_enum_lai_object_type_t;
+
+    for (size_t i = 0; i < otmeta->valuescount; i++)
+    {
+        lai_object_type_t ot = (lai_object_type_t)otmeta->values[i];
+
+        auto info = lai_metadata_get_object_type_info(ot);
+
+        if (info == NULL)
+        {
+            continue;
+        }
+
+        addObjectType(ot, info);
+
+        for (size_t idx = 0; info->attrmetadata && info->attrmetadata[idx] != NULL; idx++)
+        {
+            auto md = info->attrmetadata[idx];
+
+            addAttr(md);
+
+            if (md->enummetadata)
+            {
+                addEnum(md->enummetadata);
+            }
+        }
+
+        if (info->statenum == NULL)
+        {
+            continue;
+        }
+
+        addEnum(info->statenum);
+
+        for (size_t idx = 0; idx < info->statenum->valuescount; idx++)
+        {
+            auto sm = lai_metadata_get_stat_metadata(ot, info->statenum->values[idx]);
+
+            if (sm)
+            {
+                addStat(sm);
+
+                if ((size_t)ot < m_objectTypes.size())
+                {
+                    m_objectTypes[ot].m_stats.emplace(info->statenum->values[idx], sm);
+                }
+            }
+        }
+    }
+
+    SWSS_LOG_NOTICE("indexed %zu enums, %zu attributes, %zu stats", m_enums.size(), m_attrs.size(), m_stats.size());
+}
+
+const MetadataIndex& MetadataIndex::getInstance()
+{
+    SWSS_LOG_ENTER();
+
+    static MetadataIndex index;
+
+    return index;
+}
+
+void MetadataIndex::addAttr(
+        _In_ const lai_attr_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_attrHandles.find(meta) != m_attrHandles.end())
+    {
+        return;
+    }
+
+    uint32_t handle = (uint32_t)m_attrs.size();
+
+    m_attrs.push_back(meta);
+
+    m_attrHandles.emplace(meta, handle);
+
+    // emplace keeps first match, same as linear scan
+
+    m_attrNames.emplace(meta->attridname, handle);
+}
+
+void MetadataIndex::addStat(
+        _In_ const lai_stat_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_statHandles.find(meta) != m_statHandles.end())
+    {
+        return;
+    }
+
+    uint32_t handle = (uint32_t)m_stats.size();
+
+    m_stats.push_back(meta);
+
+    m_statHandles.emplace(meta, handle);
+
+    m_statNames.emplace(meta->statidname, handle);
+}
+
+void MetadataIndex::addObjectType(
+        _In_ lai_object_type_t objectType,
+        _In_ const lai_object_type_info_t* info)
+{
+    SWSS_LOG_ENTER();
+
+    if (objectType == LAI_OBJECT_TYPE_NULL || objectType >= LAI_OBJECT_TYPE_EXTENSIONS_MAX)
+    {
+        return;
+    }
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        m_objectTypes.resize((size_t)objectType + 1, ObjectTypeIndex{ nullptr, {}, {} });
+    }
+
+    auto& oti = m_objectTypes[objectType];
+
+    oti.m_info = info;
+
+    for (size_t idx = 0; info->attrmetadata && info->attrmetadata[idx] != NULL; idx++)
+    {
+        auto md = info->attrmetadata[idx];
+
+        auto& slot = oti.m_attrs[md->attrid];
+
+        // keep first match, same as linear scan
+
+        if (slot == nullptr)
+        {
+            slot = md;
+        }
+    }
+}
+
+void MetadataIndex::addEnum(
+        _In_ const lai_enum_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_enums.find(meta) != m_enums.end())
+    {
+        return;
+    }
+
+    auto& ei = m_enums[meta];
+
+    ei.m_contiguous = true;
+
+    for (size_t i = 0; i < meta->valuescount; i++)
+    {
+        if (meta->values[i] != (int32_t)i)
+        {
+            ei.m_contiguous = false;
+        }
+
+        // emplace keeps first match, same as linear scan
+
+        ei.m_valueToIndex.emplace(meta->values[i], i);
+
+        ei.m_nameToValue.emplace(meta->valuesnames[i], meta->values[i]);
+
+        if (meta->valuesshortnames)
+        {
+            ei.m_nameToValue.emplace(meta->valuesshortnames[i], meta->values[i]);
+        }
+    }
+
+    if (ei.m_contiguous)
+    {
+        ei.m_valueToIndex.clear();
+    }
+}
+
+const char* MetadataIndex::getEnumName(
+        _In_ const lai_enum_metadata_t* meta,
+        _In_ int32_t value,
+        _In_ bool shortName) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_enums.find(meta);
+
+    if (it == m_enums.end())
+    {
+        return nullptr;
+    }
+
+    size_t idx;
+
+    if (it->second.m_contiguous)
+    {
+        if (value < 0 || (size_t)value >= meta->valuescount)
+        {
+            return nullptr;
+        }
+
+        idx = (size_t)value;
+    }
+    else
+    {
+        auto vit = it->second.m_valueToIndex.find(value);
+
+        if (vit == it->second.m_valueToIndex.end())
+        {
+            return nullptr;
+        }
+
+        idx = vit->second;
+    }
+
+    return shortName ? meta->valuesshortnames[idx] : meta->valuesnames[idx];
+}
+
+bool MetadataIndex::getEnumValue(
+        _In_ const lai_enum_metadata_t* meta,
+        _In_ const std::string& name,
+        _Out_ int32_t& value) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_enums.find(meta);
+
+    if (it == m_enums.end())
+    {
+        return false;
+    }
+
+    auto nit = it->second.m_nameToValue.find(name);
+
+    if (nit == it->second.m_nameToValue.end())
+    {
+        return false;
+    }
+
+    value = nit->second;
+
+    return true;
+}
+
+const lai_attr_metadata_t* MetadataIndex::getAttrMetadata(
+        _In_ const std::string& attrIdName) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return getAttrMetadataByHandle(getAttrHandle(attrIdName));
+}
+
+const lai_stat_metadata_t* MetadataIndex::getStatMetadata(
+        _In_ const std::string& statIdName) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return getStatMetadataByHandle(getStatHandle(statIdName));
+}
+
+uint32_t MetadataIndex::getAttrHandle(
+        _In_ const std::string& attrIdName) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_attrNames.find(attrIdName);
+
+    return (it == m_attrNames.end()) ? INVALID_HANDLE : it->second;
+}
+
+uint32_t MetadataIndex::getAttrHandle(
+        _In_ const lai_attr_metadata_t* meta) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_attrHandles.find(meta);
+
+    return (it == m_attrHandles.end()) ? INVALID_HANDLE : it->second;
+}
+
+const lai_attr_metadata_t* MetadataIndex::getAttrMetadataByHandle(
+        _In_ uint32_t handle) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return (handle < m_attrs.size()) ? m_attrs[handle] : nullptr;
+}
+
+uint32_t MetadataIndex::getStatHandle(
+        _In_ const std::string& statIdName) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_statNames.find(statIdName);
+
+    return (it == m_statNames.end()) ? INVALID_HANDLE : it->second;
+}
+
+uint32_t MetadataIndex::getStatHandle(
+        _In_ const lai_stat_metadata_t* meta) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto it = m_statHandles.find(meta);
+
+    return (it == m_statHandles.end()) ? INVALID_HANDLE : it->second;
+}
+
+const lai_stat_metadata_t* MetadataIndex::getStatMetadataByHandle(
+        _In_ uint32_t handle) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return (handle < m_stats.size()) ? m_stats[handle] : nullptr;
+}
+
+const lai_object_type_info_t* MetadataIndex::getObjectTypeInfo(
+        _In_ lai_object_type_t objectType) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        return nullptr;
+    }
+
+    return m_objectTypes[objectType].m_info;
+}
+
+const lai_attr_metadata_t* MetadataIndex::getAttrMetadata(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_attr_id_t attrId) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        return nullptr;
+    }
+
+    auto md = m_objectTypes[objectType].m_attrs.find(attrId);
+
+    return md ? *md : nullptr;
+}
+
+const lai_stat_metadata_t* MetadataIndex::getStatMetadata(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_stat_id_t statId) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        return nullptr;
+    }
+
+    auto& stats = m_objectTypes[objectType].m_stats;
+
+    auto it = stats.find(statId);
+
+    return (it == stats.end()) ? nullptr : it->second;
+}
+
+bool MetadataIndex::isObjectIdType(
+        _In_ lai_object_type_t objectType) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    auto info = getObjectTypeInfo(objectType);
+
+    return info && info->isobjectid;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include "swss/sal.h"
+
+#include "AttrIdMap.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace laimeta
+{
+    /**
+     * @brief Metadata lookup index.
+     *
+     * Hash indexes for enum value to name, enum name to value, attribute id
+     * name to attribute metadata and stat id name to stat metadata. Metadata
+     * generated by LAI only provides linear scans for those lookups, and
+     * they are executed for every field of every serialized message.
+     *
+     * Per object type tables map object type to its info and attribute id to
+     * attribute metadata by direct array indexing, those are used by meta
+     * validation and object key hashing on every API call.
+     *
+     * Index is built once on first use from all object types metadata and is
+     * immutable afterwards, so lookups don't need any locking. Lookups return
+     * nullptr/false when entry is not indexed, and then caller should fall
+     * back to metadata linear scan.
+     */
+    class MetadataIndex
+    {
+        private:
+
+            MetadataIndex();
+
+        public:
+
+            ~MetadataIndex() = default;
+
+        public:
+
+            /**
+             * @brief Returned for names which are not interned.
+             */
+            static constexpr uint32_t INVALID_HANDLE = UINT32_MAX;
+
+        public:
+
+            static const MetadataIndex& getInstance();
+
+        public:
+
+            const char* getEnumName(
+                    _In_ const lai_enum_metadata_t* meta,
+                    _In_ int32_t value,
+                    _In_ bool shortName) const;
+
+            bool getEnumValue(
+                    _In_ const lai_enum_metadata_t* meta,
+                    _In_ const std::string& name,
+                    _Out_ int32_t& value) const;
+
+            const lai_attr_metadata_t* getAttrMetadata(
+                    _In_ const std::string& attrIdName) const;
+
+            const lai_stat_metadata_t* getStatMetadata(
+                    _In_ const std::string& statIdName) const;
+
+            /**
+             * @brief Interned attribute and stat id names.
+             *
+             * Each attribute and stat id name gets small integer handle,
+             * which can be stored and compared instead of name string.
+             */
+            uint32_t getAttrHandle(
+                    _In_ const std::string& attrIdName) const;
+
+            uint32_t getAttrHandle(
+                    _In_ const lai_attr_metadata_t* meta) const;
+
+            const lai_attr_metadata_t* getAttrMetadataByHandle(
+                    _In_ uint32_t handle) const;
+
+            uint32_t getStatHandle(
+                    _In_ const std::string& statIdName) const;
+
+            uint32_t getStatHandle(
+                    _In_ const lai_stat_metadata_t* meta) const;
+
+            const lai_stat_metadata_t* getStatMetadataByHandle(
+                    _In_ uint32_t handle) const;
+
+            /**
+             * @brief Get object type info.
+             *
+             * Same as lai_metadata_get_object_type_info but without
+             * linear scan, returns nullptr for invalid object type.
+             */
+            const lai_object_type_info_t* getObjectTypeInfo(
+                    _In_ lai_object_type_t objectType) const;
+
+            /**
+             * @brief Get attribute metadata.
+             *
+             * Same as lai_metadata_get_attr_metadata, returns nullptr if
+             * attribute is not defined on given object type.
+             */
+            const lai_attr_metadata_t* getAttrMetadata(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_attr_id_t attrId) const;
+
+            /**
+             * @brief Get stat metadata.
+             *
+             * Same as lai_metadata_get_stat_metadata, returns nullptr if
+             * stat is not defined on given object type.
+             */
+            const lai_stat_metadata_t* getStatMetadata(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_stat_id_t statId) const;
+
+            bool isObjectIdType(
+                    _In_ lai_object_type_t objectType) const;
+
+        private:
+
+            typedef struct _EnumIndex
+            {
+                /**
+                 * @brief Values are 0..valuescount-1 in order, so value is
+                 * index to names array.
+                 */
+                bool m_contiguous;
+
+                std::unordered_map<int32_t, size_t> m_valueToIndex;
+
+                std::unordered_map<std::string, int32_t> m_nameToValue;
+
+            } EnumIndex;
+
+            typedef struct _ObjectTypeIndex
+            {
+                const lai_object_type_info_t* m_info;
+
+                AttrIdMap<const lai_attr_metadata_t*> m_attrs;
+
+                std::unordered_map<lai_stat_id_t, const lai_stat_metadata_t*> m_stats;
+
+            } ObjectTypeIndex;
+
+            void addEnum(
+                    _In_ const lai_enum_metadata_t* meta);
+
+            void addObjectType(
+                    _In_ lai_object_type_t objectType,
+                    _In_ const lai_object_type_info_t* info);
+
+        private:
+
+            std::unordered_map<const lai_enum_metadata_t*, EnumIndex> m_enums;
+
+            void addAttr(
+                    _In_ const lai_attr_metadata_t* meta);
+
+            void addStat(
+                    _In_ const lai_stat_metadata_t* meta);
+
+        private:
+
+            std::unordered_map<std::string, uint32_t> m_attrNames;
+
+            std::unordered_map<const lai_attr_metadata_t*, uint32_t> m_attrHandles;
+
+            std::vector<const lai_attr_metadata_t*> m_attrs;
+
+            std::unordered_map<std::string, uint32_t> m_statNames;
+
+            std::unordered_map<const lai_stat_metadata_t*, uint32_t> m_statHandles;
+
+            std::vector<const lai_stat_metadata_t*> m_stats;
+
+            std::vector<ObjectTypeIndex> m_objectTypes;
+    };
+}
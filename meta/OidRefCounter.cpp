@@ -1,4 +1,5 @@
 #include "OidRefCounter.h"
+#include "MetadataIndex.h"
 
 #include "swss/logger.h"
 
@@ -6,11 +7,127 @@
 
 using namespace laimeta;
 
+#define INITIAL_CAPACITY (64)
+
+#define INVALID_SLOT ((size_t)-1)
+
+static inline size_t oidHash(
+        _In_ lai_object_id_t oid)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    // object index is in lower bits and object type/linecard in upper bits
+    // of oid, mix them so linear probing sequences don't cluster
+
+    uint64_t h = oid * 0x9e3779b97f4a7c15ULL;
+
+    return (size_t)(h ^ (h >> 32));
+}
+
+OidRefCounter::OidRefCounter():
+    m_table(INITIAL_CAPACITY),
+    m_size(0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 void OidRefCounter::clear()
 {
     SWSS_LOG_ENTER();
 
-    m_hash.clear();
+    m_table.assign(INITIAL_CAPACITY, Entry{ LAI_NULL_OBJECT_ID, 0 });
+
+    m_size = 0;
+
+    m_changedOids.clear();
+}
+
+size_t OidRefCounter::findSlot(
+        _In_ lai_object_id_t oid) const
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if (oid == LAI_NULL_OBJECT_ID)
+    {
+        return INVALID_SLOT;
+    }
+
+    size_t mask = m_table.size() - 1;
+
+    for (size_t slot = oidHash(oid) & mask; ; slot = (slot + 1) & mask)
+    {
+        if (m_table[slot].m_oid == oid)
+        {
+            return slot;
+        }
+
+        if (m_table[slot].m_oid == LAI_NULL_OBJECT_ID)
+        {
+            return INVALID_SLOT;
+        }
+    }
+}
+
+void OidRefCounter::rehash(
+        _In_ size_t capacity)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<Entry> table(capacity, Entry{ LAI_NULL_OBJECT_ID, 0 });
+
+    size_t mask = capacity - 1;
+
+    for (auto& e: m_table)
+    {
+        if (e.m_oid == LAI_NULL_OBJECT_ID)
+        {
+            continue;
+        }
+
+        size_t slot = oidHash(e.m_oid) & mask;
+
+        while (table[slot].m_oid != LAI_NULL_OBJECT_ID)
+        {
+            slot = (slot + 1) & mask;
+        }
+
+        table[slot] = e;
+    }
+
+    m_table.swap(table);
+}
+
+void OidRefCounter::eraseSlot(
+        _In_ size_t slot)
+{
+    SWSS_LOG_ENTER();
+
+    // backward shift deletion, keeps probing sequences without tombstones
+
+    size_t mask = m_table.size() - 1;
+
+    size_t hole = slot;
+
+    for (size_t next = (hole + 1) & mask; m_table[next].m_oid != LAI_NULL_OBJECT_ID; next = (next + 1) & mask)
+    {
+        size_t home = oidHash(m_table[next].m_oid) & mask;
+
+        // move entry to hole if hole is between its home slot and its
+        // current slot (cyclically)
+
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            m_table[hole] = m_table[next];
+
+            hole = next;
+        }
+    }
+
+    m_table[hole] = Entry{ LAI_NULL_OBJECT_ID, 0 };
+
+    m_size--;
 }
 
 bool OidRefCounter::objectReferenceExists(
@@ -18,7 +135,7 @@ bool OidRefCounter::objectReferenceExists(
 {
     SWSS_LOG_ENTER();
 
-    bool exists = m_hash.find(oid) != m_hash.end();
+    bool exists = findSlot(oid) != INVALID_SLOT;
 
     SWSS_LOG_DEBUG("object 0x%" PRIx64 " reference: %s", oid, exists ? "exists" : "missing");
 
@@ -36,14 +153,18 @@ void OidRefCounter::objectReferenceIncrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot == INVALID_SLOT)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
     }
 
-    m_hash[oid]++;
+    m_table[slot].m_count++;
+
+    m_changedOids.push_back(oid);
 
-    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    SWSS_LOG_DEBUG("increased reference on oid 0x%" PRIx64 " to %d", oid, m_table[slot].m_count);
 }
 
 void OidRefCounter::objectReferenceIncrement(
@@ -68,19 +189,23 @@ void OidRefCounter::objectReferenceDecrement(
         return;
     }
 
-    if (!objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot == INVALID_SLOT)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
     }
 
-    m_hash[oid]--;
+    m_table[slot].m_count--;
+
+    m_changedOids.push_back(oid);
 
-    if (m_hash[oid] < 0)
+    if (m_table[slot].m_count < 0)
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference count is negative!", oid);
     }
 
-    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, m_hash[oid]);
+    SWSS_LOG_DEBUG("decreased reference on oid 0x%" PRIx64 " to %d", oid, m_table[slot].m_count);
 }
 
 void OidRefCounter::objectReferenceDecrement(
@@ -94,17 +219,161 @@ void OidRefCounter::objectReferenceDecrement(
     }
 }
 
+void OidRefCounter::collectSlot(
+        _In_ lai_object_id_t oid)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    if (oid == LAI_NULL_OBJECT_ID)
+    {
+        // We don't keep track of NULL object id's.
+        return;
+    }
+
+    size_t slot = findSlot(oid);
+
+    if (slot == INVALID_SLOT)
+    {
+        SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " not in reference map", oid);
+    }
+
+    m_batchSlots.push_back(slot);
+}
+
+void OidRefCounter::collectSlots(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const lai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = MetadataIndex::getInstance();
+
+    m_batchSlots.clear();
+
+    for (uint32_t idx = 0; idx < attrCount; ++idx)
+    {
+        const lai_attribute_t& attr = attrList[idx];
+
+        auto md = index.getAttrMetadata(objectType, attr.id);
+
+        if (md == NULL)
+        {
+            SWSS_LOG_THROW("FATAL: failed to find metadata for object type %d and attr id %d", objectType, attr.id);
+        }
+
+        switch (md->attrvaluetype)
+        {
+            case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+
+                collectSlot(attr.value.oid);
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+
+                for (uint32_t i = 0; i < attr.value.objlist.count; ++i)
+                {
+                    collectSlot(attr.value.objlist.list[i]);
+                }
+
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+void OidRefCounter::objectReferenceIncrement(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const lai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
+    collectSlots(objectType, attrCount, attrList);
+
+    for (auto slot: m_batchSlots)
+    {
+        m_table[slot].m_count++;
+
+        m_changedOids.push_back(m_table[slot].m_oid);
+    }
+}
+
+void OidRefCounter::objectReferenceDecrement(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t attrCount,
+        _In_ const lai_attribute_t* attrList)
+{
+    SWSS_LOG_ENTER();
+
+    collectSlots(objectType, attrCount, attrList);
+
+    for (auto slot: m_batchSlots)
+    {
+        m_table[slot].m_count--;
+    }
+
+    for (auto slot: m_batchSlots)
+    {
+        if (m_table[slot].m_count < 0)
+        {
+            lai_object_id_t oid = m_table[slot].m_oid;
+
+            // revert, so counts are left as they were before the call
+
+            for (auto s: m_batchSlots)
+            {
+                m_table[s].m_count++;
+            }
+
+            SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference count is negative!", oid);
+        }
+    }
+
+    for (auto slot: m_batchSlots)
+    {
+        m_changedOids.push_back(m_table[slot].m_oid);
+    }
+}
+
 void OidRefCounter::objectReferenceInsert(
         _In_ lai_object_id_t oid)
 {
     SWSS_LOG_ENTER();
 
+    if (oid == LAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_THROW("FATAL: can't insert reference on null object id");
+    }
+
     if (objectReferenceExists(oid))
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " already in reference map", oid);
     }
 
-    m_hash[oid] = 0;
+    // keep load factor below 1/2, so probing sequences stay short
+
+    if ((m_size + 1) * 2 > m_table.size())
+    {
+        rehash(m_table.size() * 2);
+    }
+
+    size_t mask = m_table.size() - 1;
+
+    size_t slot = oidHash(oid) & mask;
+
+    while (m_table[slot].m_oid != LAI_NULL_OBJECT_ID)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    m_table[slot] = Entry{ oid, 0 };
+
+    m_size++;
+
+    m_changedOids.push_back(oid);
 
     SWSS_LOG_DEBUG("inserted reference on 0x%" PRIx64 "", oid);
 }
@@ -114,9 +383,11 @@ void OidRefCounter::objectReferenceRemove(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != INVALID_SLOT)
     {
-        int32_t count = getObjectReferenceCount(oid);
+        int32_t count = m_table[slot].m_count;
 
         if (count > 0)
         {
@@ -130,7 +401,9 @@ void OidRefCounter::objectReferenceRemove(
 
     SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-    m_hash.erase(oid);
+    eraseSlot(slot);
+
+    m_changedOids.push_back(oid);
 }
 
 int32_t OidRefCounter::getObjectReferenceCount(
@@ -138,9 +411,11 @@ int32_t OidRefCounter::getObjectReferenceCount(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != INVALID_SLOT)
     {
-        int32_t count = m_hash.at(oid);
+        int32_t count = m_table[slot].m_count;
 
         SWSS_LOG_DEBUG("reference count on oid 0x%" PRIx64 " is %d", oid, count);
 
@@ -162,7 +437,17 @@ std::unordered_map<lai_object_id_t, int32_t> OidRefCounter::getAllReferences() c
 {
     SWSS_LOG_ENTER();
 
-    return m_hash; // copy
+    std::unordered_map<lai_object_id_t, int32_t> hash;
+
+    for (auto& e: m_table)
+    {
+        if (e.m_oid != LAI_NULL_OBJECT_ID)
+        {
+            hash[e.m_oid] = e.m_count;
+        }
+    }
+
+    return hash;
 }
 
 std::vector<lai_object_id_t> OidRefCounter::getAllOids() const
@@ -171,9 +456,14 @@ std::vector<lai_object_id_t> OidRefCounter::getAllOids() const
 
     std::vector<lai_object_id_t> vec;
 
-    for (auto& it: m_hash)
+    vec.reserve(m_size);
+
+    for (auto& e: m_table)
     {
-        vec.push_back(it.first);
+        if (e.m_oid != LAI_NULL_OBJECT_ID)
+        {
+            vec.push_back(e.m_oid);
+        }
     }
 
     return vec;
@@ -184,14 +474,28 @@ void OidRefCounter::objectReferenceClear(
 {
     SWSS_LOG_ENTER();
 
-    if (objectReferenceExists(oid))
+    size_t slot = findSlot(oid);
+
+    if (slot != INVALID_SLOT)
     {
         SWSS_LOG_DEBUG("removing object oid 0x%" PRIx64 " reference", oid);
 
-        m_hash.erase(oid);
+        eraseSlot(slot);
+
+        m_changedOids.push_back(oid);
     }
     else
     {
         SWSS_LOG_THROW("FATAL: object oid 0x%" PRIx64 " reference not in map", oid);
     }
 }
+
+void OidRefCounter::takeChangedOids(
+        _Inout_ std::vector<lai_object_id_t>& oids)
+{
+    SWSS_LOG_ENTER();
+
+    oids.insert(oids.end(), m_changedOids.begin(), m_changedOids.end());
+
+    m_changedOids.clear();
+}
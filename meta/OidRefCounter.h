@@ -9,11 +9,18 @@ extern "C" {
 
 namespace laimeta
 {
+    /**
+     * @brief Object reference counter.
+     *
+     * Counts are kept in flat open addressing table with linear probing,
+     * object id LAI_NULL_OBJECT_ID marks empty slot, since null object id
+     * is never reference counted.
+     */
     class OidRefCounter
     {
         public:
 
-            OidRefCounter() = default;
+            OidRefCounter();
 
             virtual ~OidRefCounter() = default;
 
@@ -55,6 +62,31 @@ namespace laimeta
             void objectReferenceDecrement(
                     _In_ const lai_object_list_t& list);
 
+            /**
+             * @brief Increment reference count on all object ids used by
+             * object id and object list attributes on attribute list.
+             *
+             * Throws if any object was not previously inserted, in that case
+             * no reference count is changed.
+             */
+            void objectReferenceIncrement(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const lai_attribute_t* attrList);
+
+            /**
+             * @brief Decrement reference count on all object ids used by
+             * object id and object list attributes on attribute list.
+             *
+             * Throws if any object was not previously inserted or if
+             * reference count would become negative, in that case no
+             * reference count is changed.
+             */
+            void objectReferenceDecrement(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const lai_attribute_t* attrList);
+
             /**
              * @brief Insert object reference.
              *
@@ -103,14 +135,60 @@ namespace laimeta
 
             std::vector<lai_object_id_t> getAllOids() const;
 
+            /**
+             * @brief Append object ids modified since last call to given
+             * vector, used to publish incremental snapshots.
+             */
+            void takeChangedOids(
+                    _Inout_ std::vector<lai_object_id_t>& oids);
+
         private:
 
+            typedef struct _Entry
+            {
+                lai_object_id_t m_oid;
+
+                int32_t m_count;
+
+            } Entry;
+
+            size_t findSlot(
+                    _In_ lai_object_id_t oid) const;
+
+            void rehash(
+                    _In_ size_t capacity);
+
+            void eraseSlot(
+                    _In_ size_t slot);
+
             /**
-             * @brief Object id to reference count hash.
+             * @brief Collect table slots of all object ids used by attribute
+             * list into m_batchSlots, throws if any object is missing.
+             */
+            void collectSlots(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t attrCount,
+                    _In_ const lai_attribute_t* attrList);
+
+            void collectSlot(
+                    _In_ lai_object_id_t oid);
+
+        private:
+
+            /**
+             * @brief Object id to reference count table.
              *
-             * Object may exist in the hash, and have reference count 0, which
+             * Object may exist in the table, and have reference count 0, which
              * means is not not used anywhere and can be safely removed.
+             *
+             * Capacity is always power of 2.
              */
-            std::unordered_map<lai_object_id_t, int32_t> m_hash;
+            std::vector<Entry> m_table;
+
+            size_t m_size;
+
+            std::vector<size_t> m_batchSlots;
+
+            std::vector<lai_object_id_t> m_changedOids;
     };
 }
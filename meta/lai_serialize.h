@@ -56,6 +56,61 @@ lai_status_t div_stat(
         _In_ lai_stat_value_t &dividend,
         _In_ uint64_t divisor);
 
+/**
+ * @brief Attribute value kernels specialized for single value type.
+ *
+ * Obtained once per attribute metadata, so callers doing many operations on
+ * the same attribute don't need to switch on value type every time.
+ */
+typedef struct _lai_attr_ops_t
+{
+    lai_status_t (*transfer)(
+            _In_ const lai_attribute_t &src_attr,
+            _Inout_ lai_attribute_t &dst_attr,
+            _In_ bool countOnly);
+
+    int (*compare)(
+            _In_ const lai_attribute_t &attr1,
+            _In_ const lai_attribute_t &attr2);
+
+} lai_attr_ops_t;
+
+/**
+ * @brief Stat value kernels specialized for single value type.
+ */
+typedef struct _lai_stat_ops_t
+{
+    void (*transfer)(
+            _In_ const lai_stat_value_t &src_stat,
+            _Inout_ lai_stat_value_t &dst_stat);
+
+    int (*compare)(
+            _In_ const lai_stat_value_t &stat1,
+            _In_ const lai_stat_value_t &stat2);
+
+    void (*inc)(
+            _Inout_ lai_stat_value_t &stat,
+            _In_ const lai_stat_value_t &increment);
+
+    void (*div)(
+            _Out_ lai_stat_value_t &stat,
+            _In_ const lai_stat_value_t &dividend,
+            _In_ uint64_t divisor);
+
+} lai_stat_ops_t;
+
+/**
+ * @return Kernels for given value type or NULL if type is not supported.
+ */
+const lai_attr_ops_t* lai_get_attr_ops(
+        _In_ lai_attr_value_type_t serialization_type);
+
+/**
+ * @return Kernels for stat value type or NULL if type is not supported.
+ */
+const lai_stat_ops_t* lai_get_stat_ops(
+        _In_ const lai_stat_metadata_t &meta);
+
 // serialize
 
 std::string lai_serialize_object_type(
@@ -83,6 +138,63 @@ std::string lai_serialize_stat_value(
         _In_ const lai_stat_metadata_t& meta,
         _In_ const lai_stat_value_t &stat);
 
+/**
+ * @brief Size of buffer enough for any number serialized by functions below.
+ */
+#define LAI_SERIALIZE_NUMBER_BUFFER_SIZE (400)
+
+/*
+ * Following functions write serialized value (same format as string
+ * variants) into caller buffer including terminating zero, and return
+ * number of characters written not counting terminating zero.
+ */
+
+size_t lai_serialize_stat_value(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ const lai_stat_metadata_t& meta,
+        _In_ const lai_stat_value_t &stat);
+
+size_t lai_serialize_number(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint64_t number,
+        _In_ bool negative);
+
+size_t lai_serialize_decimal(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ double value,
+        _In_ int precision);
+
+/*
+ * Following functions append serialized value (same format as string
+ * variants) to the end of caller string, so the same string can be reused
+ * across calls without allocating new one every time.
+ */
+
+void lai_serialize_attr_value_append(
+        _Inout_ std::string& s,
+        _In_ const lai_attr_metadata_t& meta,
+        _In_ const lai_attribute_t &attr,
+        _In_ const bool countOnly = false,
+        _In_ const bool shortName = false);
+
+void lai_serialize_stat_value_append(
+        _Inout_ std::string& s,
+        _In_ const lai_stat_metadata_t& meta,
+        _In_ const lai_stat_value_t &stat);
+
+void lai_serialize_enum_append(
+        _Inout_ std::string& s,
+        _In_ const int32_t value,
+        _In_ const lai_enum_metadata_t* meta,
+        _In_ const bool shortName = false);
+
+void lai_serialize_object_id_append(
+        _Inout_ std::string& s,
+        _In_ lai_object_id_t oid);
+
 std::string lai_serialize_status(
         _In_ const lai_status_t status);
 
@@ -181,6 +293,15 @@ void lai_deserialize_number(
         _Out_ uint32_t& number,
         _In_ bool hex = false);
 
+void lai_deserialize_decimal(
+        _In_ const std::string& s,
+        _Out_ double& value);
+
+void lai_deserialize_stat_value(
+        _In_ const lai_stat_metadata_t& meta,
+        _In_ const std::string& s,
+        _Out_ lai_stat_value_t& stat);
+
 void lai_deserialize_status(
         _In_ const std::string& s,
         _Out_ lai_status_t& status);
@@ -1,4 +1,5 @@
 #include "lai_serialize.h"
+#include "MetadataIndex.h"
 #include "swss/tokenize.h"
 
 #pragma GCC diagnostic push
@@ -9,6 +10,8 @@
 #include <inttypes.h>
 #include <vector>
 #include <climits>
+#include <cmath>
+#include <type_traits>
 
 #include <arpa/inet.h>
 #include <errno.h>
@@ -89,9 +92,11 @@ static lai_status_t transfer_list(
 
         transfer_primitive(src_element.count, dst_element.count);
 
-        for (size_t i = 0; i < src_element.count; i++)
+        // list elements are plain data, so entire list is copied at once
+
+        if (src_element.count)
         {
-            transfer_primitive(src_element.list[i], dst_element.list[i]);
+            memcpy(dst_element.list, src_element.list, src_element.count * sizeof(*src_element.list));
         }
 
         return LAI_STATUS_SUCCESS;
@@ -110,109 +115,306 @@ static lai_status_t transfer_list(
         return s;\
 }
 
-lai_status_t transfer_attribute(
-        _In_ lai_attr_value_type_t serialization_type,
-        _In_ const lai_attribute_t &src_attr,
-        _In_ lai_attribute_t &dst_attr,
-        _In_ bool countOnly)
+template<typename T>
+static int compare_primitive(
+        _In_ const T &item1,
+        _In_ const T &item2)
+{
+    SWSS_LOG_ENTER();
+
+    const unsigned char* ptr1 = reinterpret_cast<const unsigned char*>(&item1);
+    const unsigned char* ptr2 = reinterpret_cast<const unsigned char*>(&item2);
+
+    return memcmp(ptr1, ptr2, sizeof(T));
+}
+
+static int compare_primitive(
+        _In_ const double &item1,
+        _In_ const double &item2)
+{
+    SWSS_LOG_ENTER();
+
+    if (item1 - item2 > ACCURATE)
+    {
+        return 1;
+    }
+
+    if (item2 - item1 > ACCURATE)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+template<typename T>
+static int compare_list(
+        _In_ const T &list1,
+        _In_ const T &list2)
+{
+    SWSS_LOG_ENTER();
+
+    if (list1.count != list2.count)
+    {
+        return 1;
+    }
+
+    if (list1.count == 0)
+    {
+        return 0;
+    }
+
+    if (list1.list == NULL || list2.list == NULL)
+    {
+        return 1;
+    }
+
+    // list elements are plain data, so entire list is compared at once
+
+    return memcmp(list1.list, list2.list, list1.count * sizeof(*list1.list)) ? 1 : 0;
+}
+
+/*
+ * Kernels specialized at compile time for each value type, M is pointer to
+ * union member holding the value.
+ */
+
+template<typename T, T lai_attribute_value_t::*M>
+struct lai_attr_primitive_kernel
+{
+    static lai_status_t transfer(
+            _In_ const lai_attribute_t &src_attr,
+            _Inout_ lai_attribute_t &dst_attr,
+            _In_ bool)
+    {
+        SWSS_LOG_ENTER();
+
+        transfer_primitive(src_attr.value.*M, dst_attr.value.*M);
+
+        return LAI_STATUS_SUCCESS;
+    }
+
+    static int compare(
+            _In_ const lai_attribute_t &attr1,
+            _In_ const lai_attribute_t &attr2)
+    {
+        SWSS_LOG_ENTER();
+
+        return compare_primitive(attr1.value.*M, attr2.value.*M);
+    }
+};
+
+template<typename T, T lai_attribute_value_t::*M>
+struct lai_attr_list_kernel
+{
+    static lai_status_t transfer(
+            _In_ const lai_attribute_t &src_attr,
+            _Inout_ lai_attribute_t &dst_attr,
+            _In_ bool countOnly)
+    {
+        SWSS_LOG_ENTER();
+
+        return transfer_list(src_attr.value.*M, dst_attr.value.*M, countOnly);
+    }
+
+    static int compare(
+            _In_ const lai_attribute_t &attr1,
+            _In_ const lai_attribute_t &attr2)
+    {
+        SWSS_LOG_ENTER();
+
+        return compare_list(attr1.value.*M, attr2.value.*M);
+    }
+};
+
+template<typename T, T lai_stat_value_t::*M>
+struct lai_stat_kernel
+{
+    static void transfer(
+            _In_ const lai_stat_value_t &src_stat,
+            _Inout_ lai_stat_value_t &dst_stat)
+    {
+        SWSS_LOG_ENTER();
+
+        transfer_primitive(src_stat.*M, dst_stat.*M);
+    }
+
+    static int compare(
+            _In_ const lai_stat_value_t &stat1,
+            _In_ const lai_stat_value_t &stat2)
+    {
+        SWSS_LOG_ENTER();
+
+        return compare_primitive(stat1.*M, stat2.*M);
+    }
+
+    static void inc(
+            _Inout_ lai_stat_value_t &stat,
+            _In_ const lai_stat_value_t &increment)
+    {
+        SWSS_LOG_ENTER();
+
+        stat.*M += increment.*M;
+    }
+
+    static void div(
+            _Out_ lai_stat_value_t &stat,
+            _In_ const lai_stat_value_t &dividend,
+            _In_ uint64_t divisor)
+    {
+        SWSS_LOG_ENTER();
+
+        stat.*M = dividend.*M / divisor;
+    }
+};
+
+template<typename K>
+static const lai_attr_ops_t* lai_attr_ops_of()
+{
+    SWSS_LOG_ENTER();
+
+    static const lai_attr_ops_t ops = { &K::transfer, &K::compare };
+
+    return &ops;
+}
+
+template<typename K>
+static const lai_stat_ops_t* lai_stat_ops_of()
+{
+    SWSS_LOG_ENTER();
+
+    static const lai_stat_ops_t ops = { &K::transfer, &K::compare, &K::inc, &K::div };
+
+    return &ops;
+}
+
+#define ATTR_OPS(kernel, member) \
+    lai_attr_ops_of<kernel<decltype(lai_attribute_value_t::member), &lai_attribute_value_t::member>>()
+
+#define STAT_OPS(member) \
+    lai_stat_ops_of<lai_stat_kernel<decltype(lai_stat_value_t::member), &lai_stat_value_t::member>>()
+
+const lai_attr_ops_t* lai_get_attr_ops(
+        _In_ lai_attr_value_type_t serialization_type)
 {
     SWSS_LOG_ENTER();
 
     switch (serialization_type)
     {
         case LAI_ATTR_VALUE_TYPE_BOOL:
-            transfer_primitive(src_attr.value.booldata, dst_attr.value.booldata);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, booldata);
 
         case LAI_ATTR_VALUE_TYPE_CHARDATA:
-            transfer_primitive(src_attr.value.chardata, dst_attr.value.chardata);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, chardata);
 
         case LAI_ATTR_VALUE_TYPE_UINT8:
-            transfer_primitive(src_attr.value.u8, dst_attr.value.u8);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, u8);
 
         case LAI_ATTR_VALUE_TYPE_INT8:
-            transfer_primitive(src_attr.value.s8, dst_attr.value.s8);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, s8);
 
         case LAI_ATTR_VALUE_TYPE_UINT16:
-            transfer_primitive(src_attr.value.u16, dst_attr.value.u16);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, u16);
 
         case LAI_ATTR_VALUE_TYPE_INT16:
-            transfer_primitive(src_attr.value.s16, dst_attr.value.s16);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, s16);
 
         case LAI_ATTR_VALUE_TYPE_UINT32:
-            transfer_primitive(src_attr.value.u32, dst_attr.value.u32);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, u32);
 
         case LAI_ATTR_VALUE_TYPE_INT32:
-            transfer_primitive(src_attr.value.s32, dst_attr.value.s32);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, s32);
 
         case LAI_ATTR_VALUE_TYPE_UINT64:
-            transfer_primitive(src_attr.value.u64, dst_attr.value.u64);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, u64);
 
         case LAI_ATTR_VALUE_TYPE_INT64:
-            transfer_primitive(src_attr.value.s64, dst_attr.value.s64);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, s64);
 
         case LAI_ATTR_VALUE_TYPE_DOUBLE:
-            transfer_primitive(src_attr.value.d64, dst_attr.value.d64);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, d64);
 
         case LAI_ATTR_VALUE_TYPE_POINTER:
-            transfer_primitive(src_attr.value.ptr, dst_attr.value.ptr);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, ptr);
 
         case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            transfer_primitive(src_attr.value.oid, dst_attr.value.oid);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, oid);
 
         case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.objlist, dst_attr.value.objlist, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, objlist);
 
         case LAI_ATTR_VALUE_TYPE_UINT8_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.u8list, dst_attr.value.u8list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, u8list);
 
         case LAI_ATTR_VALUE_TYPE_INT8_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.s8list, dst_attr.value.s8list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, s8list);
 
         case LAI_ATTR_VALUE_TYPE_UINT16_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.u16list, dst_attr.value.u16list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, u16list);
 
         case LAI_ATTR_VALUE_TYPE_INT16_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.s16list, dst_attr.value.s16list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, s16list);
 
         case LAI_ATTR_VALUE_TYPE_UINT32_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.u32list, dst_attr.value.u32list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, u32list);
 
         case LAI_ATTR_VALUE_TYPE_INT32_LIST:
-            RETURN_ON_ERROR(transfer_list(src_attr.value.s32list, dst_attr.value.s32list, countOnly));
-            break;
+            return ATTR_OPS(lai_attr_list_kernel, s32list);
 
         case LAI_ATTR_VALUE_TYPE_UINT32_RANGE:
-            transfer_primitive(src_attr.value.u32range, dst_attr.value.u32range);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, u32range);
 
         case LAI_ATTR_VALUE_TYPE_INT32_RANGE:
-            transfer_primitive(src_attr.value.s32range, dst_attr.value.s32range);
-            break;
+            return ATTR_OPS(lai_attr_primitive_kernel, s32range);
 
         default:
-            return LAI_STATUS_NOT_IMPLEMENTED;
+            return NULL;
     }
+}
 
-    return LAI_STATUS_SUCCESS;
+const lai_stat_ops_t* lai_get_stat_ops(
+        _In_ const lai_stat_metadata_t &meta)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta.statvaluetype)
+    {
+        case LAI_STAT_VALUE_TYPE_UINT32:
+            return STAT_OPS(u32);
+
+        case LAI_STAT_VALUE_TYPE_INT32:
+            return STAT_OPS(s32);
+
+        case LAI_STAT_VALUE_TYPE_UINT64:
+            return STAT_OPS(u64);
+
+        case LAI_STAT_VALUE_TYPE_INT64:
+            return STAT_OPS(s64);
+
+        case LAI_STAT_VALUE_TYPE_DOUBLE:
+            return STAT_OPS(d64);
+
+        default:
+            return NULL;
+    }
+}
+
+lai_status_t transfer_attribute(
+        _In_ lai_attr_value_type_t serialization_type,
+        _In_ const lai_attribute_t &src_attr,
+        _In_ lai_attribute_t &dst_attr,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    auto ops = lai_get_attr_ops(serialization_type);
+
+    if (ops == NULL)
+    {
+        return LAI_STATUS_NOT_IMPLEMENTED;
+    }
+
+    return ops->transfer(src_attr, dst_attr, countOnly);
 }
 
 lai_status_t transfer_attributes(
@@ -229,7 +431,7 @@ lai_status_t transfer_attributes(
         const lai_attribute_t &src_attr = src_attr_list[i];
         lai_attribute_t &dst_attr = dst_attr_list[i];
 
-        auto meta = lai_metadata_get_attr_metadata(object_type, src_attr.id);
+        auto meta = laimeta::MetadataIndex::getInstance().getAttrMetadata(object_type, src_attr.id);
 
         if (src_attr.id != dst_attr.id)
         {
@@ -256,79 +458,16 @@ lai_status_t transfer_stat(
 {
     SWSS_LOG_ENTER();
 
-    switch (meta.statvaluetype)
-    {
-        case LAI_STAT_VALUE_TYPE_UINT32:
-            transfer_primitive(src_stat.u32, dst_stat.u32);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT32:
-            transfer_primitive(src_stat.s32, dst_stat.s32);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_UINT64:
-            transfer_primitive(src_stat.u64, dst_stat.u64);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT64:
-            transfer_primitive(src_stat.s64, dst_stat.s64);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_DOUBLE:
-            transfer_primitive(src_stat.d64, dst_stat.d64);
-            break;
-
-        default:
-            return LAI_STATUS_NOT_IMPLEMENTED;
-    }
-
-    return LAI_STATUS_SUCCESS;
-}
+    auto ops = lai_get_stat_ops(meta);
 
-template<typename T>
-static int compare_primitive(
-        _In_ const T &item1,
-        _In_ const T &item2)
-{
-    SWSS_LOG_ENTER();
-
-    const unsigned char* ptr1 = reinterpret_cast<const unsigned char*>(&item1);
-    const unsigned char* ptr2 = reinterpret_cast<const unsigned char*>(&item2);
-
-    return memcmp(ptr1, ptr2, sizeof(T));
-}
-
-template<typename T>
-static int compare_list(
-        _In_ const T &list1,
-        _In_ const T &list2)
-{
-    SWSS_LOG_ENTER();
-
-    if (list1.count != list2.count)
+    if (ops == NULL)
     {
-        return 1;
+        return LAI_STATUS_NOT_IMPLEMENTED;
     }
 
-    if (list1.count == 0)
-    {
-        return 0;
-    }
+    ops->transfer(src_stat, dst_stat);
 
-    if (list1.list == NULL || list2.list == NULL)
-    {
-        return 1;
-    }
-
-    for (size_t i = 0; i < list1.count; i++)
-    {
-        if (compare_primitive(list1.list[i], list2.list[i]))
-        {
-            return 1;
-        }
-    }
-
-    return 0;
+    return LAI_STATUS_SUCCESS;
 }
 
 int compare_attribute(
@@ -338,14 +477,12 @@ int compare_attribute(
 {
     SWSS_LOG_ENTER();
 
-    int result = 1;
-
     if (attr1.id != attr2.id)
     {
         SWSS_LOG_THROW("attr1 (%d) vs attr2 (%d) attr-id don't match", attr1.id, attr2.id);
     }
 
-    auto meta = lai_metadata_get_attr_metadata(object_type, attr1.id);
+    auto meta = laimeta::MetadataIndex::getInstance().getAttrMetadata(object_type, attr1.id);
 
     if (meta == NULL)
     {
@@ -354,112 +491,14 @@ int compare_attribute(
                 attr1.id);
     }
 
-    switch (meta->attrvaluetype)
-    {
-        case LAI_ATTR_VALUE_TYPE_BOOL:
-            result = compare_primitive(attr1.value.booldata, attr2.value.booldata);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_CHARDATA:
-            result = compare_primitive(attr1.value.chardata, attr2.value.chardata);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT8:
-            result = compare_primitive(attr1.value.u8, attr2.value.u8);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT8:
-            result = compare_primitive(attr1.value.s8, attr2.value.s8);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT16:
-            result = compare_primitive(attr1.value.u16, attr2.value.u16);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT16:
-            result = compare_primitive(attr1.value.s16, attr2.value.s16);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT32:
-            result = compare_primitive(attr1.value.u32, attr2.value.u32);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT32:
-            result = compare_primitive(attr1.value.s32, attr2.value.s32);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT64:
-            result = compare_primitive(attr1.value.u64, attr2.value.u64);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT64:
-            result = compare_primitive(attr1.value.s64, attr2.value.s64);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_DOUBLE:
-            if (attr1.value.d64 - attr2.value.d64 > ACCURATE)
-            {
-                result = 1;
-            }
-            else if (attr2.value.d64 - attr1.value.d64 > ACCURATE)
-            {
-                result = -1;
-            }
-            else
-            {
-                result = 0;
-            }
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_POINTER:
-            result = compare_primitive(attr1.value.ptr, attr2.value.ptr);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            result = compare_primitive(attr1.value.oid, attr2.value.oid);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            result = compare_list(attr1.value.objlist, attr2.value.objlist);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT8_LIST:
-            result = compare_list(attr1.value.u8list, attr2.value.u8list);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT8_LIST:
-            result = compare_list(attr1.value.s8list, attr2.value.s8list);
-            break;
+    auto ops = lai_get_attr_ops(meta->attrvaluetype);
 
-        case LAI_ATTR_VALUE_TYPE_UINT16_LIST:
-            result = compare_list(attr1.value.u16list, attr2.value.u16list);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT16_LIST:
-            result = compare_list(attr1.value.s16list, attr2.value.s16list);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT32_LIST:
-            result = compare_list(attr1.value.u32list, attr2.value.u32list);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT32_LIST:
-            result = compare_list(attr1.value.s32list, attr2.value.s32list);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_UINT32_RANGE:
-            result = compare_primitive(attr1.value.u32range, attr2.value.u32range);
-            break;
-
-        case LAI_ATTR_VALUE_TYPE_INT32_RANGE:
-            result = compare_primitive(attr1.value.s32range, attr2.value.s32range);
-            break;
-
-        default:
-            break;
+    if (ops == NULL)
+    {
+        return 1;
     }
 
-    return result;
+    return ops->compare(attr1, attr2);
 }
 
 int compare_stats(
@@ -470,8 +509,6 @@ int compare_stats(
 {
     SWSS_LOG_ENTER();
 
-    int result = 1;
-
     auto meta = lai_metadata_get_stat_metadata(object_type, stat_id);
 
     if (meta == NULL)
@@ -481,44 +518,14 @@ int compare_stats(
                 stat_id);
     }
 
-    switch (meta->statvaluetype)
-    {
-        case LAI_STAT_VALUE_TYPE_INT32:
-            result = compare_primitive(stat1.s32, stat2.s32);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_UINT32:
-            result = compare_primitive(stat1.u32, stat2.u32);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT64:
-            result = compare_primitive(stat1.s64, stat2.s64);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_UINT64:
-            result = compare_primitive(stat1.u64, stat2.u64);
-            break;
-
-        case LAI_STAT_VALUE_TYPE_DOUBLE:
-            if (stat1.d64 - stat2.d64 > ACCURATE)
-            {
-                result = 1;
-            }
-            else if (stat2.d64 - stat1.d64 > ACCURATE)
-            {
-                result = -1;
-            }
-            else
-            {
-                result = 0;
-            }
-            break;
+    auto ops = lai_get_stat_ops(*meta);
 
-        default:
-            break;
+    if (ops == NULL)
+    {
+        return 1;
     }
 
-    return result;
+    return ops->compare(stat1, stat2);
 }
 
 lai_status_t inc_stat(
@@ -528,32 +535,15 @@ lai_status_t inc_stat(
 {
     SWSS_LOG_ENTER();
 
-    switch (meta.statvaluetype)
-    {
-        case LAI_STAT_VALUE_TYPE_UINT32:
-            stat.u32 += increment.u32;
-            break;
+    auto ops = lai_get_stat_ops(meta);
 
-        case LAI_STAT_VALUE_TYPE_INT32:
-            stat.s32 += increment.s32;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_UINT64:
-            stat.u64 += increment.u64;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT64:
-            stat.s64 += increment.s64;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_DOUBLE:
-            stat.d64 += increment.d64;
-            break;
-
-        default:
-            return LAI_STATUS_NOT_IMPLEMENTED;
+    if (ops == NULL)
+    {
+        return LAI_STATUS_NOT_IMPLEMENTED;
     }
 
+    ops->inc(stat, increment);
+
     return LAI_STATUS_SUCCESS;
 }
 
@@ -565,32 +555,15 @@ lai_status_t div_stat(
 {
     SWSS_LOG_ENTER();
 
-    switch (meta.statvaluetype)
-    {
-        case LAI_STAT_VALUE_TYPE_UINT32:
-            stat.u32 = dividend.u32 / divisor;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT32:
-            stat.s32 = dividend.s32 / divisor;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_UINT64:
-            stat.u64 = dividend.u64 / divisor;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_INT64:
-            stat.s64 = dividend.s64 / divisor;
-            break;
-
-        case LAI_STAT_VALUE_TYPE_DOUBLE:
-            stat.d64 = dividend.d64 / divisor;
-            break;
+    auto ops = lai_get_stat_ops(meta);
 
-        default:
-            return LAI_STATUS_NOT_IMPLEMENTED;
+    if (ops == NULL)
+    {
+        return LAI_STATUS_NOT_IMPLEMENTED;
     }
 
+    ops->div(stat, dividend, divisor);
+
     return LAI_STATUS_SUCCESS;
 }
 
@@ -644,32 +617,170 @@ std::string lai_serialize_number(
     return std::to_string(number);
 }
 
-std::string lai_serialize_decimal(
-        _In_ const double &value,
-        _In_ int precision) 
+size_t lai_serialize_number(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ uint64_t number,
+        _In_ bool negative)
+{
+    SWSS_LOG_ENTER();
+
+    char tmp[24];
+
+    size_t len = 0;
+
+    do
+    {
+        tmp[len++] = (char)('0' + (number % 10));
+
+        number /= 10;
+    }
+    while (number);
+
+    size_t total = len + (negative ? 1 : 0);
+
+    if (total >= size)
+    {
+        SWSS_LOG_THROW("buffer size %zu too small for number", size);
+    }
+
+    char *p = buffer;
+
+    if (negative)
+    {
+        *p++ = '-';
+    }
+
+    while (len)
+    {
+        *p++ = tmp[--len];
+    }
+
+    *p = 0;
+
+    return total;
+}
+
+static void lai_serialize_number_append(
+        _Inout_ std::string& s,
+        _In_ int64_t number,
+        _In_ std::true_type)
 {
     SWSS_LOG_ENTER();
 
-    std::ostringstream stream;
-    stream << std::fixed << std::setprecision(precision) << value;
+    char buffer[32];
+
+    size_t len = lai_serialize_number(buffer, sizeof(buffer),
+            number < 0 ? (uint64_t)0 - (uint64_t)number : (uint64_t)number,
+            number < 0);
+
+    s.append(buffer, len);
+}
+
+static void lai_serialize_number_append(
+        _Inout_ std::string& s,
+        _In_ uint64_t number,
+        _In_ std::false_type)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[32];
+
+    size_t len = lai_serialize_number(buffer, sizeof(buffer), number, false);
+
+    s.append(buffer, len);
+}
+
+template <typename T>
+void lai_serialize_number_append(
+        _Inout_ std::string& s,
+        _In_ const T number)
+{
+    SWSS_LOG_ENTER();
+
+    lai_serialize_number_append(s, number, std::is_signed<T>());
+}
+
+size_t lai_serialize_decimal(
+        _Out_ char *buffer,
+        _In_ size_t size,
+        _In_ double value,
+        _In_ int precision)
+{
+    SWSS_LOG_ENTER();
+
+    // same conversion std::ostream uses for std::fixed, without creating
+    // stream and locale objects for each value
+
+    int n = snprintf(buffer, size, "%.*f", precision, value);
+
+    if (n < 0 || (size_t)n + 2 >= size)
+    {
+        SWSS_LOG_THROW("buffer size %zu too small for decimal (precision %d)", size, precision);
+    }
+
+    size_t len = (size_t)n;
+
+    char *dot = NULL;
+
+    if (std::isfinite(value))
+    {
+        // decimal point follows integer digits, it may not be '.' if
+        // LC_NUMERIC was changed, stream output always uses classic locale
+
+        char *p = buffer + (buffer[0] == '-' ? 1 : 0);
+
+        while (*p >= '0' && *p <= '9')
+        {
+            p++;
+        }
+
+        if (*p)
+        {
+            *p = '.';
+
+            dot = p;
+        }
+    }
 
-    std::string str = stream.str();
-    if (str.find('.') != std::string::npos)
+    if (dot)
     {
         // remove trailing zeroes
-        str = str.substr(0, str.find_last_not_of('0') + 1);
+
+        while (buffer[len - 1] == '0')
+        {
+            len--;
+        }
+
         // if the decimal point is now the last character, add a zero at the end
-        if (str.find('.') == str.size() - 1)
+
+        if (buffer + len - 1 == dot)
         {
-            str = str + "0";
+            buffer[len++] = '0';
         }
     }
     else
     {
-        str = str + ".0";
+        buffer[len++] = '.';
+        buffer[len++] = '0';
     }
 
-    return str;
+    buffer[len] = 0;
+
+    return len;
+}
+
+std::string lai_serialize_decimal(
+        _In_ const double &value,
+        _In_ int precision)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[LAI_SERIALIZE_NUMBER_BUFFER_SIZE];
+
+    size_t len = lai_serialize_decimal(buffer, sizeof(buffer), value, precision);
+
+    return std::string(buffer, len);
 }
 
 std::string lai_serialize_string(
@@ -686,7 +797,8 @@ std::string lai_serialize_string(
 	return result;
 }
 
-std::string lai_serialize_enum(
+void lai_serialize_enum_append(
+        _Inout_ std::string& s,
         _In_ const int32_t value,
         _In_ const lai_enum_metadata_t* meta,
         _In_ const bool shortName)
@@ -695,24 +807,43 @@ std::string lai_serialize_enum(
 
     if (meta == NULL)
     {
-        return lai_serialize_number(value);
+        return lai_serialize_number_append(s, value);
+    }
+
+    auto name = laimeta::MetadataIndex::getInstance().getEnumName(meta, value, shortName);
+
+    if (name)
+    {
+        s += name;
+        return;
     }
 
     for (size_t i = 0; i < meta->valuescount; ++i)
     {
         if (meta->values[i] == value)
         {
-            if (shortName) {
-                return meta->valuesshortnames[i];
-            } else {
-                return meta->valuesnames[i];
-            }
+            s += shortName ? meta->valuesshortnames[i] : meta->valuesnames[i];
+            return;
         }
     }
 
     SWSS_LOG_WARN("enum value %d not found in enum %s", value, meta->name);
 
-    return lai_serialize_number(value);
+    lai_serialize_number_append(s, value);
+}
+
+std::string lai_serialize_enum(
+        _In_ const int32_t value,
+        _In_ const lai_enum_metadata_t* meta,
+        _In_ const bool shortName)
+{
+    SWSS_LOG_ENTER();
+
+    std::string s;
+
+    lai_serialize_enum_append(s, value, meta, shortName);
+
+    return s;
 }
 
 std::string lai_serialize_enum_v2(
@@ -726,6 +857,13 @@ std::string lai_serialize_enum_v2(
         return lai_serialize_number(value);
     }
 
+    auto name = laimeta::MetadataIndex::getInstance().getEnumName(meta, value, true);
+
+    if (name)
+    {
+        return name;
+    }
+
     for (size_t i = 0; i < meta->valuescount; ++i)
     {
         if (meta->values[i] == value)
@@ -1044,7 +1182,81 @@ std::string lai_serialize_hex_binary(
     return s;
 }
 
-std::string lai_serialize_attr_value(
+void lai_serialize_object_id_append(
+        _Inout_ std::string& s,
+        _In_ lai_object_id_t oid)
+{
+    SWSS_LOG_ENTER();
+
+    char buf[32];
+
+    int len = snprintf(buf, sizeof(buf), "oid:0x%" PRIx64, oid);
+
+    s.append(buf, (size_t)len);
+}
+
+template<typename T, typename F>
+void lai_serialize_list_append(
+        _Inout_ std::string& s,
+        _In_ const T& list,
+        _In_ bool countOnly,
+        F serialize_item)
+{
+    SWSS_LOG_ENTER();
+
+    lai_serialize_number_append(s, list.count);
+
+    if (countOnly)
+    {
+        return;
+    }
+
+    if (list.list == NULL || list.count == 0)
+    {
+        s += ":null";
+        return;
+    }
+
+    s += ':';
+
+    for (uint32_t i = 0; i < list.count; ++i)
+    {
+        if (i != 0)
+        {
+            s += ',';
+        }
+
+        serialize_item(list.list[i]);
+    }
+}
+
+template <typename T>
+void lai_serialize_number_list_append(
+        _Inout_ std::string& s,
+        _In_ const T& list,
+        _In_ bool countOnly)
+{
+    SWSS_LOG_ENTER();
+
+    lai_serialize_list_append(s, list, countOnly, [&](decltype(*list.list)& item) { lai_serialize_number_append(s, item);} );
+}
+
+template <typename T>
+void lai_serialize_range_append(
+        _Inout_ std::string& s,
+        _In_ const T& range)
+{
+    SWSS_LOG_ENTER();
+
+    lai_serialize_number_append(s, range.min);
+
+    s += ',';
+
+    lai_serialize_number_append(s, range.max);
+}
+
+void lai_serialize_attr_value_append(
+        _Inout_ std::string& s,
         _In_ const lai_attr_metadata_t& meta,
         _In_ const lai_attribute_t &attr,
         _In_ const bool countOnly,
@@ -1052,80 +1264,123 @@ std::string lai_serialize_attr_value(
 {
     SWSS_LOG_ENTER();
 
+    char buffer[LAI_SERIALIZE_NUMBER_BUFFER_SIZE];
+
     switch (meta.attrvaluetype)
     {
         case LAI_ATTR_VALUE_TYPE_BOOL:
-            return lai_serialize_bool(attr.value.booldata);
+            s += attr.value.booldata ? "true" : "false";
+            break;
 
         case LAI_ATTR_VALUE_TYPE_CHARDATA:
-            return lai_serialize_chardata(attr.value.chardata);
+            s.append(attr.value.chardata, strnlen(attr.value.chardata, CHAR_LEN));
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT8:
-            return lai_serialize_number(attr.value.u8);
+            lai_serialize_number_append(s, attr.value.u8);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT8:
-            return lai_serialize_number(attr.value.s8);
+            lai_serialize_number_append(s, attr.value.s8);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT16:
-            return lai_serialize_number(attr.value.u16);
+            lai_serialize_number_append(s, attr.value.u16);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT16:
-            return lai_serialize_number(attr.value.s16);
+            lai_serialize_number_append(s, attr.value.s16);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT32:
-            return lai_serialize_number(attr.value.u32);
+            lai_serialize_number_append(s, attr.value.u32);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT32:
-            return lai_serialize_enum(attr.value.s32, meta.enummetadata, shortName);
+            lai_serialize_enum_append(s, attr.value.s32, meta.enummetadata, shortName);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT64:
-            return lai_serialize_number(attr.value.u64);
+            lai_serialize_number_append(s, attr.value.u64);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT64:
-            return lai_serialize_number(attr.value.s64);
+            lai_serialize_number_append(s, attr.value.s64);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_DOUBLE:
-            return lai_serialize_decimal(attr.value.d64);
+            s.append(buffer, lai_serialize_decimal(buffer, sizeof(buffer), attr.value.d64, 2));
+            break;
 
         case LAI_ATTR_VALUE_TYPE_POINTER:
-            return lai_serialize_pointer(attr.value.ptr);
+            s.append(buffer, (size_t)snprintf(buffer, sizeof(buffer), "0x%" PRIx64, (uint64_t)attr.value.ptr));
+            break;
 
         case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
-            return lai_serialize_object_id(attr.value.oid);
+            lai_serialize_object_id_append(s, attr.value.oid);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
-            return lai_serialize_oid_list(attr.value.objlist, countOnly);
+            lai_serialize_list_append(s, attr.value.objlist, countOnly,
+                    [&](lai_object_id_t item) { lai_serialize_object_id_append(s, item);} );
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT8_LIST:
-            return lai_serialize_number_list(attr.value.u8list, countOnly);
+            lai_serialize_number_list_append(s, attr.value.u8list, countOnly);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT8_LIST:
-            return lai_serialize_number_list(attr.value.s8list, countOnly);
+            lai_serialize_number_list_append(s, attr.value.s8list, countOnly);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT16_LIST:
-            return lai_serialize_number_list(attr.value.u16list, countOnly);
+            lai_serialize_number_list_append(s, attr.value.u16list, countOnly);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT16_LIST:
-            return lai_serialize_number_list(attr.value.s16list, countOnly);
+            lai_serialize_number_list_append(s, attr.value.s16list, countOnly);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT32_LIST:
-            return lai_serialize_number_list(attr.value.u32list, countOnly);
+            lai_serialize_number_list_append(s, attr.value.u32list, countOnly);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT32_LIST:
-            return lai_serialize_enum_list(attr.value.s32list, meta.enummetadata, countOnly);
+            lai_serialize_list_append(s, attr.value.s32list, countOnly,
+                    [&](int32_t item) { lai_serialize_enum_append(s, item, meta.enummetadata, false);} );
+            break;
 
         case LAI_ATTR_VALUE_TYPE_UINT32_RANGE:
-            return lai_serialize_range(attr.value.u32range);
+            lai_serialize_range_append(s, attr.value.u32range);
+            break;
 
         case LAI_ATTR_VALUE_TYPE_INT32_RANGE:
-            return lai_serialize_range(attr.value.s32range);
+            lai_serialize_range_append(s, attr.value.s32range);
+            break;
 
         default:
             SWSS_LOG_THROW("FATAL: invalid serialization type %d", meta.attrvaluetype);
     }
 }
 
-std::string lai_serialize_stat_value(
+std::string lai_serialize_attr_value(
+        _In_ const lai_attr_metadata_t& meta,
+        _In_ const lai_attribute_t &attr,
+        _In_ const bool countOnly,
+        _In_ const bool shortName)
+{
+    SWSS_LOG_ENTER();
+
+    std::string s;
+
+    lai_serialize_attr_value_append(s, meta, attr, countOnly, shortName);
+
+    return s;
+}
+
+size_t lai_serialize_stat_value(
+        _Out_ char *buffer,
+        _In_ size_t size,
         _In_ const lai_stat_metadata_t &meta,
         _In_ const lai_stat_value_t &stat)
 {
@@ -1134,16 +1389,18 @@ std::string lai_serialize_stat_value(
     switch (meta.statvaluetype)
     {
         case LAI_STAT_VALUE_TYPE_UINT32:
-            return lai_serialize_number(stat.u32);
+            return lai_serialize_number(buffer, size, stat.u32, false);
 
         case LAI_STAT_VALUE_TYPE_INT32:
-            return lai_serialize_number(stat.s32);
+            return lai_serialize_number(buffer, size,
+                    stat.s32 < 0 ? (uint64_t)0 - (uint64_t)stat.s32 : (uint64_t)stat.s32, stat.s32 < 0);
 
         case LAI_STAT_VALUE_TYPE_UINT64:
-            return lai_serialize_number(stat.u64);
+            return lai_serialize_number(buffer, size, stat.u64, false);
 
         case LAI_STAT_VALUE_TYPE_INT64:
-            return lai_serialize_number(stat.s64);
+            return lai_serialize_number(buffer, size,
+                    stat.s64 < 0 ? (uint64_t)0 - (uint64_t)stat.s64 : (uint64_t)stat.s64, stat.s64 < 0);
 
         case LAI_STAT_VALUE_TYPE_DOUBLE:
         {
@@ -1156,7 +1413,7 @@ std::string lai_serialize_stat_value(
             {
                 precision = 18;
             }
-            return lai_serialize_decimal(stat.d64, precision);
+            return lai_serialize_decimal(buffer, size, stat.d64, precision);
         }
 
         default:
@@ -1164,6 +1421,31 @@ std::string lai_serialize_stat_value(
     }
 }
 
+void lai_serialize_stat_value_append(
+        _Inout_ std::string& s,
+        _In_ const lai_stat_metadata_t &meta,
+        _In_ const lai_stat_value_t &stat)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[LAI_SERIALIZE_NUMBER_BUFFER_SIZE];
+
+    s.append(buffer, lai_serialize_stat_value(buffer, sizeof(buffer), meta, stat));
+}
+
+std::string lai_serialize_stat_value(
+        _In_ const lai_stat_metadata_t &meta,
+        _In_ const lai_stat_value_t &stat)
+{
+    SWSS_LOG_ENTER();
+
+    char buffer[LAI_SERIALIZE_NUMBER_BUFFER_SIZE];
+
+    size_t len = lai_serialize_stat_value(buffer, sizeof(buffer), meta, stat);
+
+    return std::string(buffer, len);
+}
+
 std::string lai_serialize_object_meta_key(
         _In_ const lai_object_meta_key_t& meta_key)
 {
@@ -1316,16 +1598,170 @@ void lai_deserialize_number(
     lai_deserialize_number<uint32_t>(s, number, hex);
 }
 
+/**
+ * @brief Parse plain "[-]digits[.digits]" decimal.
+ *
+ * When mantissa and power of ten are both exactly representable as double
+ * single division is correctly rounded, so result is identical to strtod.
+ * Returns false for any other input, and then caller should use strtod.
+ */
+static bool lai_deserialize_decimal_fast(
+        _In_ const char *s,
+        _Out_ double& value)
+{
+    SWSS_LOG_ENTER();
+
+    static const double pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    bool negative = (*s == '-');
+
+    if (negative)
+    {
+        s++;
+    }
+
+    uint64_t mantissa = 0;
+
+    int digits = 0;
+    int fraction = -1;
+
+    for (; *s; s++)
+    {
+        if (*s == '.' && fraction < 0)
+        {
+            fraction = 0;
+            continue;
+        }
+
+        if (*s < '0' || *s > '9' || digits >= 19)
+        {
+            return false;
+        }
+
+        mantissa = mantissa * 10 + (uint64_t)(*s - '0');
+
+        digits++;
+
+        if (fraction >= 0)
+        {
+            fraction++;
+        }
+    }
+
+    if (digits == 0 || fraction == 0 || mantissa > (1ULL << 53) || fraction > 22)
+    {
+        return false;
+    }
+
+    value = (double)mantissa;
+
+    if (fraction > 0)
+    {
+        value /= pow10[fraction];
+    }
+
+    if (negative)
+    {
+        value = -value;
+    }
+
+    return true;
+}
+
 void lai_deserialize_decimal(
         _In_ const std::string& s,
         _Out_ double& value)
 {
     SWSS_LOG_ENTER();
 
+    if (lai_deserialize_decimal_fast(s.c_str(), value))
+    {
+        return;
+    }
+
     char *endptr = NULL;
     value = strtod(s.c_str(), &endptr);
 }
 
+/**
+ * @brief Parse plain decimal digits, falls back to strtoull on anything else.
+ */
+static void lai_deserialize_u64_fast(
+        _In_ const std::string& s,
+        _Out_ uint64_t& number)
+{
+    SWSS_LOG_ENTER();
+
+    size_t len = s.length();
+
+    if (len > 0 && len < 20)
+    {
+        uint64_t n = 0;
+
+        size_t idx = 0;
+
+        for (; idx < len; idx++)
+        {
+            char c = s[idx];
+
+            if (c < '0' || c > '9')
+            {
+                break;
+            }
+
+            n = n * 10 + (uint64_t)(c - '0');
+        }
+
+        if (idx == len)
+        {
+            number = n;
+            return;
+        }
+    }
+
+    lai_deserialize_number(s, number);
+}
+
+void lai_deserialize_stat_value(
+        _In_ const lai_stat_metadata_t& meta,
+        _In_ const std::string& s,
+        _Out_ lai_stat_value_t& stat)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t number;
+
+    switch (meta.statvaluetype)
+    {
+        case LAI_STAT_VALUE_TYPE_UINT32:
+            lai_deserialize_u64_fast(s, number);
+            stat.u32 = (uint32_t)number;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT32:
+            lai_deserialize_number(s, stat.s32);
+            break;
+
+        case LAI_STAT_VALUE_TYPE_UINT64:
+            lai_deserialize_u64_fast(s, stat.u64);
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT64:
+            lai_deserialize_number(s, stat.s64);
+            break;
+
+        case LAI_STAT_VALUE_TYPE_DOUBLE:
+            lai_deserialize_decimal(s, stat.d64);
+            break;
+
+        default:
+            SWSS_LOG_THROW("FATAL: invalid deserialization type %d", meta.statvaluetype);
+    }
+}
+
 void lai_deserialize_string(
       _In_ const std::string& s,
       _Out_ lai_s8_list_t &value)
@@ -1346,6 +1782,11 @@ void lai_deserialize_enum(
         return lai_deserialize_number(s, value);
     }
 
+    if (laimeta::MetadataIndex::getInstance().getEnumValue(meta, s, value))
+    {
+        return;
+    }
+
     for (size_t i = 0; i < meta->valuescount; ++i)
     {
         if (strcmp(s.c_str(), meta->valuesnames[i]) == 0 ||
@@ -1747,7 +2188,12 @@ void lai_deserialize_attr_id(
         SWSS_LOG_THROW("meta pointer is null");
     }
 
-    auto m = lai_metadata_get_attr_metadata_by_attr_id_name(s.c_str());
+    auto m = laimeta::MetadataIndex::getInstance().getAttrMetadata(s);
+
+    if (m == NULL)
+    {
+        m = lai_metadata_get_attr_metadata_by_attr_id_name(s.c_str());
+    }
 
     if (m == NULL)
     {
@@ -1781,7 +2227,12 @@ void lai_deserialize_stat_id(
         SWSS_LOG_THROW("meta pointer is null");
     }
 
-    auto m = lai_metadata_get_stat_metadata_by_stat_id_name(s.c_str());
+    auto m = laimeta::MetadataIndex::getInstance().getStatMetadata(s);
+
+    if (m == NULL)
+    {
+        m = lai_metadata_get_stat_metadata_by_stat_id_name(s.c_str());
+    }
 
     if (m == NULL)
     {
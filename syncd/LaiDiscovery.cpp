@@ -4,6 +4,12 @@
 
 #include "meta/lai_serialize.h"
 
+#ifdef LAIVS
+#include "laivs.h"
+#endif
+
+#include <vector>
+
 using namespace syncd;
 
 /**
@@ -208,6 +214,53 @@ void LaiDiscovery::discover(
             }
         }
     }
+
+#ifdef LAIVS
+
+    if (mk.objecttype == LAI_OBJECT_TYPE_LINECARD)
+    {
+        /*
+         * Virtual linecard creates objects which are not referenced by any
+         * linecard attribute, they are only reported by custom attribute.
+         */
+
+        std::vector<lai_object_id_t> list(LAI_DISCOVERY_LIST_MAX_ELEMENTS);
+
+        lai_attribute_t attr;
+
+        attr.id = LAI_VS_LINECARD_ATTR_INTERNAL_OBJECT_LIST;
+        attr.value.objlist.count = (uint32_t)list.size();
+        attr.value.objlist.list = list.data();
+
+        lai_status_t status = m_lai->get(mk.objecttype, rid, 1, &attr);
+
+        if (status == LAI_STATUS_BUFFER_OVERFLOW)
+        {
+            list.resize(attr.value.objlist.count);
+
+            attr.value.objlist.list = list.data();
+
+            status = m_lai->get(mk.objecttype, rid, 1, &attr);
+        }
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("internal object list: %s on %s",
+                lai_serialize_status(status).c_str(),
+                lai_serialize_object_id(rid).c_str());
+
+            return;
+        }
+
+        SWSS_LOG_NOTICE("internal objects count: %u", attr.value.objlist.count);
+
+        for (uint32_t i = 0; i < attr.value.objlist.count; ++i)
+        {
+            discover(list[i], discovered); // recursion
+        }
+    }
+
+#endif
 }
 
 std::set<lai_object_id_t> LaiDiscovery::discover(
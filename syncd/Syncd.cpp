@@ -179,6 +179,9 @@ lai_status_t Syncd::processSingleEvent(
     if (op == REDIS_ASIC_STATE_COMMAND_GET)
         return processQuadEvent(LAI_COMMON_API_GET, kco);
 
+    if (op == REDIS_ASIC_STATE_COMMAND_BULK_GET)
+        return processBulkGetEvent(kco);
+
     if (op == REDIS_ASIC_STATE_COMMAND_ATTR_CAPABILITY_QUERY)
         return processAttrCapabilityQuery(kco);
 
@@ -758,6 +761,113 @@ lai_status_t Syncd::processQuadEvent(
     return status;
 }
 
+lai_status_t Syncd::processBulkGetEvent(
+    _In_ const swss::KeyOpFieldsValuesTuple& kco)
+{
+    SWSS_LOG_ENTER();
+
+    const std::string& key = kfvKey(kco);
+
+    // key is OBJECT_TYPE:object_count
+
+    lai_object_type_t objectType;
+    lai_deserialize_object_type(key.substr(0, key.find(":")), objectType);
+
+    auto info = lai_metadata_get_object_type_info(objectType);
+
+    if (info == NULL || info->isnonobjectid)
+    {
+        SWSS_LOG_THROW("bulk get is not supported on %s", key.c_str());
+    }
+
+    auto& values = kfvFieldsValues(kco);
+
+    std::vector<swss::FieldValueTuple> entries;
+
+    /*
+     * Attribute list and entry are reused for all objects.
+     */
+
+    std::vector<swss::FieldValueTuple> attrs;
+    std::vector<swss::FieldValueTuple> entry;
+
+    LaiAttributeList list(objectType, attrs, false);
+
+    lai_status_t status = LAI_STATUS_SUCCESS;
+
+    for (size_t pos = 0; pos < values.size(); )
+    {
+        const std::string& strObjectId = fvField(values[pos]);
+
+        size_t count = std::stoul(fvValue(values[pos]));
+
+        pos++;
+
+        if (pos + count > values.size())
+        {
+            SWSS_LOG_THROW("bulk get object %s is truncated", strObjectId.c_str());
+        }
+
+        attrs.assign(values.begin() + pos, values.begin() + pos + count);
+
+        pos += count;
+
+        list.reset(objectType, attrs, false);
+
+        lai_attribute_t* attr_list = list.get_attr_list();
+        uint32_t attr_count = list.get_attr_count();
+
+        lai_status_t objectStatus = processOidGet(objectType, strObjectId, attr_count, attr_list);
+
+        entry.clear();
+
+        if (objectStatus == LAI_STATUS_SUCCESS)
+        {
+            lai_object_id_t objectVid;
+            lai_deserialize_object_id(strObjectId, objectVid);
+
+            lai_object_id_t linecardVid = VidManager::linecardIdQuery(objectVid);
+
+            m_translator->translateRidToVid(objectType, linecardVid, attr_count, attr_list);
+
+            LaiAttributeList::serialize_attr_list(objectType, attr_count, attr_list, false, entry);
+        }
+        else if (objectStatus == LAI_STATUS_BUFFER_OVERFLOW)
+        {
+            /*
+             * Serialize only list counts, so caller can resize buffers.
+             */
+
+            LaiAttributeList::serialize_attr_list(objectType, attr_count, attr_list, true, entry);
+
+            if (status == LAI_STATUS_SUCCESS)
+            {
+                status = LAI_STATUS_BUFFER_OVERFLOW;
+            }
+        }
+        else
+        {
+            SWSS_LOG_INFO("bulk get for %s returned status: %s",
+                strObjectId.c_str(),
+                lai_serialize_status(objectStatus).c_str());
+
+            status = LAI_STATUS_FAILURE;
+        }
+
+        entries.emplace_back(lai_serialize_status(objectStatus), std::to_string(entry.size()));
+
+        entries.insert(entries.end(), entry.begin(), entry.end());
+    }
+
+    std::string strStatus = lai_serialize_status(status);
+
+    SWSS_LOG_INFO("sending response for bulk GET api with status: %s", strStatus.c_str());
+
+    m_selectableChannel->set(strStatus, entries, REDIS_ASIC_STATE_COMMAND_GETRESPONSE);
+
+    return status;
+}
+
 lai_status_t Syncd::processOid(
     _In_ lai_object_type_t objectType,
     _In_ const std::string& strObjectId,
@@ -1106,7 +1216,12 @@ void Syncd::sendGetResponse(
 {
     SWSS_LOG_ENTER();
 
-    std::vector<swss::FieldValueTuple> entry;
+    /*
+     * Response entry is kept between calls, so strings allocated for
+     * previous response are reused for this one.
+     */
+
+    auto& entry = m_getResponseEntry;
 
     if (status == LAI_STATUS_SUCCESS)
     {
@@ -1116,17 +1231,33 @@ void Syncd::sendGetResponse(
          * Normal serialization + translate RID to VID.
          */
 
-        entry = LaiAttributeList::serialize_attr_list(
+        LaiAttributeList::serialize_attr_list(
+            objectType,
+            attr_count,
+            attr_list,
+            false,
+            entry);
+    }
+    else if (status == LAI_STATUS_BUFFER_OVERFLOW)
+    {
+        /*
+         * Serialize only list counts, so caller can resize buffers.
+         */
+
+        LaiAttributeList::serialize_attr_list(
             objectType,
             attr_count,
             attr_list,
-            false);
+            true,
+            entry);
     }
     else
     {
         /*
          * Some other error, don't send attributes at all.
          */
+
+        entry.clear();
     }
 
     for (const auto& e : entry)
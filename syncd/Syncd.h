@@ -119,6 +119,15 @@ namespace syncd
             _In_ lai_common_api_t api,
             _In_ const swss::KeyOpFieldsValuesTuple& kco);
 
+        /**
+         * @brief Process bulk GET.
+         *
+         * All objects are processed in one pass and single response with
+         * status and attributes of each object is sent back.
+         */
+        lai_status_t processBulkGetEvent(
+            _In_ const swss::KeyOpFieldsValuesTuple& kco);
+
         lai_status_t processBulkQuadEvent(
             _In_ lai_common_api_t api,
             _In_ const swss::KeyOpFieldsValuesTuple& kco);
@@ -381,5 +390,11 @@ namespace syncd
         std::mutex m_mtxAlarmTable;
         std::unique_ptr<swss::Table> m_curalarmtable;
         lai_oper_status_t m_linecardState;
+
+        /**
+         * @brief Reused by sendGetResponse, only accessed from main event
+         * loop thread.
+         */
+        std::vector<swss::FieldValueTuple> m_getResponseEntry;
     };
 }
@@ -0,0 +1,493 @@
+#include "lib/inc/BinaryRecordReader.h"
+#include "lib/inc/VirtualObjectIdManager.h"
+
+#include "meta/lai_serialize.h"
+#include "meta/LaiAttributeList.h"
+#include "meta/Meta.h"
+
+#include "vslib/inc/VirtualLinecardLaiInterface.h"
+#include "vslib/inc/LinecardConfigContainer.h"
+#include "vslib/inc/Signal.h"
+#include "vslib/inc/laivs.h"
+
+#include "swss/logger.h"
+
+#include <unistd.h>
+#include <getopt.h>
+#include <inttypes.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <functional>
+
+/*
+ * Recording tool.
+ *
+ * Converts binary recordings produced by lairedis recorder to text format and
+ * replays recordings (text or binary) against virtual linecard, so production
+ * load can be reproduced offline.
+ */
+
+using namespace laimeta;
+
+static std::vector<std::string> tokenize(
+        _In_ const std::string& line,
+        _In_ char delim)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> tokens;
+
+    size_t start = 0;
+
+    while (true)
+    {
+        size_t end = line.find(delim, start);
+
+        if (end == std::string::npos)
+        {
+            tokens.push_back(line.substr(start));
+            break;
+        }
+
+        tokens.push_back(line.substr(start, end - start));
+
+        start = end + 1;
+    }
+
+    return tokens;
+}
+
+static void forEachLine(
+        _In_ const std::string& fileName,
+        _In_ std::function<void(const std::string&)> callback)
+{
+    SWSS_LOG_ENTER();
+
+    if (lairedis::BinaryRecordReader::isBinaryRecording(fileName))
+    {
+        std::ifstream file(fileName, std::ifstream::in | std::ifstream::binary);
+
+        lairedis::BinaryRecordReader reader(file);
+
+        std::string line;
+
+        while (reader.getline(line))
+        {
+            callback(line);
+        }
+
+        return;
+    }
+
+    std::ifstream file(fileName);
+
+    if (!file.is_open())
+    {
+        SWSS_LOG_THROW("failed to open recording file %s", fileName.c_str());
+    }
+
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        callback(line);
+    }
+}
+
+class RecordReplayer
+{
+    public:
+
+        RecordReplayer(
+                _In_ laivs::lai_vs_linecard_type_t linecardType)
+        {
+            SWSS_LOG_ENTER();
+
+            m_signal = std::make_shared<laivs::Signal>();
+
+            m_eventQueue = std::make_shared<laivs::EventQueue>(m_signal);
+
+            auto sc = std::make_shared<laivs::LinecardConfig>();
+
+            sc->m_linecardType = linecardType;
+            sc->m_bootType = laivs::LAI_VS_BOOT_TYPE_COLD;
+            sc->m_linecardIndex = 0;
+            sc->m_eventQueue = m_eventQueue;
+
+            auto scc = std::make_shared<laivs::LinecardConfigContainer>();
+
+            scc->insert(sc);
+
+            m_vsLai = std::make_shared<laivs::VirtualLinecardLaiInterface>(scc);
+
+            m_meta = std::make_shared<Meta>(m_vsLai);
+
+            m_vsLai->setMeta(m_meta);
+
+            m_replayed = 0;
+            m_failed = 0;
+            m_skipped = 0;
+        }
+
+    public:
+
+        void replayLine(
+                _In_ const std::string& line)
+        {
+            SWSS_LOG_ENTER();
+
+            // timestamp|op|...
+
+            auto tokens = tokenize(line, '|');
+
+            if (tokens.size() < 3)
+            {
+                m_skipped++;
+                return;
+            }
+
+            const std::string& op = tokens[1];
+
+            lai_status_t status;
+
+            if (op == "c" || op == "r" || op == "s" || op == "g")
+            {
+                status = replayQuad(op, tokens);
+            }
+            else if (op == "q" && (tokens[2] == "get_stats" || tokens[2] == "clear_stats"))
+            {
+                status = replayStats(tokens);
+            }
+            else
+            {
+                // responses, notifications and comments are not replayed
+
+                m_skipped++;
+                return;
+            }
+
+            m_replayed++;
+
+            if (status != LAI_STATUS_SUCCESS)
+            {
+                m_failed++;
+
+                SWSS_LOG_WARN("replay failed with %s: %s", lai_serialize_status(status).c_str(), line.c_str());
+            }
+        }
+
+        void printSummary() const
+        {
+            SWSS_LOG_ENTER();
+
+            std::cout << "replayed: " << m_replayed
+                << ", failed: " << m_failed
+                << ", skipped: " << m_skipped << std::endl;
+        }
+
+    private:
+
+        lai_object_id_t translateVidToRid(
+                _In_ lai_object_id_t vid) const
+        {
+            SWSS_LOG_ENTER();
+
+            if (vid == LAI_NULL_OBJECT_ID)
+            {
+                return LAI_NULL_OBJECT_ID;
+            }
+
+            auto it = m_vidToRid.find(vid);
+
+            if (it == m_vidToRid.end())
+            {
+                SWSS_LOG_THROW("failed to find VID %s in replayed objects",
+                        lai_serialize_object_id(vid).c_str());
+            }
+
+            return it->second;
+        }
+
+        void translateAttributes(
+                _In_ lai_object_type_t objectType,
+                _In_ uint32_t attr_count,
+                _Inout_ lai_attribute_t *attr_list) const
+        {
+            SWSS_LOG_ENTER();
+
+            for (uint32_t idx = 0; idx < attr_count; idx++)
+            {
+                auto meta = lai_metadata_get_attr_metadata(objectType, attr_list[idx].id);
+
+                if (meta == NULL)
+                {
+                    SWSS_LOG_THROW("failed to get metadata for attr %d", attr_list[idx].id);
+                }
+
+                auto& value = attr_list[idx].value;
+
+                switch (meta->attrvaluetype)
+                {
+                    case LAI_ATTR_VALUE_TYPE_OBJECT_ID:
+                        value.oid = translateVidToRid(value.oid);
+                        break;
+
+                    case LAI_ATTR_VALUE_TYPE_OBJECT_LIST:
+
+                        for (uint32_t i = 0; value.objlist.list && i < value.objlist.count; i++)
+                        {
+                            value.objlist.list[i] = translateVidToRid(value.objlist.list[i]);
+                        }
+
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+
+        lai_status_t replayQuad(
+                _In_ const std::string& op,
+                _In_ const std::vector<std::string>& tokens)
+        {
+            SWSS_LOG_ENTER();
+
+            lai_object_meta_key_t metaKey;
+
+            lai_deserialize_object_meta_key(tokens[2], metaKey);
+
+            lai_object_type_t objectType = metaKey.objecttype;
+
+            lai_object_id_t vid = metaKey.objectkey.key.object_id;
+
+            std::vector<swss::FieldValueTuple> values;
+
+            for (size_t idx = 3; idx < tokens.size(); idx++)
+            {
+                size_t pos = tokens[idx].find('=');
+
+                if (pos == std::string::npos)
+                {
+                    SWSS_LOG_THROW("invalid attribute token: %s", tokens[idx].c_str());
+                }
+
+                values.emplace_back(tokens[idx].substr(0, pos), tokens[idx].substr(pos + 1));
+            }
+
+            LaiAttributeList list(objectType, values, false);
+
+            lai_attribute_t *attr_list = list.get_attr_list();
+
+            uint32_t attr_count = list.get_attr_count();
+
+            if (op == "c")
+            {
+                translateAttributes(objectType, attr_count, attr_list);
+
+                lai_object_id_t linecardRid = LAI_NULL_OBJECT_ID;
+
+                if (objectType != LAI_OBJECT_TYPE_LINECARD)
+                {
+                    linecardRid = translateVidToRid(lairedis::VirtualObjectIdManager::linecardIdQuery(vid));
+                }
+
+                lai_object_id_t rid;
+
+                lai_status_t status = m_meta->create(objectType, &rid, linecardRid, attr_count, attr_list);
+
+                if (status == LAI_STATUS_SUCCESS)
+                {
+                    m_vidToRid[vid] = rid;
+                }
+
+                return status;
+            }
+
+            lai_object_id_t rid = translateVidToRid(vid);
+
+            if (op == "r")
+            {
+                lai_status_t status = m_meta->remove(objectType, rid);
+
+                if (status == LAI_STATUS_SUCCESS)
+                {
+                    m_vidToRid.erase(vid);
+                }
+
+                return status;
+            }
+
+            if (op == "s")
+            {
+                if (attr_count != 1)
+                {
+                    SWSS_LOG_THROW("expected 1 attribute for set, got %u", attr_count);
+                }
+
+                translateAttributes(objectType, attr_count, attr_list);
+
+                return m_meta->set(objectType, rid, attr_list);
+            }
+
+            return m_meta->get(objectType, rid, attr_count, attr_list);
+        }
+
+        lai_status_t replayStats(
+                _In_ const std::vector<std::string>& tokens)
+        {
+            SWSS_LOG_ENTER();
+
+            // q|get_stats|key|STAT=|STAT=
+
+            if (tokens.size() < 4)
+            {
+                return LAI_STATUS_INVALID_PARAMETER;
+            }
+
+            lai_object_meta_key_t metaKey;
+
+            lai_deserialize_object_meta_key(tokens[3], metaKey);
+
+            std::vector<lai_stat_id_t> ids;
+
+            for (size_t idx = 4; idx < tokens.size(); idx++)
+            {
+                const lai_stat_metadata_t *meta;
+
+                lai_deserialize_stat_id(tokens[idx].substr(0, tokens[idx].find('=')), &meta);
+
+                ids.push_back(meta->statid);
+            }
+
+            lai_object_id_t rid = translateVidToRid(metaKey.objectkey.key.object_id);
+
+            if (tokens[2] == "clear_stats")
+            {
+                return m_meta->clearStats(metaKey.objecttype, rid, (uint32_t)ids.size(), ids.data());
+            }
+
+            std::vector<lai_stat_value_t> counters(ids.size());
+
+            return m_meta->getStats(metaKey.objecttype, rid, (uint32_t)ids.size(), ids.data(), counters.data());
+        }
+
+    private:
+
+        std::shared_ptr<laivs::Signal> m_signal;
+
+        std::shared_ptr<laivs::EventQueue> m_eventQueue;
+
+        std::shared_ptr<laivs::VirtualLinecardLaiInterface> m_vsLai;
+
+        std::shared_ptr<Meta> m_meta;
+
+        std::map<lai_object_id_t, lai_object_id_t> m_vidToRid;
+
+        uint64_t m_replayed;
+
+        uint64_t m_failed;
+
+        uint64_t m_skipped;
+};
+
+static void printUsage()
+{
+    SWSS_LOG_ENTER();
+
+    std::cout << "Usage: lairecord [-r] [-t linecardType] [-h] recordfile [recordfile ...]" << std::endl << std::endl;
+    std::cout << "    -r --replay" << std::endl;
+    std::cout << "        Replay recording against virtual linecard instead of printing it as text" << std::endl;
+    std::cout << "    -t --linecardType type" << std::endl;
+    std::cout << "        Virtual linecard type used for replay, default " << LAI_VALUE_VS_LINECARD_TYPE_P230C << std::endl;
+    std::cout << "    -h --help" << std::endl;
+    std::cout << "        Print out this message" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    swss::Logger::getInstance().setMinPrio(swss::Logger::SWSS_NOTICE);
+
+    SWSS_LOG_ENTER();
+
+    static struct option long_options[] =
+    {
+        { "replay",       no_argument,       0, 'r' },
+        { "linecardType", required_argument, 0, 't' },
+        { "help",         no_argument,       0, 'h' },
+        { 0,              0,                 0,  0  }
+    };
+
+    bool replay = false;
+
+    std::string linecardTypeStr = LAI_VALUE_VS_LINECARD_TYPE_P230C;
+
+    while (true)
+    {
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "rt:h", long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+            case 'r':
+                replay = true;
+                break;
+
+            case 't':
+                linecardTypeStr = std::string(optarg);
+                break;
+
+            case 'h':
+                printUsage();
+                exit(EXIT_SUCCESS);
+
+            default:
+                SWSS_LOG_ERROR("getopt failure");
+                printUsage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (optind >= argc)
+    {
+        printUsage();
+        exit(EXIT_FAILURE);
+    }
+
+    if (!replay)
+    {
+        for (int idx = optind; idx < argc; idx++)
+        {
+            forEachLine(argv[idx], [](const std::string& line) { std::cout << line << std::endl; });
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    laivs::lai_vs_linecard_type_t linecardType;
+
+    if (!laivs::LinecardConfig::parseLinecardType(linecardTypeStr.c_str(), linecardType))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    RecordReplayer replayer(linecardType);
+
+    for (int idx = optind; idx < argc; idx++)
+    {
+        forEachLine(argv[idx], [&](const std::string& line) { replayer.replayLine(line); });
+    }
+
+    replayer.printSummary();
+
+    return EXIT_SUCCESS;
+}
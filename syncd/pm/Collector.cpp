@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <math.h>
+#include <string.h>
 
 #include "Collector.h"
 
@@ -208,3 +209,152 @@ double Collector::convertdBm2MilliWatt(double x)
     return pow(10.0, (x / 10.0));
 }
 
+
+/*
+ * Fast dBm/mW conversion for batches of power gauges.
+ *
+ * 10^(x/10) is computed as 2^n * 2^f with n rounded and 2^f evaluated by
+ * polynomial, log10 by splitting value to exponent and mantissa in range
+ * [sqrt(2)/2, sqrt(2)) and evaluating atanh series on mantissa. Relative
+ * error of mW value and absolute error of dBm value are below 1e-10, far
+ * below precision in which gauges are reported. Same code is instantiated
+ * for scalars and for two lane GCC vectors (SSE2/NEON), values out of
+ * approximation range are recomputed by exact functions afterwards.
+ */
+
+#define LOG2_10_DIV_10 (0.33219280948873623479) // log2(10) / 10
+#define LN2 (0.69314718055994530942)
+#define TEN_DIV_LN10 (4.34294481903251827651) // 10 / ln(10)
+#define FAST_EXP2_LIMIT (1000.0)
+#define ROUND_MAGIC (6755399441055744.0) // 1.5 * 2^52
+#define MIN_MILLIWATT (1.0e-20)
+#define MAX_MILLIWATT (1.0e300)
+
+typedef double v2df_t __attribute__((vector_size(16)));
+typedef uint64_t v2du_t __attribute__((vector_size(16)));
+
+template<typename D, typename U>
+static inline D fast_dBm2MilliWatt(
+        _In_ D x)
+{
+    D y = x * LOG2_10_DIV_10;
+
+    y = (y < -FAST_EXP2_LIMIT) ? -FAST_EXP2_LIMIT : y;
+    y = (y > FAST_EXP2_LIMIT) ? FAST_EXP2_LIMIT : y;
+
+    // round to nearest, integer ends up in low bits of shifted mantissa
+
+    D shifted = y + ROUND_MAGIC;
+    D n = shifted - ROUND_MAGIC;
+    D f = (y - n) * LN2; // |f| <= ln(2)/2
+
+    D r = 1.0 + f * (1.0 + f * (1.0 / 2 + f * (1.0 / 6 + f * (1.0 / 24 + f * (1.0 / 120 +
+                    f * (1.0 / 720 + f * (1.0 / 5040 + f * (1.0 / 40320 + f * (1.0 / 362880)))))))));
+
+    U bits;
+    memcpy(&bits, &shifted, sizeof(bits));
+
+    bits = (bits + 1023) << 52;
+
+    D scale;
+    memcpy(&scale, &bits, sizeof(scale));
+
+    return r * scale;
+}
+
+template<typename D, typename U>
+static inline D fast_MilliWatt2dBm(
+        _In_ D p)
+{
+    U bits;
+    memcpy(&bits, &p, sizeof(bits));
+
+    // exponent is incremented when mantissa is >= sqrt(2)
+
+    U ebits = (bits + 0x00095f619980c433ULL) >> 52;
+    U mbits = bits - ((ebits - 1023) << 52);
+
+    D m;
+    memcpy(&m, &mbits, sizeof(m));
+
+    // exponent to double without integer conversion
+
+    U dbits = ebits | 0x4330000000000000ULL;
+
+    D e;
+    memcpy(&e, &dbits, sizeof(e));
+
+    e = e - (4503599627370496.0 + 1023.0);
+
+    D t = (m - 1.0) / (m + 1.0);
+    D t2 = t * t;
+
+    D lm = 2.0 * t * (1.0 + t2 * (1.0 / 3 + t2 * (1.0 / 5 + t2 * (1.0 / 7 + t2 * (1.0 / 9 +
+                        t2 * (1.0 / 11 + t2 * (1.0 / 13)))))));
+
+    return TEN_DIV_LN10 * (e * LN2 + lm);
+}
+
+void Collector::convertdBm2MilliWatt(
+    _In_ const double *x,
+    _Out_ double *p,
+    _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        v2df_t v;
+        memcpy(&v, &x[i], sizeof(v));
+
+        v = fast_dBm2MilliWatt<v2df_t, v2du_t>(v);
+        memcpy(&p[i], &v, sizeof(v));
+    }
+
+    for (; i < count; i++)
+    {
+        p[i] = fast_dBm2MilliWatt<double, uint64_t>(x[i]);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (!(fabs(x[i] * LOG2_10_DIV_10) < FAST_EXP2_LIMIT))
+        {
+            p[i] = pow(10.0, (x[i] / 10.0));
+        }
+    }
+}
+
+void Collector::convertMilliWatt2dBm(
+    _In_ const double *p,
+    _Out_ double *x,
+    _In_ size_t count)
+{
+    SWSS_LOG_ENTER();
+
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2)
+    {
+        v2df_t v;
+        memcpy(&v, &p[i], sizeof(v));
+
+        v = fast_MilliWatt2dBm<v2df_t, v2du_t>(v);
+        memcpy(&x[i], &v, sizeof(v));
+    }
+
+    for (; i < count; i++)
+    {
+        x[i] = fast_MilliWatt2dBm<double, uint64_t>(p[i]);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (!(p[i] >= MIN_MILLIWATT && p[i] <= MAX_MILLIWATT))
+        {
+            x[i] = 10.0 * log10(fabs(p[i]) < MIN_MILLIWATT ? 1 : p[i]);
+        }
+    }
+}
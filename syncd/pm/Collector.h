@@ -87,6 +87,23 @@ namespace syncd
 
         double convertdBm2MilliWatt(double x);
 
+        /**
+         * @brief Batch conversion of power values.
+         *
+         * Uses fast approximation with error below 1e-10 (relative for mW,
+         * absolute for dBm), which is suitable for gauges reported with 1
+         * or 2 decimal digits precision.
+         */
+        static void convertdBm2MilliWatt(
+            _In_ const double *x,
+            _Out_ double *p,
+            _In_ size_t count);
+
+        static void convertMilliWatt2dBm(
+            _In_ const double *p,
+            _Out_ double *x,
+            _In_ size_t count);
+
         enum validity_type
         {
             VALIDITY_TYPE_COMPLETE,
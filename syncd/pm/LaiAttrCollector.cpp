@@ -136,7 +136,7 @@ void LaiAttrCollector::updateCurrentValue(entry &e)
         saveToRedis = true;
         e.m_init = false;
     }
-    else if (compare_attribute(m_objectType, e.m_attrdb, e.m_attr))
+    else if (e.m_ops->compare(e.m_attrdb, e.m_attr))
     {
         saveToRedis = true;
     }
@@ -146,7 +146,7 @@ void LaiAttrCollector::updateCurrentValue(entry &e)
         m_stateTable->hset(m_stateTableKeyName, lai_serialize_attr_id_kebab_case(*e.m_meta),
                            lai_serialize_attr_value(*e.m_meta, e.m_attr, false, true));
 
-        transfer_attributes(m_objectType, 1, &e.m_attr, &e.m_attrdb, false);
+        e.m_ops->transfer(e.m_attr, e.m_attrdb, false);
     }
 }
 
@@ -32,6 +32,8 @@ namespace syncd
 
             const lai_attr_metadata_t *m_meta;
 
+            const lai_attr_ops_t *m_ops;
+
             lai_attribute_t m_attr;
 
             lai_attribute_t m_attrdb;
@@ -42,6 +44,13 @@ namespace syncd
                 m_attr.id = meta->attrid;
                 m_attrdb.id = meta->attrid;
 
+                m_ops = lai_get_attr_ops(meta->attrvaluetype);
+
+                if (m_ops == NULL)
+                {
+                    SWSS_LOG_THROW("unsupported value type %d of attribute %s", meta->attrvaluetype, meta->attridname);
+                }
+
                 m_init = true;
             }
         };
@@ -18,6 +18,8 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+
 #include "LaiGaugeCollector.h"
 #include "meta/lai_serialize.h"
 
@@ -62,14 +64,52 @@ LaiGaugeCollector::LaiGaugeCollector(
         }
     }
 
-    for (auto &e : m_entries)
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
     {
+        auto &e = m_entries[idx];
+
         e.m_statvalue15min.m_interval = PM_CYCLE_15_MINS;
         e.m_statvalue24hour.m_interval = PM_CYCLE_24_HOURS;
 
         e.m_statvalue15min.m_expiretime = EXPIRE_TIME_2_DAYS;
         e.m_statvalue24hour.m_expiretime = EXPIRE_TIME_7_DAYS;
-    }    
+
+        /*
+         * When calculate the arithmetic mean value of a power type statistics with dBm unit,
+         * use miliwatt unit. After calculation, when save the avg value to redis, use dBm unit.
+         */
+
+        if (e.m_meta->statvalueunit == LAI_STAT_VALUE_UNIT_DBM &&
+            e.m_meta->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE)
+        {
+            e.m_powerIndex = m_powerEntries.size();
+
+            m_powerEntries.push_back(idx);
+
+            // fast conversion is only accurate enough for 1 or 2 digits
+
+            m_powerExact.push_back(e.m_meta->statvalueprecision == LAI_STAT_VALUE_PRECISION_18);
+        }
+    }
+
+    m_statValues.resize(m_entries.size());
+    m_statValid.resize(m_entries.size());
+    m_statFailed.resize(m_entries.size());
+
+    m_failedCount = 0;
+    m_reprobeCountdown = FAILED_STAT_REPROBE_CYCLES;
+
+    rebuildStatBatch();
+
+    m_powerDbm.resize(m_powerEntries.size());
+    m_powerMilliWatt.resize(m_powerEntries.size());
+
+    for (int cycle = 0; cycle < CYCLE_COUNT; cycle++)
+    {
+        m_powerAvgMilliWatt[cycle].resize(m_powerEntries.size());
+        m_powerAvgDbm[cycle].resize(m_powerEntries.size());
+        m_powerAvgPending[cycle].resize(m_powerEntries.size());
+    }
 }
 
 LaiGaugeCollector::~LaiGaugeCollector()
@@ -92,19 +132,22 @@ void LaiGaugeCollector::collect()
 {
     SWSS_LOG_ENTER();
 
-    lai_status_t status;
+    if (m_entries.empty())
+    {
+        return;
+    }
 
     updateTimeFlags();
 
-    for (auto &e : m_entries)
+    readStats();
+
+    convertPowerSamples();
+
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
     {
-        status = m_vendorLai->getStats(m_objectType,
-                                       m_rid,
-                                       1,
-                                       &e.m_statid,
-                                       &e.m_statvalue);
+        auto &e = m_entries[idx];
 
-        if (status != LAI_STATUS_SUCCESS)
+        if (!m_statValid[idx])
         {
             e.m_statvalue15min.m_failurecount++;
             e.m_statvalue24hour.m_failurecount++;
@@ -112,15 +155,215 @@ void LaiGaugeCollector::collect()
             continue;
         }
 
-        updatePeriodicValue(e, STAT_CYCLE_15_MINS);
-        updatePeriodicValue(e, STAT_CYCLE_24_HOURS);
+        updatePeriodicValue(idx, STAT_CYCLE_15_MINS);
+        updatePeriodicValue(idx, STAT_CYCLE_24_HOURS);
+    }
+
+    updatePowerAverages(STAT_CYCLE_15_MINS);
+    updatePowerAverages(STAT_CYCLE_24_HOURS);
+}
+
+void LaiGaugeCollector::readStats()
+{
+    SWSS_LOG_ENTER();
+
+    std::fill(m_statValid.begin(), m_statValid.end(), 0);
+
+    if (m_statIds.size())
+    {
+        lai_status_t status = m_vendorLai->getStats(m_objectType,
+                                                    m_rid,
+                                                    (uint32_t)m_statIds.size(),
+                                                    m_statIds.data(),
+                                                    m_batchValues.data());
+
+        if (status == LAI_STATUS_SUCCESS)
+        {
+            for (size_t k = 0; k < m_statEntries.size(); k++)
+            {
+                m_statValues[m_statEntries[k]] = m_batchValues[k];
+                m_statValid[m_statEntries[k]] = 1;
+            }
+        }
+        else
+        {
+            /*
+             * Some of the stats may be currently unavailable, read them one
+             * by one to find out which, and leave them out of batch.
+             */
+
+            size_t failedCount = m_failedCount;
+
+            for (size_t idx: m_statEntries)
+            {
+                if (!readStat(idx))
+                {
+                    m_statFailed[idx] = 1;
+                    m_failedCount++;
+                }
+            }
+
+            if (m_failedCount != failedCount)
+            {
+                rebuildStatBatch();
+            }
+        }
+    }
+
+    reprobeFailedStats();
+}
+
+bool LaiGaugeCollector::readStat(size_t idx)
+{
+    SWSS_LOG_ENTER();
+
+    lai_stat_id_t statid = m_entries[idx].m_meta->statid;
+
+    lai_status_t status = m_vendorLai->getStats(m_objectType,
+                                                m_rid,
+                                                1,
+                                                &statid,
+                                                &m_statValues[idx]);
+
+    m_statValid[idx] = (status == LAI_STATUS_SUCCESS);
+
+    return m_statValid[idx];
+}
+
+void LaiGaugeCollector::reprobeFailedStats()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_failedCount == 0 || --m_reprobeCountdown)
+    {
+        return;
+    }
+
+    m_reprobeCountdown = FAILED_STAT_REPROBE_CYCLES;
+
+    size_t failedCount = m_failedCount;
+
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
+    {
+        if (m_statFailed[idx] && readStat(idx))
+        {
+            m_statFailed[idx] = 0;
+            m_failedCount--;
+        }
+    }
+
+    if (m_failedCount != failedCount)
+    {
+        rebuildStatBatch();
+    }
+}
+
+void LaiGaugeCollector::rebuildStatBatch()
+{
+    SWSS_LOG_ENTER();
+
+    m_statIds.clear();
+    m_statEntries.clear();
+
+    for (size_t idx = 0; idx < m_entries.size(); idx++)
+    {
+        if (m_statFailed[idx])
+        {
+            continue;
+        }
+
+        m_statIds.push_back(m_entries[idx].m_meta->statid);
+        m_statEntries.push_back(idx);
+    }
+
+    m_batchValues.resize(m_statIds.size());
+
+    SWSS_LOG_INFO("oid:0x%" PRIX64 " reads %zu stats in batch, %zu failing",
+                  m_rid, m_statIds.size(), m_failedCount);
+}
+
+void LaiGaugeCollector::convertPowerSamples()
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = m_powerEntries.size();
+
+    for (size_t k = 0; k < count; k++)
+    {
+        m_powerDbm[k] = m_statValues[m_powerEntries[k]].d64;
+    }
+
+    convertdBm2MilliWatt(m_powerDbm.data(), m_powerMilliWatt.data(), count);
+
+    for (size_t k = 0; k < count; k++)
+    {
+        if (m_powerExact[k])
+        {
+            m_powerMilliWatt[k] = convertdBm2MilliWatt(m_powerDbm[k]);
+        }
+    }
+}
+
+void LaiGaugeCollector::updatePowerAverages(StatisticalCycle cycle)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = m_powerEntries.size();
+
+    auto &avgMilliWatt = m_powerAvgMilliWatt[cycle];
+    auto &avgDbm = m_powerAvgDbm[cycle];
+    auto &pending = m_powerAvgPending[cycle];
+
+    convertMilliWatt2dBm(avgMilliWatt.data(), avgDbm.data(), count);
+
+    for (size_t k = 0; k < count; k++)
+    {
+        if (!pending[k])
+        {
+            continue;
+        }
+
+        pending[k] = 0;
+
+        if (m_powerExact[k])
+        {
+            avgDbm[k] = convertMilliWatt2dBm(avgMilliWatt[k]);
+        }
+
+        lai_stat_value_t avgvalue;
+
+        avgvalue.d64 = avgDbm[k];
+
+        updateAverageValue(m_entries[m_powerEntries[k]], cycle, avgvalue);
     }
 }
 
-void LaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
+void LaiGaugeCollector::updateAverageValue(
+    entry &e,
+    StatisticalCycle cycle,
+    const lai_stat_value_t &avgvalue)
 {
     SWSS_LOG_ENTER();
 
+    AvgMinMaxValue &v = (cycle == STAT_CYCLE_15_MINS) ? e.m_statvalue15min : e.m_statvalue24hour;
+
+    if (e.m_ops->compare(avgvalue, v.m_avgvalue))
+    {
+        const string &key = (cycle == STAT_CYCLE_15_MINS) ? e.m_key15min : e.m_key24hour;
+
+        e.m_ops->transfer(avgvalue, v.m_avgvalue);
+        m_countersTable->hset(key, "avg", lai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
+    }
+}
+
+void LaiGaugeCollector::updatePeriodicValue(size_t idx, StatisticalCycle cycle)
+{
+    SWSS_LOG_ENTER();
+
+    entry &e = m_entries[idx];
+
+    const lai_stat_value_t &statvalue = m_statValues[idx];
+
     bool timeout;
     string key;
     string historyKey;
@@ -172,23 +415,17 @@ void LaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
 
         v.m_failurecount = 0;
         
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_maxvalue);
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_minvalue);
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_accvalue);
-
-        /*
-         * When calculate the arithmetic mean value of a power type statistics with dBm unit,
-         * use miliwatt unit. After calculation, when save the avg value to redis, use dBm unit.
-         */
+        e.m_ops->transfer(statvalue, v.m_maxvalue);
+        e.m_ops->transfer(statvalue, v.m_minvalue);
+        e.m_ops->transfer(statvalue, v.m_accvalue);
 
-        if (e.m_meta->statvalueunit == LAI_STAT_VALUE_UNIT_DBM &&
-            e.m_meta->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE)
+        if (e.m_powerIndex != POWER_INDEX_NONE)
         {
-            v.m_accvalue.d64 = convertdBm2MilliWatt(e.m_statvalue.d64);
+            v.m_accvalue.d64 = m_powerMilliWatt[e.m_powerIndex];
         }
 
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_avgvalue);
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_instantvalue);
+        e.m_ops->transfer(statvalue, v.m_avgvalue);
+        e.m_ops->transfer(statvalue, v.m_instantvalue);
 
         v.m_maxtime = m_collectTime;
         v.m_mintime = m_collectTime;
@@ -221,51 +458,52 @@ void LaiGaugeCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
         return;
     }
 
-    if (compare_stats(m_objectType, e.m_statid, e.m_statvalue, v.m_maxvalue) > 0)
+    if (e.m_ops->compare(statvalue, v.m_maxvalue) > 0)
     {
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_maxvalue);
+        e.m_ops->transfer(statvalue, v.m_maxvalue);
         v.m_maxtime = m_collectTime;
 
         m_countersTable->hset(key, "max", lai_serialize_stat_value(*e.m_meta, v.m_maxvalue));
         m_countersTable->hset(key, "max-time", to_string(v.m_maxtime));
     }
 
-    if (compare_stats(m_objectType, e.m_statid, e.m_statvalue, v.m_minvalue) < 0)
+    if (e.m_ops->compare(statvalue, v.m_minvalue) < 0)
     {
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_minvalue);
+        e.m_ops->transfer(statvalue, v.m_minvalue);
         v.m_mintime = m_collectTime;
 
         m_countersTable->hset(key, "min", lai_serialize_stat_value(*e.m_meta, v.m_minvalue));
         m_countersTable->hset(key, "min-time", to_string(v.m_mintime));
     }
 
-    if (compare_stats(m_objectType, e.m_statid, e.m_statvalue, v.m_instantvalue))
+    if (e.m_ops->compare(statvalue, v.m_instantvalue))
     {
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_instantvalue);
+        e.m_ops->transfer(statvalue, v.m_instantvalue);
 
         m_countersTable->hset(key, "instant", lai_serialize_stat_value(*e.m_meta, v.m_instantvalue));
     }
 
-    lai_stat_value_t avgvalue;
-
-    if (e.m_meta->statvalueunit == LAI_STAT_VALUE_UNIT_DBM &&
-        e.m_meta->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE)
+    if (e.m_powerIndex != POWER_INDEX_NONE)
     {
-        v.m_accvalue.d64 += convertdBm2MilliWatt(e.m_statvalue.d64);
-        v.m_accnum++;
-        avgvalue.d64 = convertMilliWatt2dBm(v.m_accvalue.d64 / v.m_accnum);
-    }
-    else
-    {
-        inc_stat(*e.m_meta, v.m_accvalue, e.m_statvalue);
+        /*
+         * Average is converted back to dBm for all power gauges at once
+         * in updatePowerAverages.
+         */
+
+        v.m_accvalue.d64 += m_powerMilliWatt[e.m_powerIndex];
         v.m_accnum++;
-        div_stat(*e.m_meta, avgvalue, v.m_accvalue, v.m_accnum);
-    }
 
-    if (compare_stats(m_objectType, e.m_statid, avgvalue, v.m_avgvalue))
-    {
-        transfer_stat(*e.m_meta, avgvalue, v.m_avgvalue);
-        m_countersTable->hset(key, "avg", lai_serialize_stat_value(*e.m_meta, v.m_avgvalue));
+        m_powerAvgMilliWatt[cycle][e.m_powerIndex] = v.m_accvalue.d64 / v.m_accnum;
+        m_powerAvgPending[cycle][e.m_powerIndex] = 1;
+
+        return;
     }
-}
 
+    lai_stat_value_t avgvalue;
+
+    e.m_ops->inc(v.m_accvalue, statvalue);
+    v.m_accnum++;
+    e.m_ops->div(avgvalue, v.m_accvalue, v.m_accnum);
+
+    updateAverageValue(e, cycle, avgvalue);
+}
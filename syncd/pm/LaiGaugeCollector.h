@@ -66,9 +66,13 @@ namespace syncd
         {
             const lai_stat_metadata_t *m_meta;
 
-            lai_stat_id_t m_statid;
+            const lai_stat_ops_t *m_ops;
 
-            lai_stat_value_t m_statvalue;
+            /**
+             * @brief Index to power buffers if value is double in dBm,
+             * which is averaged in mW, otherwise POWER_INDEX_NONE.
+             */
+            size_t m_powerIndex;
 
             AvgMinMaxValue m_statvalue15min;
 
@@ -85,7 +89,14 @@ namespace syncd
             entry(const lai_stat_metadata_t *meta, std::string &tableKeyName)
                 : m_meta(meta)
             {
-                m_statid = meta->statid;
+                m_ops = lai_get_stat_ops(*meta);
+
+                if (m_ops == NULL)
+                {
+                    SWSS_LOG_THROW("unsupported value type %d of stat %s", meta->statvaluetype, meta->statidname);
+                }
+
+                m_powerIndex = POWER_INDEX_NONE;
 
                 std::string keyHead = tableKeyName + "_" + 
                                       lai_serialize_stat_id_camel_case(*meta);
@@ -98,9 +109,83 @@ namespace syncd
             }
         };
 
+        static constexpr size_t POWER_INDEX_NONE = (size_t)-1;
+
+        static constexpr int CYCLE_COUNT = 2;
+
+        /**
+         * @brief Number of collect cycles after which failing stats are read
+         * again one by one.
+         */
+        static constexpr uint32_t FAILED_STAT_REPROBE_CYCLES = 60;
+
         std::vector<entry> m_entries;
-           
-        void updatePeriodicValue(entry &e, StatisticalCycle cycle); 
+
+        /*
+         * Per sample data is kept as structure of arrays, index is the same
+         * as in m_entries.
+         */
+
+        std::vector<lai_stat_value_t> m_statValues;
+
+        std::vector<uint8_t> m_statValid;
+
+        std::vector<uint8_t> m_statFailed;
+
+        /*
+         * Stats which are not failing are read by single getStats, index of
+         * entry for each batch position is in m_statEntries. Failing stats
+         * are left out of batch, so they don't cause reading all stats one
+         * by one every cycle.
+         */
+
+        std::vector<lai_stat_id_t> m_statIds;
+
+        std::vector<lai_stat_value_t> m_batchValues;
+
+        std::vector<size_t> m_statEntries;
+
+        size_t m_failedCount;
+
+        uint32_t m_reprobeCountdown;
+
+        /*
+         * Power gauges (double in dBm) are averaged in mW, conversions for
+         * all of them are done in batch, index is entry m_powerIndex.
+         */
+
+        std::vector<size_t> m_powerEntries;
+
+        std::vector<uint8_t> m_powerExact;
+
+        std::vector<double> m_powerDbm;
+
+        std::vector<double> m_powerMilliWatt;
+
+        std::vector<double> m_powerAvgMilliWatt[CYCLE_COUNT];
+
+        std::vector<double> m_powerAvgDbm[CYCLE_COUNT];
+
+        std::vector<uint8_t> m_powerAvgPending[CYCLE_COUNT];
+
+        void readStats();
+
+        bool readStat(size_t idx);
+
+        void rebuildStatBatch();
+
+        void reprobeFailedStats();
+
+        void convertPowerSamples();
+
+        void updatePowerAverages(StatisticalCycle cycle);
+
+        void updatePeriodicValue(size_t idx, StatisticalCycle cycle);
+
+        void updateAverageValue(
+            entry &e,
+            StatisticalCycle cycle,
+            const lai_stat_value_t &avgvalue);
 
     };
 }
@@ -135,7 +135,7 @@ void LaiStatCollector::updateCurrentValue(entry &e)
 
     if (v.m_init)
     {
-        transfer_stat(*e.m_meta, e.m_statvalue, v.m_stataccvalue); 
+        e.m_ops->transfer(e.m_statvalue, v.m_stataccvalue); 
         saveToRedis = true;
 
         v.m_init = false;
@@ -147,8 +147,8 @@ void LaiStatCollector::updateCurrentValue(entry &e)
          * being read by syncd, so we need to accumulate the result in each collection cycle.
          */
 
-        inc_stat(*e.m_meta, v.m_stataccvalue, e.m_statvalue);
-        if (compare_stats(m_objectType, e.m_statid, v.m_stataccvalue, v.m_statvaluedb))
+        e.m_ops->inc(v.m_stataccvalue, e.m_statvalue);
+        if (e.m_ops->compare(v.m_stataccvalue, v.m_statvaluedb))
         {
             saveToRedis = true;
         } 
@@ -158,7 +158,7 @@ void LaiStatCollector::updateCurrentValue(entry &e)
     {
         m_countersTable->hset(m_keyCur, lai_serialize_stat_id_kebab_case(*e.m_meta),
                               lai_serialize_stat_value(*e.m_meta, v.m_stataccvalue));
-        transfer_stat(*e.m_meta, v.m_stataccvalue, v.m_statvaluedb);
+        e.m_ops->transfer(v.m_stataccvalue, v.m_statvaluedb);
     }
 }
 
@@ -223,12 +223,12 @@ void LaiStatCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
 
         m_countersTable->hset(key, "starttime", to_string(accvalue.m_starttime));
 
-        transfer_stat(*e.m_meta, e.m_statvalue, accvalue.m_stataccvalue);
+        e.m_ops->transfer(e.m_statvalue, accvalue.m_stataccvalue);
 
         m_countersTable->hset(key, lai_serialize_stat_id_kebab_case(*e.m_meta),
                               lai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
 
-        transfer_stat(*e.m_meta, accvalue.m_stataccvalue, accvalue.m_statvaluedb); 
+        e.m_ops->transfer(accvalue.m_stataccvalue, accvalue.m_statvaluedb); 
 
         accvalue.m_validityType = VALIDITY_TYPE_INCOMPLETE;
         m_countersTable->hset(key, "validity", validityToString(accvalue.m_validityType));
@@ -236,13 +236,13 @@ void LaiStatCollector::updatePeriodicValue(entry &e, StatisticalCycle cycle)
         return;
     }
 
-    inc_stat(*e.m_meta, accvalue.m_stataccvalue, e.m_statvalue);
+    e.m_ops->inc(accvalue.m_stataccvalue, e.m_statvalue);
 
-    if (compare_stats(m_objectType, e.m_statid, accvalue.m_stataccvalue, accvalue.m_statvaluedb))
+    if (e.m_ops->compare(accvalue.m_stataccvalue, accvalue.m_statvaluedb))
     {
         m_countersTable->hset(key, lai_serialize_stat_id_kebab_case(*e.m_meta),
                               lai_serialize_stat_value(*e.m_meta, accvalue.m_stataccvalue));
 
-        transfer_stat(*e.m_meta, accvalue.m_stataccvalue, accvalue.m_statvaluedb);
+        e.m_ops->transfer(accvalue.m_stataccvalue, accvalue.m_statvaluedb);
     }
 }
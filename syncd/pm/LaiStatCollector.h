@@ -57,6 +57,8 @@ namespace syncd
         {
             const lai_stat_metadata_t *m_meta;
 
+            const lai_stat_ops_t *m_ops;
+
             lai_stat_id_t m_statid;
 
             lai_stat_value_t m_statvalue; /* from LAI */
@@ -71,6 +73,13 @@ namespace syncd
                 : m_meta(meta)
             {
                 m_statid = meta->statid;
+
+                m_ops = lai_get_stat_ops(*meta);
+
+                if (m_ops == NULL)
+                {
+                    SWSS_LOG_THROW("unsupported value type %d of stat %s", meta->statvaluetype, meta->statidname);
+                }
             }
         };
 
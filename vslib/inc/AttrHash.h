@@ -0,0 +1,43 @@
+#pragma once
+
+#include "LaiAttrWrap.h"
+
+#include "meta/AttrIdMap.h"
+
+#include <memory>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Attributes of single virtual object, keyed by attribute id.
+     */
+    class AttrHash
+    {
+        public:
+
+            AttrHash(
+                    _In_ lai_object_id_t objectId);
+
+        public:
+
+            lai_object_id_t getObjectId() const;
+
+            std::shared_ptr<LaiAttrWrap> getAttr(
+                    _In_ lai_attr_id_t id) const;
+
+            void setAttr(
+                    _In_ std::shared_ptr<LaiAttrWrap> attr);
+
+            /**
+             * @brief Get all attributes sorted by attribute id.
+             */
+            std::vector<std::shared_ptr<LaiAttrWrap>> getAttrs() const;
+
+        private:
+
+            lai_object_id_t m_objectId;
+
+            laimeta::AttrIdMap<std::shared_ptr<LaiAttrWrap>> m_attrs;
+    };
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ValueGenerator.h"
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace laivs
+{
+    /**
+     * @brief Describes how virtual linecard counters change between reads.
+     *
+     * Each stat either grows with constant rate per second (bytes, packets,
+     * errors), or gets new value from value generator on each read (gauges
+     * like power or BER).
+     */
+    class CounterModel
+    {
+        public:
+
+            typedef struct _Model
+            {
+                /**
+                 * @brief Growth per second, used when generator is nullptr.
+                 */
+                double m_rate;
+
+                std::shared_ptr<ValueGenerator> m_generator;
+
+            } Model;
+
+        public:
+
+            /**
+             * @brief Create default model, which increments all stats by one
+             * on each read.
+             */
+            CounterModel();
+
+            virtual ~CounterModel() = default;
+
+        public:
+
+            uint64_t getSeed() const;
+
+            void setSeed(
+                    _In_ uint64_t seed);
+
+            void setDefaultModel(
+                    _In_ const Model& model);
+
+            void setModel(
+                    _In_ const lai_stat_metadata_t* meta,
+                    _In_ const Model& model);
+
+            /**
+             * @brief Get model for given stat, or default model if stat has
+             * no explicit model.
+             */
+            const Model& getModel(
+                    _In_ const lai_stat_metadata_t* meta) const;
+
+        public:
+
+            /**
+             * @brief Parse model from string.
+             *
+             * Supported forms:
+             *
+             * rate:PER_SECOND
+             * any value generator, see ValueGenerator::parse
+             */
+            static bool parseModel(
+                    _In_ const std::string& str,
+                    _Out_ Model& model);
+
+        private:
+
+            uint64_t m_seed;
+
+            Model m_defaultModel;
+
+            std::unordered_map<const lai_stat_metadata_t*, Model> m_models;
+    };
+}
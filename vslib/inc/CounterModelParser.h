@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CounterModel.h"
+
+#include <string>
+
+namespace laivs
+{
+    class CounterModelParser
+    {
+        public:
+
+            CounterModelParser() = delete;
+
+            ~CounterModelParser() = delete;
+
+        public:
+
+            static std::shared_ptr<CounterModel> parseFromFile(
+                    _In_ const char* fileName);
+
+        private:
+
+            static void parse(
+                    _In_ std::shared_ptr<CounterModel> model,
+                    _In_ const std::string& key,
+                    _In_ const std::string& value);
+    };
+}
@@ -18,6 +18,10 @@ namespace laivs
 
         EVENT_TYPE_NOTIFICATION,
 
+        EVENT_TYPE_LINECARD_STATE_CHANGE,
+
+        EVENT_TYPE_REPLAY_NOTIFICATION,
+
     } EventType;
 
     class Event
@@ -0,0 +1,31 @@
+#pragma once
+
+extern "C" {
+#include "lai.h"
+}
+
+#include "EventPayload.h"
+
+#include "swss/sal.h"
+
+namespace laivs
+{
+    class EventPayloadLinecardStateChange:
+        public EventPayload
+    {
+        public:
+
+            EventPayloadLinecardStateChange(
+                    _In_ lai_oper_status_t operStatus);
+
+            virtual ~EventPayloadLinecardStateChange() = default;
+
+        public:
+
+            lai_oper_status_t getOperStatus() const;
+
+        private:
+
+            lai_oper_status_t m_operStatus;
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "EventPayload.h"
+
+#include "swss/sal.h"
+
+#include <string>
+
+namespace laivs
+{
+    class EventPayloadReplayNotification:
+        public EventPayload
+    {
+        public:
+
+            EventPayloadReplayNotification(
+                    _In_ const std::string& name,
+                    _In_ const std::string& serializedNotification);
+
+            virtual ~EventPayloadReplayNotification() = default;
+
+        public:
+
+            const std::string& getName() const;
+
+            const std::string& getSerializedNotification() const;
+
+        private:
+
+            std::string m_name;
+
+            std::string m_serializedNotification;
+    };
+}
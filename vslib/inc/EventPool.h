@@ -0,0 +1,112 @@
+#pragma once
+
+#include "swss/sal.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace laivs
+{
+    /**
+     * @brief Pool of fixed size memory blocks for events and payloads.
+     *
+     * Blocks are grouped by size class, freed blocks are kept on per class
+     * free list and reused by next allocation, so event bursts don't hit
+     * global allocator. Allocations bigger than largest class fall back to
+     * operator new.
+     */
+    class EventPool
+    {
+        public:
+
+            EventPool() = delete;
+
+            ~EventPool() = delete;
+
+        public:
+
+            static constexpr size_t BLOCK_ALIGN = 64;
+
+            static constexpr size_t CLASS_COUNT = 8;
+
+            /**
+             * @brief Max number of free blocks kept per size class.
+             */
+            static constexpr size_t MAX_FREE_BLOCKS = 4096;
+
+            static void* allocate(
+                    _In_ size_t size);
+
+            static void deallocate(
+                    _In_ void* ptr,
+                    _In_ size_t size);
+
+            /**
+             * @brief Create shared object with control block allocated from
+             * pool.
+             */
+            template <typename T, typename... Args>
+            static std::shared_ptr<T> makeShared(
+                    _In_ Args&&... args);
+    };
+
+    template <typename T>
+    class EventPoolAllocator
+    {
+        public:
+
+            typedef T value_type;
+
+            EventPoolAllocator() = default;
+
+            template <typename U>
+            EventPoolAllocator(
+                    _In_ const EventPoolAllocator<U>&)
+            {
+                // empty
+            }
+
+            T* allocate(
+                    _In_ size_t n)
+            {
+                return static_cast<T*>(EventPool::allocate(n * sizeof(T)));
+            }
+
+            void deallocate(
+                    _In_ T* ptr,
+                    _In_ size_t n)
+            {
+                EventPool::deallocate(ptr, n * sizeof(T));
+            }
+
+            template <typename U>
+            struct rebind
+            {
+                typedef EventPoolAllocator<U> other;
+            };
+    };
+
+    template <typename T, typename U>
+    bool operator==(
+            _In_ const EventPoolAllocator<T>&,
+            _In_ const EventPoolAllocator<U>&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(
+            _In_ const EventPoolAllocator<T>&,
+            _In_ const EventPoolAllocator<U>&)
+    {
+        return false;
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> EventPool::makeShared(
+            _In_ Args&&... args)
+    {
+        return std::allocate_shared<T>(EventPoolAllocator<T>(), std::forward<Args>(args)...);
+    }
+}
@@ -1,37 +1,110 @@
 #pragma once
 
 #include "Event.h"
+#include "EventPool.h"
 #include "Signal.h"
 
-#include <mutex>
-#include <deque>
+#include <atomic>
+#include <vector>
+
+/**
+ * @brief Default number of events which can wait in event queue.
+ */
+#define DEFAULT_EVENT_QUEUE_SIZE (0x4000)
 
 namespace laivs
 {
+    /**
+     * @brief Bounded lock free multiple producer single consumer queue.
+     *
+     * Producers claim slots with compare and swap on enqueue position, each
+     * slot sequence number tells whether slot is free for producer or ready
+     * for consumer. Only one thread can dequeue at a time.
+     */
     class EventQueue
     {
         public:
 
             EventQueue(
-                    _In_ std::shared_ptr<Signal> signal);
+                    _In_ std::shared_ptr<Signal> signal,
+                    _In_ size_t capacity = DEFAULT_EVENT_QUEUE_SIZE);
 
             virtual ~EventQueue() = default;
 
         public:
 
-            void enqueue(
+            /**
+             * @brief Enqueue event and notify consumer.
+             *
+             * Returns false and drops event if queue is full.
+             */
+            bool enqueue(
                     _In_ std::shared_ptr<Event> event);
 
+            /**
+             * @brief Enqueue event and notify consumer.
+             *
+             * Returns false if queue is full, event is not counted as
+             * dropped, so producer which can wait may retry.
+             */
+            bool tryEnqueue(
+                    _In_ const std::shared_ptr<Event>& event);
+
             std::shared_ptr<Event> dequeue();
 
+            /**
+             * @brief Move up to maxCount events to end of given vector.
+             *
+             * Returns number of dequeued events.
+             */
+            size_t dequeue(
+                    _Inout_ std::vector<std::shared_ptr<Event>>& events,
+                    _In_ size_t maxCount);
+
             size_t size();
 
+            size_t getDropCount() const;
+
+        public:
+
+            /**
+             * @brief Create event and its payload from event pool.
+             */
+            template <typename T, typename... Args>
+            static std::shared_ptr<Event> makeEvent(
+                    _In_ EventType eventType,
+                    _In_ Args&&... args);
+
+        private:
+
+            typedef struct _Slot
+            {
+                std::atomic<size_t> m_sequence;
+
+                std::shared_ptr<Event> m_event;
+
+            } Slot;
+
         private:
 
             std::shared_ptr<Signal> m_signal;
 
-            std::mutex m_mutex;
+            std::vector<Slot> m_slots;
+
+            size_t m_mask;
 
-            std::deque<std::shared_ptr<Event>> m_queue;
+            std::atomic<size_t> m_enqueuePos;
+
+            std::atomic<size_t> m_dequeuePos;
+
+            std::atomic<size_t> m_dropCount;
     };
+
+    template <typename T, typename... Args>
+    std::shared_ptr<Event> EventQueue::makeEvent(
+            _In_ EventType eventType,
+            _In_ Args&&... args)
+    {
+        return EventPool::makeShared<Event>(eventType, EventPool::makeShared<T>(std::forward<Args>(args)...));
+    }
 }
@@ -6,6 +6,7 @@
 #include "EventPayloadNotification.h"
 #include "ResourceLimiterContainer.h"
 #include "CorePortIndexMapContainer.h"
+#include "RecordingReplay.h"
 
 #include "meta/Meta.h"
 
@@ -17,6 +18,7 @@
 #include <vector>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
 
 namespace laivs
 {
@@ -196,6 +198,14 @@ namespace laivs
             void stopCheckLinkThread();
             void checkLinkThreadProc();
 
+        private: // replay
+
+            void startReplayThread();
+
+            void stopReplayThread();
+
+            void replayThreadProc();
+
         private: // event queue
 
             void startEventQueueThread();
@@ -213,6 +223,12 @@ namespace laivs
             void asyncProcessEventNotification(
                     _In_ std::shared_ptr<EventPayloadNotification> payload);
 
+            void syncProcessEventLinecardStateChange(
+                    _In_ std::shared_ptr<EventPayloadLinecardStateChange> payload);
+
+            void syncProcessEventReplayNotification(
+                    _In_ std::shared_ptr<EventPayloadReplayNotification> payload);
+
         private: // unittests
 
             bool m_unittestChannelRun;
@@ -229,6 +245,18 @@ namespace laivs
             bool m_checkLinkRun;
             std::shared_ptr<std::thread> m_checkLinkThread;
 
+        private: // replay
+
+            bool m_replayThreadRun;
+
+            std::shared_ptr<std::thread> m_replayThread;
+
+            std::shared_ptr<RecordingReplay> m_recordingReplay;
+
+            std::mutex m_replayMutex;
+
+            std::condition_variable m_replayCv;
+
         private: // event queue
 
             bool m_eventQueueThreadRun;
@@ -27,22 +27,41 @@ namespace laivs
                         _In_ const std::string& attrValue);
 
                 virtual ~LaiAttrWrap();
-                void updateValue();
+
         public:
 
                 const lai_attribute_t* getAttr() const;
 
                 const lai_attr_metadata_t* getAttrMetadata() const;
 
+                /**
+                 * @brief Get serialized attribute value.
+                 *
+                 * Value is serialized on first call after updateValue, so
+                 * caller must hold lock protecting object hash.
+                 */
                 const std::string& getAttrStrValue() const;
 
+                /**
+                 * @brief Replace attribute value in place.
+                 *
+                 * Used by simulation, so ticks don't allocate new wrapper
+                 * for every attribute. Primitive values are only copied,
+                 * serialized value is updated when it's read. Caller must
+                 * hold lock protecting object hash.
+                 */
+                void updateValue(
+                        _In_ const lai_attribute_t *attr);
+
         private:
 
                 const lai_attr_metadata_t *m_meta;
 
                 lai_attribute_t m_attr;
 
-                std::string m_value;
+                mutable std::string m_value;
+
+                mutable bool m_valueValid;
     };
 
 }
@@ -0,0 +1,157 @@
+#pragma once
+
+extern "C" {
+#include "lai.h"
+}
+
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace laivs
+{
+    typedef enum _lai_vs_latency_api_t
+    {
+        LAI_VS_LATENCY_API_ANY,
+
+        LAI_VS_LATENCY_API_CREATE,
+
+        LAI_VS_LATENCY_API_REMOVE,
+
+        LAI_VS_LATENCY_API_SET,
+
+        LAI_VS_LATENCY_API_GET,
+
+        LAI_VS_LATENCY_API_GET_STATS,
+
+        LAI_VS_LATENCY_API_GET_ALARMS,
+
+        LAI_VS_LATENCY_API_CLEAR_ALARMS,
+
+    } lai_vs_latency_api_t;
+
+    typedef enum _lai_vs_latency_distribution_t
+    {
+        LAI_VS_LATENCY_DISTRIBUTION_UNIFORM,
+
+        LAI_VS_LATENCY_DISTRIBUTION_NORMAL,
+
+        LAI_VS_LATENCY_DISTRIBUTION_EXPONENTIAL,
+
+    } lai_vs_latency_distribution_t;
+
+    /**
+     * @brief Emulates vendor driver behavior on virtual linecard API calls.
+     *
+     * Each rule describes latency and failure rates for given API and object
+     * type, so code calling LAI can be measured against driver which needs
+     * milliseconds for each hardware access, instead of VS which returns
+     * instantly.
+     */
+    class LatencyProfile
+    {
+        public:
+
+            /**
+             * @brief Object type used in rule matching any object type.
+             */
+            constexpr static lai_object_type_t ANY_OBJECT_TYPE = LAI_OBJECT_TYPE_NULL;
+
+            typedef struct _Rule
+            {
+                lai_vs_latency_distribution_t m_distribution;
+
+                /**
+                 * @brief Mean latency in microseconds.
+                 */
+                uint32_t m_latencyUs;
+
+                /**
+                 * @brief Half width of uniform distribution or standard
+                 * deviation of normal distribution, in microseconds.
+                 */
+                uint32_t m_jitterUs;
+
+                /**
+                 * @brief Time spent in call which timed out, in microseconds.
+                 */
+                uint32_t m_timeoutUs;
+
+                double m_timeoutRate;
+
+                double m_notReadyRate;
+
+                double m_failureRate;
+
+            } Rule;
+
+        public:
+
+            LatencyProfile();
+
+            virtual ~LatencyProfile() = default;
+
+        public:
+
+            void setSeed(
+                    _In_ uint64_t seed);
+
+            void setRule(
+                    _In_ lai_vs_latency_api_t api,
+                    _In_ lai_object_type_t objectType,
+                    _In_ const Rule& rule);
+
+            /**
+             * @brief Get rule for given API and object type.
+             *
+             * Exact match takes precedence over API match, which takes
+             * precedence over object type match and rule matching any API and
+             * any object type. Returns nullptr if no rule matches.
+             */
+            const Rule* getRule(
+                    _In_ lai_vs_latency_api_t api,
+                    _In_ lai_object_type_t objectType) const;
+
+            bool empty() const;
+
+            /**
+             * @brief Apply rule for given API and object type.
+             *
+             * Sleeps calling thread for drawn latency and returns status
+             * which API call should fail with, or LAI_STATUS_SUCCESS if call
+             * should proceed.
+             */
+            lai_status_t inject(
+                    _In_ lai_vs_latency_api_t api,
+                    _In_ lai_object_type_t objectType);
+
+        public:
+
+            static Rule getDefaultRule();
+
+            static bool parseApi(
+                    _In_ const std::string& str,
+                    _Out_ lai_vs_latency_api_t& api);
+
+            static bool parseDistribution(
+                    _In_ const std::string& str,
+                    _Out_ lai_vs_latency_distribution_t& distribution);
+
+        private:
+
+            uint64_t drawLatencyUs(
+                    _In_ const Rule& rule);
+
+        private:
+
+            std::map<std::pair<lai_vs_latency_api_t, lai_object_type_t>, Rule> m_rules;
+
+            std::mutex m_mutex;
+
+            std::mt19937_64 m_generator;
+
+            std::uniform_real_distribution<double> m_probability;
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "LatencyProfile.h"
+
+#include <memory>
+#include <string>
+
+namespace laivs
+{
+    class LatencyProfileParser
+    {
+        public:
+
+            LatencyProfileParser() = delete;
+
+            ~LatencyProfileParser() = delete;
+
+        public:
+
+            static std::shared_ptr<LatencyProfile> parseFromFile(
+                    _In_ const char* fileName);
+
+        private:
+
+            static void parse(
+                    _In_ std::shared_ptr<LatencyProfile> profile,
+                    _In_ const std::string& key,
+                    _In_ const std::string& value);
+
+            static bool parseRule(
+                    _In_ const std::string& str,
+                    _Out_ LatencyProfile::Rule& rule);
+
+            static bool parseUint32(
+                    _In_ const std::string& str,
+                    _Out_ uint32_t& value);
+
+            static bool parseRate(
+                    _In_ const std::string& str,
+                    _Out_ double& value);
+    };
+}
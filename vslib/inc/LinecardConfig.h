@@ -3,8 +3,14 @@
 #include "LaneMap.h"
 #include "EventQueue.h"
 #include "ResourceLimiter.h"
+#include "SimulationProfile.h"
+#include "LatencyProfile.h"
+#include "CounterModel.h"
+#include "RecordingReplay.h"
 #include "CorePortIndexMap.h"
+#include "LinecardScale.h"
 
+#include <map>
 #include <string>
 #include <memory>
 
@@ -20,6 +26,8 @@ namespace laivs
 
         LAI_VS_LINECARD_TYPE_P230C,
 
+        LAI_VS_LINECARD_TYPE_SCALABLE,
+
     } lai_vs_linecard_type_t;
 
     typedef enum _lai_vs_boot_type_t
@@ -79,6 +87,19 @@ namespace laivs
 
             std::shared_ptr<ResourceLimiter> m_resourceLimiter;
 
+            std::shared_ptr<SimulationProfile> m_simulationProfile;
+
+            std::shared_ptr<LatencyProfile> m_latencyProfile;
+
+            std::shared_ptr<CounterModel> m_counterModel;
+
+            std::shared_ptr<RecordingReplay> m_recordingReplay;
+
+            /**
+             * @brief Objects created on init by scalable linecard.
+             */
+            std::shared_ptr<LinecardScale> m_linecardScale;
+
             std::shared_ptr<CorePortIndexMap> m_corePortIndexMap;
     };
 }
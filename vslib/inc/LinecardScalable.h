@@ -0,0 +1,59 @@
+#pragma once
+
+#include "LinecardStateBase.h"
+
+#include <string>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Virtual linecard with configurable number of objects.
+     *
+     * After linecard is created, creates objects of each type given by
+     * linecard scale through metadata. If port count is not given, one port
+     * is created for each interface in lane map, or in core port index map.
+     */
+    class LinecardScalable:
+        public LinecardStateBase
+    {
+        public:
+
+            LinecardScalable(
+                    _In_ lai_object_id_t linecard_id,
+                    _In_ std::shared_ptr<RealObjectIdManager> manager,
+                    _In_ std::shared_ptr<LinecardConfig> config);
+
+            virtual ~LinecardScalable() = default;
+
+        public:
+
+            virtual lai_status_t create_internal_objects(
+                    _In_ std::shared_ptr<laimeta::Meta> meta) override;
+
+        protected:
+
+            virtual bool isStatSupported(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ lai_stat_id_t stat_id) const override;
+
+        private:
+
+            lai_status_t create_scaled_objects(
+                    _In_ std::shared_ptr<laimeta::Meta> meta,
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t count);
+
+            /**
+             * @brief Generate mandatory and key attributes of object with
+             * given index, so each object gets unique key.
+             */
+            bool generateAttributes(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t index,
+                    _Out_ std::vector<lai_attribute_t>& attrs) const;
+
+            std::vector<std::string> getInterfaceNames() const;
+    };
+}
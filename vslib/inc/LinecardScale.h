@@ -0,0 +1,71 @@
+#pragma once
+
+extern "C" {
+#include "lai.h"
+}
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Object model of scalable virtual linecard.
+     *
+     * Number of objects created per object type, and for each object type
+     * optional set of supported stats and set of alarms which are active on
+     * created objects.
+     */
+    class LinecardScale
+    {
+        public:
+
+            LinecardScale() = default;
+
+            virtual ~LinecardScale() = default;
+
+        public:
+
+            void setObjectCount(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint32_t count);
+
+            bool hasObjectCount(
+                    _In_ lai_object_type_t objectType) const;
+
+            const std::map<lai_object_type_t, uint32_t>& getObjectCounts() const;
+
+            void setStats(
+                    _In_ lai_object_type_t objectType,
+                    _In_ const std::set<lai_stat_id_t>& stats);
+
+            /**
+             * @brief Get stats supported by objects of given type.
+             *
+             * Returns nullptr when stat set is not configured, then all
+             * stats defined by metadata are supported.
+             */
+            const std::set<lai_stat_id_t>* getStats(
+                    _In_ lai_object_type_t objectType) const;
+
+            void setAlarms(
+                    _In_ lai_object_type_t objectType,
+                    _In_ const std::vector<lai_alarm_type_t>& alarms);
+
+            /**
+             * @brief Get alarms raised on objects of given type when they
+             * are created.
+             */
+            const std::vector<lai_alarm_type_t>& getAlarms(
+                    _In_ lai_object_type_t objectType) const;
+
+        private:
+
+            std::map<lai_object_type_t, uint32_t> m_objectCounts;
+
+            std::map<lai_object_type_t, std::set<lai_stat_id_t>> m_stats;
+
+            std::map<lai_object_type_t, std::vector<lai_alarm_type_t>> m_alarms;
+    };
+}
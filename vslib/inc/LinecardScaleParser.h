@@ -0,0 +1,46 @@
+#pragma once
+
+#include "LinecardScale.h"
+
+#include <memory>
+#include <string>
+
+namespace laivs
+{
+    class LinecardScaleParser
+    {
+        public:
+
+            LinecardScaleParser() = delete;
+
+            ~LinecardScaleParser() = delete;
+
+        public:
+
+            /**
+             * @brief Parse object model of scalable virtual linecard.
+             *
+             * Returns empty model if file name is NULL or file can't be
+             * opened.
+             */
+            static std::shared_ptr<LinecardScale> parseFromFile(
+                    _In_ const char* fileName);
+
+        private:
+
+            static void parse(
+                    _In_ std::shared_ptr<LinecardScale> scale,
+                    _In_ const std::string& key,
+                    _In_ const std::string& value);
+
+            static void parseStats(
+                    _In_ std::shared_ptr<LinecardScale> scale,
+                    _In_ lai_object_type_t objectType,
+                    _In_ const std::string& value);
+
+            static void parseAlarms(
+                    _In_ std::shared_ptr<LinecardScale> scale,
+                    _In_ lai_object_type_t objectType,
+                    _In_ const std::string& value);
+    };
+}
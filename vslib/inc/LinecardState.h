@@ -6,12 +6,15 @@ extern "C" {
 
 #include "LaiAttrWrap.h"
 #include "LinecardConfig.h"
+#include "ObjectHash.h"
+#include "ObjectCounters.h"
 
 #include "meta/Meta.h"
 
 #include "swss/selectableevent.h"
 
 #include <map>
+#include <unordered_map>
 #include <memory>
 #include <thread>
 #include <string>
@@ -21,18 +24,6 @@ namespace laivs
 {
     class LinecardState
     {
-        public:
-
-            /**
-             * @brief AttrHash key is attribute ID, value is actual attribute
-             */
-            typedef std::map<std::string, std::shared_ptr<LaiAttrWrap>> AttrHash;
-
-            /**
-             * @brief ObjectHash is map indexed by object type and then serialized object id.
-             */
-            typedef std::map<lai_object_type_t, std::map<std::string, AttrHash>> ObjectHash;
-
         public:
 
             LinecardState(
@@ -108,15 +99,64 @@ namespace laivs
 
             std::shared_ptr<laimeta::Meta> getMeta();
 
+            /**
+             * @brief Check if stat is supported by given object.
+             *
+             * All stats defined by metadata are supported by default.
+             */
+            virtual bool isStatSupported(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ lai_stat_id_t stat_id) const;
+
+            /**
+             * @brief Assign replay creation index to object created by user.
+             *
+             * Recording replay matches objects by position among objects of
+             * the same type created by user, since object ids differ.
+             */
+            void addCreationIndex(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id);
+
+            void removeCreationIndex(
+                    _In_ lai_object_id_t object_id);
+
+            bool getCreationIndex(
+                    _In_ lai_object_id_t object_id,
+                    _Out_ uint64_t& index) const;
+
+            /**
+             * @brief Mark alarm as active on given object.
+             */
+            void raiseAlarm(
+                    _In_ lai_object_id_t object_id,
+                    _In_ lai_alarm_type_t alarm_type,
+                    _In_ lai_alarm_severity_t severity);
+
         public: // TODO make private
 
             ObjectHash m_objectHash;
 
         protected:
 
-            std::map<std::string, std::map<int, uint64_t>> m_countersMap;
+            std::shared_ptr<CounterModel> m_counterModel;
+
+            /**
+             * @brief Recording replay, may be nullptr.
+             */
+            std::shared_ptr<RecordingReplay> m_recordingReplay;
+
+            std::unordered_map<lai_object_id_t, ObjectCounters> m_countersMap;
+
+            /**
+             * @brief Alarms of each object indexed by alarm type.
+             */
+            std::unordered_map<lai_object_id_t, std::vector<lai_alarm_info_t>> m_alarmsMap;
+
+            std::unordered_map<lai_object_id_t, uint64_t> m_creationIndex;
 
-            std::map<std::string, std::map<int, lai_alarm_info_t>> m_alarmsMap;
+            std::map<lai_object_type_t, uint64_t> m_creationCount;
 
             lai_object_id_t m_linecard_id;
 
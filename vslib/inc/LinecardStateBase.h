@@ -4,7 +4,10 @@
 #include "LinecardConfig.h"
 #include "RealObjectIdManager.h"
 #include "EventPayloadNetLinkMsg.h"
+#include "SimulationEngine.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <vector>
@@ -47,6 +50,47 @@ namespace laivs
 
         public:
 
+            /**
+             * @brief Create objects which linecard creates on its own.
+             *
+             * Called after linecard was created. Objects are created through
+             * metadata, so they are validated and tracked like objects
+             * created by user.
+             */
+            virtual lai_status_t create_internal_objects(
+                    _In_ std::shared_ptr<laimeta::Meta> meta);
+
+            /**
+             * @brief Remove objects created by create_internal_objects.
+             *
+             * Used to roll back linecard create when not all internal
+             * objects could be created.
+             */
+            lai_status_t remove_internal_objects(
+                    _In_ std::shared_ptr<laimeta::Meta> meta);
+
+            /**
+             * @brief True while internal objects are created or removed,
+             * such calls are not user API calls.
+             */
+            bool isChangingInternalObjects() const;
+
+            /**
+             * @brief Get objects created by create_internal_objects which
+             * were not removed yet.
+             */
+            lai_status_t get_internal_object_list(
+                    _Inout_ lai_object_list_t& objectList);
+
+        public:
+
+            /**
+             * @brief Refresh read only attributes of given object.
+             *
+             * Called by get once per call for given object, on first read
+             * only attribute, so refresh must update all read only
+             * attributes of the object, not only the one from metadata.
+             */
             virtual lai_status_t refresh_read_only(
                     _In_ const lai_attr_metadata_t *meta,
                     _In_ lai_object_id_t object_id);
@@ -60,6 +104,15 @@ namespace laivs
                     _In_ uint32_t attr_count,
                     _In_ const lai_attribute_t *attr_list);
 
+        public:
+
+            virtual lai_status_t create(
+                    _In_ lai_object_type_t object_type,
+                    _In_ lai_object_id_t object_id,
+                    _In_ lai_object_id_t linecard_id,
+                    _In_ uint32_t attr_count,
+                    _In_ const lai_attribute_t *attr_list);
+
             virtual lai_status_t remove(
                     _In_ lai_object_type_t object_type,
                     _In_ lai_object_id_t object_id);
@@ -75,50 +128,39 @@ namespace laivs
                     _In_ uint32_t attr_count,
                     _Out_ lai_attribute_t *attr_list);
 
-        public:
+        protected:
 
-            virtual lai_status_t create(
+            lai_status_t create_internal_object(
+                    _In_ std::shared_ptr<laimeta::Meta> meta,
                     _In_ lai_object_type_t object_type,
-                    _In_ const std::string &serializedObjectId,
-                    _In_ lai_object_id_t linecard_id,
+                    _Out_ lai_object_id_t *object_id,
                     _In_ uint32_t attr_count,
                     _In_ const lai_attribute_t *attr_list);
 
-            virtual lai_status_t remove(
-                    _In_ lai_object_type_t object_type,
-                    _In_ const std::string &serializedObjectId);
-
-            virtual lai_status_t set(
-                    _In_ lai_object_type_t objectType,
-                    _In_ const std::string &serializedObjectId,
-                    _In_ const lai_attribute_t* attr);
-
-            virtual lai_status_t get(
+            bool isInternalObject(
                     _In_ lai_object_type_t object_type,
-                    _In_ const std::string &serializedObjectId,
-                    _In_ uint32_t attr_count,
-                    _Out_ lai_attribute_t *attr_list);
+                    _In_ lai_object_id_t object_id) const;
 
         protected:
              void setObjectHash(
                      _In_ lai_object_type_t object_type,
-                     _In_ const std::string &serializedObjectId,
+                     _In_ lai_object_id_t object_id,
                      _In_ const lai_attribute_t *attr);
 
             virtual lai_status_t remove_internal(
                     _In_ lai_object_type_t object_type,
-                    _In_ const std::string &serializedObjectId);
+                    _In_ lai_object_id_t object_id);
 
             virtual lai_status_t create_internal(
                     _In_ lai_object_type_t object_type,
-                    _In_ const std::string &serializedObjectId,
+                    _In_ lai_object_id_t object_id,
                     _In_ lai_object_id_t linecard_id,
                     _In_ uint32_t attr_count,
                     _In_ const lai_attribute_t *attr_list);
 
             virtual lai_status_t set_internal(
                     _In_ lai_object_type_t objectType,
-                    _In_ const std::string &serializedObjectId,
+                    _In_ lai_object_id_t objectId,
                     _In_ const lai_attribute_t* attr);
 
         private:
@@ -140,6 +182,23 @@ namespace laivs
             static int promisc(
                     _In_ const char *dev);
 
+        public:
+
+            /**
+             * @brief Notify linecard state change, called from event queue
+             * thread when link state changes.
+             */
+            void processLinecardStateChange(
+                    _In_ lai_oper_status_t status);
+
+            /**
+             * @brief Send notification from recording on behalf of this
+             * linecard, called from event queue thread.
+             */
+            void processReplayNotification(
+                    _In_ const std::string& name,
+                    _In_ const std::string& serializedNotification);
+
         protected: // custom linecard
 
             void send_linecard_state_change_notification(
@@ -182,19 +241,36 @@ namespace laivs
 
             std::shared_ptr<RealObjectIdManager> m_realObjectIdManager;
 
-            std::shared_ptr<std::thread> m_externEventThread;
+            std::shared_ptr<std::thread> m_simulationThread;
 
-            void externEventThreadProc();
+            void simulationThreadProc();
 
-            bool m_externEventThreadRun;
+            bool m_simulationThreadRun;
 
-        public: // TODO private
+        protected:
 
-            std::shared_ptr<std::thread> m_updateObjectThread;
+            /**
+             * @brief Protects object hash and simulation engine, since
+             * simulation thread updates attribute values while API threads
+             * are reading them.
+             */
+            std::mutex m_objectHashMutex;
+
+            std::shared_ptr<SimulationEngine> m_simulationEngine;
+
+            /**
+             * @brief Objects created by linecard itself, they don't count
+             * against resource limits of user objects.
+             */
+            std::map<lai_object_type_t, std::set<lai_object_id_t>> m_internalObjects;
+
+            bool m_changingInternalObjects;
+
+        private:
 
-            void updateObjectThreadProc();
+            std::mutex m_simulationMutex;
 
-            bool m_updateObjectThreadRun;
+            std::condition_variable m_simulationCv;
    };
 }
 
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CounterModel.h"
+
+extern "C" {
+#include "lai.h"
+}
+
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Counters of single object.
+     *
+     * Counters are kept in contiguous array indexed by stat id, only custom
+     * range stat ids fall back to map.
+     */
+    class ObjectCounters
+    {
+        public:
+
+            static constexpr lai_stat_id_t MAX_FLAT_STAT_ID = 0x400;
+
+            typedef std::chrono::steady_clock::time_point TimePoint;
+
+        public:
+
+            ObjectCounters(
+                    _In_ uint64_t randomState);
+
+            ~ObjectCounters() = default;
+
+        public:
+
+            /**
+             * @brief Advance counter according to model and read its value.
+             *
+             * Rate models grow by time elapsed since previous read of the
+             * same counter, generator models advance one tick per read. In
+             * LAI_STATS_MODE_READ_AND_CLEAR mode counter starts from zero
+             * after read, for all stat value types.
+             */
+            void read(
+                    _In_ const lai_stat_metadata_t* meta,
+                    _In_ const CounterModel::Model& model,
+                    _In_ const TimePoint& now,
+                    _In_ lai_stats_mode_t mode,
+                    _Out_ lai_stat_value_t& value);
+
+            /**
+             * @brief Set counter to given value, used by unittests.
+             */
+            void write(
+                    _In_ const lai_stat_metadata_t* meta,
+                    _In_ const TimePoint& now,
+                    _In_ const lai_stat_value_t& value);
+
+        private:
+
+            typedef struct _Counter
+            {
+                bool m_valid;
+
+                /**
+                 * @brief Value of integer stat, signed types are stored as
+                 * two's complement.
+                 */
+                uint64_t m_integer;
+
+                double m_double;
+
+                /**
+                 * @brief Fraction of integer counter not yet reported by
+                 * rate model.
+                 */
+                double m_fraction;
+
+                uint64_t m_tick;
+
+                /**
+                 * @brief Random state of generator, each counter has its own
+                 * so reading one stat doesn't change sequence of another.
+                 */
+                uint64_t m_randomState;
+
+                TimePoint m_lastRead;
+
+            } Counter;
+
+            Counter& getCounter(
+                    _In_ lai_stat_id_t id,
+                    _In_ const TimePoint& now);
+
+            static bool isSigned(
+                    _In_ const lai_stat_metadata_t* meta);
+
+            static uint64_t toInteger(
+                    _In_ const lai_stat_metadata_t* meta,
+                    _In_ double value);
+
+        private:
+
+            std::vector<Counter> m_counters;
+
+            std::map<lai_stat_id_t, Counter> m_customCounters;
+
+            /**
+             * @brief Seed of counters random states, each counter mixes in
+             * its stat id.
+             */
+            uint64_t m_randomSeed;
+    };
+}
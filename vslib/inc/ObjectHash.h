@@ -0,0 +1,78 @@
+#pragma once
+
+#include "AttrHash.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Virtual linecard object store.
+     *
+     * Objects are kept in contiguous vector per object type and located by
+     * object id through hash index, so lookups don't need to serialize object
+     * id or attribute id.
+     */
+    class ObjectHash
+    {
+        public:
+
+            ObjectHash();
+
+            virtual ~ObjectHash() = default;
+
+        public:
+
+            AttrHash* find(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId);
+
+            const AttrHash* find(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId) const;
+
+            /**
+             * @brief Get object attributes, object is created with empty
+             * attributes if it don't exist.
+             */
+            AttrHash& insert(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId);
+
+            bool erase(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId);
+
+            size_t size(
+                    _In_ lai_object_type_t objectType) const;
+
+            /**
+             * @brief Get all objects of given type.
+             *
+             * Returned reference is invalidated by insert and erase.
+             */
+            std::vector<AttrHash>& getObjects(
+                    _In_ lai_object_type_t objectType);
+
+        private:
+
+            typedef struct _ObjectTypeHash
+            {
+                std::vector<AttrHash> m_objects;
+
+                std::unordered_map<lai_object_id_t, size_t> m_index;
+
+            } ObjectTypeHash;
+
+            ObjectTypeHash& at(
+                    _In_ lai_object_type_t objectType);
+
+            const ObjectTypeHash& at(
+                    _In_ lai_object_type_t objectType) const;
+
+        private:
+
+            std::vector<ObjectTypeHash> m_objectTypes;
+    };
+}
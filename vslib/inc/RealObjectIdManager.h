@@ -6,8 +6,10 @@ extern "C" {
 
 #include "LinecardConfigContainer.h"
 
-#include <set>
-#include <map>
+#include "lib/inc/ObjectIdLayout.h"
+
+#include <array>
+#include <bitset>
 
 namespace laivs
 {
@@ -110,8 +112,14 @@ namespace laivs
             static uint32_t getLinecardIndex(
                     _In_ lai_object_id_t objectId);
 
-            uint32_t getObjectIndex(
+            /**
+             * @brief Get object index.
+             *
+             * Returns index of object within its object type.
+             */
+            static uint32_t getObjectIndex(
                     _In_ lai_object_id_t objectId);
+
         private:
 
             /**
@@ -153,9 +161,12 @@ namespace laivs
             /**
              * @brief Set of allocated linecard indexes.
              */
-            std::set<uint32_t> m_linecardIndexes;
+            std::bitset<lairedis::VsObjectIdLayout::LINECARD_INDEX_MAX + 1> m_linecardIndexes;
 
-            std::map<lai_object_type_t, uint64_t> m_indexer;
+            /**
+             * @brief Next object index for each object type.
+             */
+            std::array<uint64_t, LAI_OBJECT_TYPE_EXTENSIONS_MAX> m_indexer;
 
             std::shared_ptr<LinecardConfigContainer> m_container;
     };
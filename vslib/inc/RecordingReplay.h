@@ -0,0 +1,180 @@
+#pragma once
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include "LaiAttrWrap.h"
+
+#include <map>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace laivs
+{
+    /**
+     * @brief Values and notifications from lairedis recording.
+     *
+     * Virtual linecard answers get and get stats with values which were
+     * returned at the same point of recording, and emits recorded
+     * notifications with original timing, so production traces can be
+     * reproduced against syncd running on virtual linecard. Recording time
+     * can be compressed by speed factor.
+     *
+     * Object ids differ between recording and virtual linecard, so objects
+     * are matched by object type and creation index, which is position of
+     * object among objects of the same type created by user, in order of
+     * creation. Replay expects objects to be created in the same order as in
+     * recorded production run.
+     *
+     * Recording time starts at linecard create, so replay clock must be
+     * started when linecard is created on virtual linecard.
+     */
+    class RecordingReplay
+    {
+        public:
+
+            typedef struct _Notification
+            {
+                /**
+                 * @brief Time since recording start in microseconds.
+                 */
+                uint64_t m_timeUs;
+
+                std::string m_name;
+
+                std::string m_serializedNotification;
+
+            } Notification;
+
+        public:
+
+            RecordingReplay();
+
+            virtual ~RecordingReplay() = default;
+
+        public:
+
+            /**
+             * @brief Set speed factor, 2 means recording is replayed twice
+             * as fast as it was recorded.
+             */
+            void setSpeed(
+                    _In_ double speed);
+
+            double getSpeed() const;
+
+            /**
+             * @brief Start replay clock.
+             *
+             * Linecard create in recording is aligned with this point in
+             * time.
+             */
+            void start();
+
+            bool empty() const;
+
+        public: // loading
+
+            void addAttr(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint64_t creationIndex,
+                    _In_ uint64_t timeUs,
+                    _In_ std::shared_ptr<LaiAttrWrap> attr);
+
+            void addStat(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint64_t creationIndex,
+                    _In_ uint64_t timeUs,
+                    _In_ lai_stat_id_t statId,
+                    _In_ uint64_t value);
+
+            void addNotification(
+                    _In_ uint64_t timeUs,
+                    _In_ const std::string& name,
+                    _In_ const std::string& serializedNotification);
+
+        public: // replay
+
+            /**
+             * @brief Get recorded attribute value current at replay clock.
+             *
+             * Before first recorded value, first value is returned. Returns
+             * nullptr if attribute was not recorded for given object.
+             */
+            std::shared_ptr<LaiAttrWrap> getAttr(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint64_t creationIndex,
+                    _In_ lai_attr_id_t attrId) const;
+
+            /**
+             * @brief Get recorded stat value current at replay clock.
+             *
+             * Stats are recorded as raw 64 bit value of lai_stat_value_t, so
+             * value is bit exact for any stat value type.
+             *
+             * @return False if stat was not recorded for given object.
+             */
+            bool getStat(
+                    _In_ lai_object_type_t objectType,
+                    _In_ uint64_t creationIndex,
+                    _In_ lai_stat_id_t statId,
+                    _Out_ uint64_t& value) const;
+
+            /**
+             * @brief Get recorded notifications ordered by time.
+             */
+            const std::vector<Notification>& getNotifications() const;
+
+            /**
+             * @brief Get point in time when notification should be emitted.
+             */
+            std::chrono::steady_clock::time_point getEmitTime(
+                    _In_ const Notification& notification) const;
+
+        private:
+
+            /**
+             * @brief Get recording time which corresponds to current time.
+             */
+            uint64_t getRecordingTimeUs() const;
+
+            template <typename T>
+            static const T* findSample(
+                    _In_ const std::vector<T>& samples,
+                    _In_ uint64_t timeUs);
+
+        private:
+
+            typedef struct _AttrSample
+            {
+                uint64_t m_timeUs;
+
+                std::shared_ptr<LaiAttrWrap> m_attr;
+
+            } AttrSample;
+
+            typedef struct _StatSample
+            {
+                uint64_t m_timeUs;
+
+                uint64_t m_value;
+
+            } StatSample;
+
+            typedef std::pair<lai_object_type_t, uint64_t> ObjectKey;
+
+            std::map<ObjectKey, std::map<lai_attr_id_t, std::vector<AttrSample>>> m_attrs;
+
+            std::map<ObjectKey, std::map<lai_stat_id_t, std::vector<StatSample>>> m_stats;
+
+            std::vector<Notification> m_notifications;
+
+            double m_speed;
+
+            std::chrono::steady_clock::time_point m_start;
+    };
+}
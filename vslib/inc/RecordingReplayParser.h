@@ -0,0 +1,146 @@
+#pragma once
+
+#include "RecordingReplay.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace laivs
+{
+    class RecordingReplayParser
+    {
+        public:
+
+            RecordingReplayParser() = delete;
+
+            ~RecordingReplayParser() = delete;
+
+        public:
+
+            /**
+             * @brief Load replay from lairedis recording, text or binary.
+             */
+            static std::shared_ptr<RecordingReplay> parseFromFile(
+                    _In_ const char* fileName);
+
+            /**
+             * @brief Parse replay speed, NULL means real time.
+             */
+            static bool parseSpeed(
+                    _In_ const char* speedStr,
+                    _Out_ double& speed);
+
+        private:
+
+            typedef struct _Request
+            {
+                bool m_pending;
+
+                lai_object_type_t m_objectType;
+
+                uint64_t m_creationIndex;
+
+                std::vector<const lai_stat_metadata_t*> m_stats;
+
+            } Request;
+
+            typedef std::pair<lai_object_type_t, uint64_t> ObjectKey;
+
+            typedef struct _State
+            {
+                /**
+                 * @brief Linecard create was reached, recording time starts
+                 * there.
+                 */
+                bool m_started;
+
+                uint64_t m_startUs;
+
+                Request m_get;
+
+                Request m_getStats;
+
+                /**
+                 * @brief Requests of pending bulk get, one per object.
+                 */
+                std::vector<Request> m_bulkGet;
+
+                /**
+                 * @brief Object type and creation index of each virtual id
+                 * created in recording.
+                 */
+                std::map<lai_object_id_t, ObjectKey> m_objects;
+
+                /**
+                 * @brief Number of objects created so far per object type.
+                 */
+                std::map<lai_object_type_t, uint64_t> m_created;
+
+                /**
+                 * @brief Number of requests on objects which were not
+                 * created in recording.
+                 */
+                uint64_t m_unknown;
+
+            } State;
+
+        private:
+
+            static void parseRecord(
+                    _In_ std::shared_ptr<RecordingReplay> replay,
+                    _Inout_ State& state,
+                    _In_ uint64_t timestamp,
+                    _In_ const std::string& record);
+
+            static void parseCreate(
+                    _Inout_ State& state,
+                    _In_ uint64_t timestamp,
+                    _In_ const std::string& key);
+
+            static void parseRemove(
+                    _Inout_ State& state,
+                    _In_ const std::string& key);
+
+            static void parseRequest(
+                    _Inout_ State& state,
+                    _In_ const std::string& key,
+                    _Out_ Request& request);
+
+            static void parseBulkGet(
+                    _Inout_ State& state,
+                    _In_ const std::string& record);
+
+            static void parseAttributes(
+                    _In_ std::shared_ptr<RecordingReplay> replay,
+                    _In_ const Request& request,
+                    _In_ uint64_t timeUs,
+                    _In_ const std::vector<std::string>& tokens,
+                    _In_ size_t first);
+
+            static void parseGetResponse(
+                    _In_ std::shared_ptr<RecordingReplay> replay,
+                    _Inout_ Request& request,
+                    _In_ uint64_t timeUs,
+                    _In_ const std::vector<std::string>& tokens);
+
+            static void parseBulkGetResponse(
+                    _In_ std::shared_ptr<RecordingReplay> replay,
+                    _Inout_ State& state,
+                    _In_ uint64_t timeUs,
+                    _In_ const std::string& record);
+
+            static void parseGetStatsResponse(
+                    _In_ std::shared_ptr<RecordingReplay> replay,
+                    _Inout_ Request& request,
+                    _In_ uint64_t timeUs,
+                    _In_ const std::vector<std::string>& tokens);
+
+            /**
+             * @brief Split bulk record on object boundaries.
+             */
+            static std::vector<std::string> splitEntries(
+                    _In_ const std::string& record);
+    };
+}
@@ -1,15 +1,23 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 
 namespace laivs
 {
+    /**
+     * @brief Wakes up thread waiting for events.
+     *
+     * Notification is remembered until next wait, so notification sent
+     * while waiting thread is still processing previous events is not lost.
+     * Notifications sent while one is already pending don't take the mutex.
+     */
     class Signal
     {
         public:
 
-            Signal() = default;
+            Signal();
 
             virtual ~Signal() = default;
 
@@ -26,5 +34,7 @@ namespace laivs
             std::condition_variable m_cv;
 
             std::mutex m_mutex;
+
+            std::atomic<bool> m_pending;
     };
 }
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "ObjectHash.h"
+#include "SimulationProfile.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace laivs
+{
+    /**
+     * @brief Updates simulated attribute values of virtual linecard objects.
+     *
+     * Engine keeps list of objects which have at least one attribute with
+     * value generator, so each tick touches only those objects. Engine is not
+     * thread safe, caller must hold lock protecting object hash.
+     */
+    class SimulationEngine
+    {
+        public:
+
+            SimulationEngine(
+                    _In_ std::shared_ptr<SimulationProfile> profile);
+
+            virtual ~SimulationEngine() = default;
+
+        public:
+
+            std::shared_ptr<SimulationProfile> getProfile() const;
+
+            /**
+             * @brief Register object attributes, replaces previous
+             * registration of the same object.
+             */
+            void addObject(
+                    _In_ lai_object_type_t objectType,
+                    _In_ const AttrHash& attrHash);
+
+            void removeObject(
+                    _In_ lai_object_id_t objectId);
+
+            /**
+             * @brief Notify engine about attribute set on object.
+             *
+             * Simulation of attribute continues from value which was set,
+             * and attribute which was not present on create gets registered
+             * if profile has generator for it.
+             */
+            void setAttr(
+                    _In_ lai_object_type_t objectType,
+                    _In_ lai_object_id_t objectId,
+                    _In_ const LaiAttrWrap& attr);
+
+            /**
+             * @brief Advance simulation by one tick and update values in
+             * object hash in place.
+             */
+            void tick(
+                    _Inout_ ObjectHash& objectHash);
+
+            size_t getSimulatedObjectCount() const;
+
+        private:
+
+            static bool getValue(
+                    _In_ const lai_attr_metadata_t* meta,
+                    _In_ const lai_attribute_t* attr,
+                    _Out_ double& value);
+
+            static void setValue(
+                    _In_ const lai_attr_metadata_t* meta,
+                    _In_ double value,
+                    _Out_ lai_attribute_t& attr);
+
+        private:
+
+            typedef struct _SimulatedAttr
+            {
+                const lai_attr_metadata_t* m_meta;
+
+                std::shared_ptr<ValueGenerator> m_generator;
+
+                double m_value;
+
+                uint64_t m_randomState;
+
+            } SimulatedAttr;
+
+            typedef struct _SimulatedObject
+            {
+                lai_object_type_t m_objectType;
+
+                lai_object_id_t m_objectId;
+
+                std::vector<SimulatedAttr> m_attrs;
+
+            } SimulatedObject;
+
+            bool initAttr(
+                    _In_ lai_object_id_t objectId,
+                    _In_ const LaiAttrWrap& wrap,
+                    _Out_ SimulatedAttr& attr) const;
+
+        private:
+
+            std::shared_ptr<SimulationProfile> m_profile;
+
+            std::vector<SimulatedObject> m_objects;
+
+            std::unordered_map<lai_object_id_t, size_t> m_index;
+
+            uint64_t m_tick;
+    };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "ValueGenerator.h"
+
+extern "C" {
+#include "laimetadata.h"
+}
+
+#include <map>
+#include <memory>
+
+namespace laivs
+{
+    /**
+     * @brief Describes how virtual linecard changes values of read only
+     * attributes over time.
+     */
+    class SimulationProfile
+    {
+        public:
+
+            constexpr static uint32_t DEFAULT_TICK_INTERVAL_MS = 1000;
+
+            constexpr static uint32_t DEFAULT_START_DELAY_MS = 15000;
+
+        public:
+
+            /**
+             * @brief Create default profile, which ramps all numeric read
+             * only attributes by one on each tick.
+             */
+            SimulationProfile();
+
+            virtual ~SimulationProfile() = default;
+
+        public:
+
+            uint32_t getTickIntervalMs() const;
+
+            void setTickIntervalMs(
+                    _In_ uint32_t tickIntervalMs);
+
+            uint32_t getStartDelayMs() const;
+
+            void setStartDelayMs(
+                    _In_ uint32_t startDelayMs);
+
+            uint64_t getSeed() const;
+
+            void setSeed(
+                    _In_ uint64_t seed);
+
+            /**
+             * @brief Set generator used for numeric read only attributes
+             * which don't have explicit generator, can be nullptr.
+             */
+            void setDefaultGenerator(
+                    _In_ std::shared_ptr<ValueGenerator> generator);
+
+            void setGenerator(
+                    _In_ const lai_attr_metadata_t* meta,
+                    _In_ std::shared_ptr<ValueGenerator> generator);
+
+            /**
+             * @brief Get generator for given attribute, or nullptr if
+             * attribute value is static.
+             */
+            std::shared_ptr<ValueGenerator> getGenerator(
+                    _In_ const lai_attr_metadata_t* meta) const;
+
+            static bool isNumeric(
+                    _In_ const lai_attr_metadata_t* meta);
+
+        private:
+
+            uint32_t m_tickIntervalMs;
+
+            uint32_t m_startDelayMs;
+
+            uint64_t m_seed;
+
+            std::shared_ptr<ValueGenerator> m_defaultGenerator;
+
+            std::map<std::pair<lai_object_type_t, lai_attr_id_t>, std::shared_ptr<ValueGenerator>> m_generators;
+    };
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "SimulationProfile.h"
+
+#include <string>
+
+namespace laivs
+{
+    class SimulationProfileParser
+    {
+        public:
+
+            SimulationProfileParser() = delete;
+
+            ~SimulationProfileParser() = delete;
+
+        public:
+
+            static std::shared_ptr<SimulationProfile> parseFromFile(
+                    _In_ const char* fileName);
+
+        private:
+
+            static void parse(
+                    _In_ std::shared_ptr<SimulationProfile> profile,
+                    _In_ const std::string& key,
+                    _In_ const std::string& value);
+
+            static bool parseUint64(
+                    _In_ const std::string& str,
+                    _Out_ uint64_t& value);
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+extern "C" {
+#include "lai.h"
+}
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace laivs
+{
+    typedef enum _lai_vs_value_generator_type_t
+    {
+        LAI_VS_VALUE_GENERATOR_TYPE_CONSTANT,
+
+        LAI_VS_VALUE_GENERATOR_TYPE_RAMP,
+
+        LAI_VS_VALUE_GENERATOR_TYPE_RANDOM_WALK,
+
+        LAI_VS_VALUE_GENERATOR_TYPE_SINE,
+
+        LAI_VS_VALUE_GENERATOR_TYPE_REPLAY,
+
+    } lai_vs_value_generator_type_t;
+
+    /**
+     * @brief Produces next value of simulated attribute on each tick.
+     *
+     * Generator itself is immutable and can be shared between objects, state
+     * of each simulated attribute (previous value and random state) is passed
+     * in by caller.
+     */
+    class ValueGenerator
+    {
+        public:
+
+            ValueGenerator(
+                    _In_ lai_vs_value_generator_type_t type,
+                    _In_ const std::vector<double>& params);
+
+            /**
+             * @brief Create replay generator, values are used in order and
+             * wrap around when end is reached.
+             */
+            ValueGenerator(
+                    _In_ const std::vector<double>& values);
+
+            /**
+             * @brief Create unbounded ramp with integer step.
+             */
+            ValueGenerator(
+                    _In_ int64_t step);
+
+            virtual ~ValueGenerator() = default;
+
+        public:
+
+            /**
+             * @brief Parse generator from string.
+             *
+             * Supported forms:
+             *
+             * constant:VALUE
+             * ramp:STEP[,MIN,MAX]
+             * random_walk:STEP,MIN,MAX
+             * sine:OFFSET,AMPLITUDE,PERIOD_TICKS
+             * replay:FILE_NAME
+             *
+             * Returns nullptr on failure.
+             */
+            static std::shared_ptr<ValueGenerator> parse(
+                    _In_ const std::string& str);
+
+        public:
+
+            lai_vs_value_generator_type_t getType() const;
+
+            /**
+             * @brief Get integer step of unbounded ramp.
+             *
+             * Returns false for other generators and for ramp with step
+             * which was not given as integer. Integer counters using such
+             * ramp are advanced without conversion to double, so they stay
+             * exact above 2^53.
+             */
+            bool getIntegerStep(
+                    _Out_ int64_t& step) const;
+
+            double next(
+                    _In_ uint64_t tick,
+                    _In_ double previous,
+                    _Inout_ uint64_t& randomState) const;
+
+        private:
+
+            static double random(
+                    _Inout_ uint64_t& state);
+
+        private:
+
+            lai_vs_value_generator_type_t m_type;
+
+            std::vector<double> m_params;
+
+            std::vector<double> m_values;
+
+            bool m_hasIntegerStep;
+
+            int64_t m_integerStep;
+    };
+}
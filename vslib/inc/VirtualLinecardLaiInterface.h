@@ -7,6 +7,8 @@
 #include "EventQueue.h"
 #include "EventPayloadPacket.h"
 #include "EventPayloadNetLinkMsg.h"
+#include "EventPayloadLinecardStateChange.h"
+#include "EventPayloadReplayNotification.h"
 
 #include "lib/inc/LaiInterface.h"
 
@@ -135,25 +137,25 @@ namespace laivs
             lai_status_t create(
                     _In_ lai_object_id_t linecardId,
                     _In_ lai_object_type_t objectType,
-                    _In_ const std::string& serializedObjectId,
+                    _In_ lai_object_id_t objectId,
                     _In_ uint32_t attr_count,
                     _In_ const lai_attribute_t *attr_list);
 
             lai_status_t remove(
                     _In_ lai_object_id_t linecardId,
                     _In_ lai_object_type_t objectType,
-                    _In_ const std::string& serializedObjectId);
+                    _In_ lai_object_id_t objectId);
 
             lai_status_t set(
                     _In_ lai_object_id_t linecardId,
                     _In_ lai_object_type_t objectType,
-                    _In_ const std::string& serializedObjectId,
+                    _In_ lai_object_id_t objectId,
                     _In_ const lai_attribute_t *attr);
 
             lai_status_t get(
                     _In_ lai_object_id_t linecardId,
                     _In_ lai_object_type_t objectType,
-                    _In_ const std::string& serializedObjectId,
+                    _In_ lai_object_id_t objectId,
                     _In_ uint32_t attr_count,
                     _Inout_ lai_attribute_t *attr_list);
 
@@ -170,6 +172,17 @@ namespace laivs
 
         private:
 
+            /**
+             * @brief Apply latency profile of given linecard to API call.
+             *
+             * Returns LAI_STATUS_SUCCESS if call should proceed, or status
+             * injected by profile.
+             */
+            lai_status_t injectLatency(
+                    _In_ lai_vs_latency_api_t api,
+                    _In_ lai_object_id_t linecardId,
+                    _In_ lai_object_type_t objectType);
+
             std::shared_ptr<LinecardStateBase> init_linecard(
                     _In_ lai_object_id_t linecard_id,
                     _In_ std::shared_ptr<LinecardConfig> config,
@@ -185,11 +198,36 @@ namespace laivs
             void setMeta(
                     _In_ std::weak_ptr<laimeta::Meta> meta);
 
+            /**
+             * @brief Create objects which linecard creates on its own.
+             *
+             * Must be called after linecard was created through metadata,
+             * since internal objects are created through metadata as well.
+             */
+            lai_status_t createInternalObjects(
+                    _In_ lai_object_id_t linecardId);
+
+            /**
+             * @brief Remove objects created by createInternalObjects.
+             */
+            lai_status_t removeInternalObjects(
+                    _In_ lai_object_id_t linecardId);
+
+            lai_status_t getInternalObjectList(
+                    _In_ lai_object_id_t linecardId,
+                    _Inout_ lai_object_list_t& objectList);
+
             void ageFdbs();
 
             void syncProcessEventNetLinkMsg(
                     _In_ std::shared_ptr<EventPayloadNetLinkMsg> payload);
 
+            void syncProcessEventLinecardStateChange(
+                    _In_ std::shared_ptr<EventPayloadLinecardStateChange> payload);
+
+            void syncProcessEventReplayNotification(
+                    _In_ std::shared_ptr<EventPayloadReplayNotification> payload);
+
         public:
 
             std::string getHardwareInfo(
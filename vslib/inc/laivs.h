@@ -36,6 +36,101 @@ extern "C" {
  */
 #define LAI_KEY_VS_RESOURCE_LIMITER_FILE    "LAI_VS_RESOURCE_LIMITER_FILE"
 
+/**
+ * @def LAI_KEY_VS_SIMULATION_FILE
+ *
+ * File with value generators for simulated attributes and simulation tick
+ * rate. Without this file all numeric read only attributes are incremented
+ * by one every second.
+ *
+ * Example:
+ * tick_ms=1000
+ * start_delay_ms=0
+ * seed=1
+ * default=none
+ * LAI_OA_ATTR_INPUT_POWER=sine:-10,2,60
+ * LAI_OA_ATTR_OUTPUT_POWER=random_walk:0.1,-5,5
+ * LAI_OSC_ATTR_INPUT_POWER=replay:/etc/laivs/osc_input_power.txt
+ */
+#define LAI_KEY_VS_SIMULATION_FILE          "LAI_VS_SIMULATION_FILE"
+
+/**
+ * @def LAI_KEY_VS_COUNTER_MODEL_FILE
+ *
+ * File with models of counters returned by get stats. Stat can grow with
+ * rate per second, or take values from value generator on each read, see
+ * LAI_KEY_VS_SIMULATION_FILE. Without this file all stats are incremented by
+ * one on each read.
+ *
+ * Example:
+ * seed=1
+ * default=rate:0
+ * LAI_PORT_STAT_IN_OCTETS=rate:1250000000
+ * LAI_PORT_STAT_IN_CRC_ERRORS=rate:0.5
+ * LAI_OTN_STAT_PRE_FEC_BER=random_walk:0.000001,0.0001,0.001
+ */
+#define LAI_KEY_VS_COUNTER_MODEL_FILE       "LAI_VS_COUNTER_MODEL_FILE"
+
+/**
+ * @def LAI_KEY_VS_LATENCY_PROFILE_FILE
+ *
+ * File with latency and failure rates injected into virtual linecard API
+ * calls, to emulate vendor driver which needs time for each hardware access.
+ * Rule for exact api and object type takes precedence over rules with '*'.
+ *
+ * Example:
+ * seed=1
+ * *:*=latency_us:100
+ * get:LAI_OBJECT_TYPE_TRANSCEIVER=latency_us:2000,jitter_us:500
+ * set:LAI_OBJECT_TYPE_OA=latency_us:5000,distribution:exponential,timeout_us:1000000,timeout_rate:0.01
+ * get_stats:*=latency_us:800,jitter_us:200,distribution:normal,not_ready_rate:0.05,failure_rate:0.001
+ */
+#define LAI_KEY_VS_LATENCY_PROFILE_FILE     "LAI_VS_LATENCY_PROFILE_FILE"
+
+/**
+ * @def LAI_KEY_VS_REPLAY_FILE
+ *
+ * Recording produced by lairedis recorder, text or binary, replayed by
+ * virtual linecard. Get and get stats return values recorded at the same
+ * point of recording, and recorded linecard notifications are emitted with
+ * original timing. Objects are matched by object type and creation order
+ * among objects of the same type, and recording time starts at linecard
+ * create.
+ */
+#define LAI_KEY_VS_REPLAY_FILE              "LAI_VS_REPLAY_FILE"
+
+/**
+ * @def LAI_KEY_VS_REPLAY_SPEED
+ *
+ * Time compression of replayed recording, 10 replays recording ten times
+ * faster than it was recorded. Default is 1.
+ */
+#define LAI_KEY_VS_REPLAY_SPEED             "LAI_VS_REPLAY_SPEED"
+
+/**
+ * @def LAI_KEY_VS_LINECARD_SCALE_FILE
+ *
+ * File with number of objects created on init by scalable linecard
+ * (LAI_VS_LINECARD_TYPE_SCALABLE). If port count is not specified, one port
+ * is created for each interface in lane map, or in core port index map when
+ * lane map is not specified.
+ *
+ * Objects are created through metadata right after linecard, with mandatory
+ * and key attributes generated from object index, and are reported by
+ * LAI_VS_LINECARD_ATTR_INTERNAL_OBJECT_LIST, so syncd discovers them.
+ *
+ * Optional stats line limits stats supported by objects of given type, and
+ * alarms line lists alarms which are active on created objects.
+ *
+ * Example:
+ * LAI_OBJECT_TYPE_PORT=320
+ * LAI_OBJECT_TYPE_TRANSCEIVER=320
+ * LAI_OBJECT_TYPE_OCH=640
+ * LAI_OBJECT_TYPE_OCH.stats=LAI_OCH_STAT_INPUT_POWER,LAI_OCH_STAT_OUTPUT_POWER
+ * LAI_OBJECT_TYPE_OCH.alarms=LAI_ALARM_TYPE_LOS
+ */
+#define LAI_KEY_VS_LINECARD_SCALE_FILE      "LAI_VS_LINECARD_SCALE_FILE"
+
 /**
  * @def LAI_KEY_VS_INTERFACE_FABRIC_LANE_MAP_FILE
  *
@@ -73,6 +168,7 @@ extern "C" {
 #define LAI_KEY_VS_CORE_PORT_INDEX_MAP_FILE  "LAI_VS_CORE_PORT_INDEX_MAP_FILE"
 
 #define LAI_VALUE_VS_LINECARD_TYPE_P230C        "LAI_VS_LINECARD_TYPE_P230C"
+#define LAI_VALUE_VS_LINECARD_TYPE_SCALABLE     "LAI_VS_LINECARD_TYPE_SCALABLE"
 
 /*
  * Values for LAI_KEY_BOOT_TYPE (defined in lailinecard.h)
@@ -133,4 +229,15 @@ typedef enum _lai_vs_linecard_attr_t
      */
     LAI_VS_LINECARD_ATTR_META_ALLOW_READ_ONLY_ONCE,
 
+    /**
+     * @brief Objects created internally by virtual linecard.
+     *
+     * Those objects are not referenced by any linecard attribute, syncd
+     * queries this attribute on discovery to learn about them.
+     *
+     * @type lai_object_list_t
+     * @flags READ_ONLY
+     */
+    LAI_VS_LINECARD_ATTR_INTERNAL_OBJECT_LIST,
+
 } sau_vs_linecard_attr_t;
@@ -0,0 +1,57 @@
+#include "AttrHash.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+AttrHash::AttrHash(
+        _In_ lai_object_id_t objectId):
+    m_objectId(objectId)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+lai_object_id_t AttrHash::getObjectId() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectId;
+}
+
+std::shared_ptr<LaiAttrWrap> AttrHash::getAttr(
+        _In_ lai_attr_id_t id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto attr = m_attrs.find(id);
+
+    return attr ? *attr : nullptr;
+}
+
+void AttrHash::setAttr(
+        _In_ std::shared_ptr<LaiAttrWrap> attr)
+{
+    SWSS_LOG_ENTER();
+
+    m_attrs[attr->getAttr()->id] = attr;
+}
+
+std::vector<std::shared_ptr<LaiAttrWrap>> AttrHash::getAttrs() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::shared_ptr<LaiAttrWrap>> vec;
+
+    vec.reserve(m_attrs.size());
+
+    m_attrs.forEach([&](const std::shared_ptr<LaiAttrWrap>& attr) {
+            if (attr)
+            {
+                vec.push_back(attr);
+            }
+            });
+
+    return vec;
+}
@@ -0,0 +1,86 @@
+#include "CounterModel.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+CounterModel::CounterModel():
+    m_seed(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultModel.m_rate = 0;
+    m_defaultModel.m_generator = std::make_shared<ValueGenerator>((int64_t)1);
+}
+
+uint64_t CounterModel::getSeed() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_seed;
+}
+
+void CounterModel::setSeed(
+        _In_ uint64_t seed)
+{
+    SWSS_LOG_ENTER();
+
+    m_seed = seed;
+}
+
+void CounterModel::setDefaultModel(
+        _In_ const Model& model)
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultModel = model;
+}
+
+void CounterModel::setModel(
+        _In_ const lai_stat_metadata_t* meta,
+        _In_ const Model& model)
+{
+    SWSS_LOG_ENTER();
+
+    if (meta == nullptr)
+    {
+        SWSS_LOG_THROW("stat metadata is NULL");
+    }
+
+    m_models[meta] = model;
+}
+
+const CounterModel::Model& CounterModel::getModel(
+        _In_ const lai_stat_metadata_t* meta) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_models.find(meta);
+
+    return (it == m_models.end()) ? m_defaultModel : it->second;
+}
+
+bool CounterModel::parseModel(
+        _In_ const std::string& str,
+        _Out_ Model& model)
+{
+    SWSS_LOG_ENTER();
+
+    model.m_rate = 0;
+    model.m_generator = nullptr;
+
+    if (str.compare(0, 5, "rate:") == 0)
+    {
+        if (sscanf(str.c_str() + 5, "%lf", &model.m_rate) != 1 || model.m_rate < 0)
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as non negative rate", str.c_str());
+            return false;
+        }
+
+        return true;
+    }
+
+    model.m_generator = ValueGenerator::parse(str);
+
+    return model.m_generator != nullptr;
+}
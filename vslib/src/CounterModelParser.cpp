@@ -0,0 +1,121 @@
+#include "CounterModelParser.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include "meta/MetadataIndex.h"
+
+#include <fstream>
+#include <inttypes.h>
+
+using namespace laivs;
+
+std::shared_ptr<CounterModel> CounterModelParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, returning default counter model");
+
+        return std::make_shared<CounterModel>();
+    }
+
+    std::string file(fileName);
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open counter model file: %s", file.c_str());
+
+        return std::make_shared<CounterModel>();
+    }
+
+    SWSS_LOG_NOTICE("loading counter model from: %s", file.c_str());
+
+    std::string line;
+
+    auto model = std::make_shared<CounterModel>();
+
+    while (getline(ifs, line))
+    {
+        /*
+         * line can be in 2 forms:
+         *
+         * option=value
+         * LAI_XXX_STAT_YYY=model
+         *
+         * where option is one of seed or default
+         */
+
+        if (line.size() == 0 || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("line: %s", line.c_str());
+
+        auto toks = swss::tokenize(line, '=');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected 2 tokens, got: %zu on line: %s", toks.size(), line.c_str());
+            continue;
+        }
+
+        parse(model, toks.at(0), toks.at(1));
+    }
+
+    return model;
+}
+
+void CounterModelParser::parse(
+        _In_ std::shared_ptr<CounterModel> model,
+        _In_ const std::string& key,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (key == "seed")
+    {
+        uint64_t seed;
+
+        if (sscanf(value.c_str(), "%" SCNu64, &seed) != 1)
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as seed", value.c_str());
+            return;
+        }
+
+        model->setSeed(seed);
+
+        return;
+    }
+
+    CounterModel::Model m;
+
+    if (!CounterModel::parseModel(value, m))
+    {
+        return;
+    }
+
+    if (key == "default")
+    {
+        model->setDefaultModel(m);
+
+        return;
+    }
+
+    auto meta = laimeta::MetadataIndex::getInstance().getStatMetadata(key);
+
+    if (meta == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to find stat metadata for %s", key.c_str());
+        return;
+    }
+
+    SWSS_LOG_NOTICE("adding counter model %s = %s", key.c_str(), value.c_str());
+
+    model->setModel(meta, m);
+}
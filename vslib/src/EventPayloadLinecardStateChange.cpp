@@ -0,0 +1,21 @@
+#include "EventPayloadLinecardStateChange.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+EventPayloadLinecardStateChange::EventPayloadLinecardStateChange(
+        _In_ lai_oper_status_t operStatus):
+    m_operStatus(operStatus)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+lai_oper_status_t EventPayloadLinecardStateChange::getOperStatus() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_operStatus;
+}
@@ -0,0 +1,30 @@
+#include "EventPayloadReplayNotification.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+EventPayloadReplayNotification::EventPayloadReplayNotification(
+        _In_ const std::string& name,
+        _In_ const std::string& serializedNotification):
+    m_name(name),
+    m_serializedNotification(serializedNotification)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+const std::string& EventPayloadReplayNotification::getName() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_name;
+}
+
+const std::string& EventPayloadReplayNotification::getSerializedNotification() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_serializedNotification;
+}
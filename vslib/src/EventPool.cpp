@@ -0,0 +1,95 @@
+#include "EventPool.h"
+
+#include "swss/logger.h"
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+using namespace laivs;
+
+namespace
+{
+    typedef struct _SizeClass
+    {
+        std::mutex m_mutex;
+
+        std::vector<void*> m_freeBlocks;
+
+    } SizeClass;
+
+    SizeClass& getSizeClass(
+            _In_ size_t idx)
+    {
+        // never destroyed, events can be released during static destruction
+
+        static SizeClass* sizeClasses = new SizeClass[EventPool::CLASS_COUNT];
+
+        return sizeClasses[idx];
+    }
+
+    size_t sizeClassIndex(
+            _In_ size_t size)
+    {
+        return (size + EventPool::BLOCK_ALIGN - 1) / EventPool::BLOCK_ALIGN - 1;
+    }
+}
+
+void* EventPool::allocate(
+        _In_ size_t size)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    size_t idx = sizeClassIndex(size);
+
+    if (size == 0 || idx >= CLASS_COUNT)
+    {
+        return ::operator new(size);
+    }
+
+    auto& sc = getSizeClass(idx);
+
+    {
+        std::lock_guard<std::mutex> lock(sc.m_mutex);
+
+        if (sc.m_freeBlocks.size())
+        {
+            void* ptr = sc.m_freeBlocks.back();
+
+            sc.m_freeBlocks.pop_back();
+
+            return ptr;
+        }
+    }
+
+    return ::operator new((idx + 1) * BLOCK_ALIGN);
+}
+
+void EventPool::deallocate(
+        _In_ void* ptr,
+        _In_ size_t size)
+{
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    size_t idx = sizeClassIndex(size);
+
+    if (size == 0 || idx >= CLASS_COUNT)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto& sc = getSizeClass(idx);
+
+    {
+        std::lock_guard<std::mutex> lock(sc.m_mutex);
+
+        if (sc.m_freeBlocks.size() < MAX_FREE_BLOCKS)
+        {
+            sc.m_freeBlocks.push_back(ptr);
+            return;
+        }
+    }
+
+    ::operator delete(ptr);
+}
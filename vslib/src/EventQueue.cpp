@@ -2,54 +2,175 @@
 
 #include "swss/logger.h"
 
-using namespace laivs;
+#define EVENT_QUEUE_DROP_COUNT_INDICATOR (1000)
 
-#define QUEUE_MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+using namespace laivs;
 
 EventQueue::EventQueue(
-        _In_ std::shared_ptr<Signal> signal):
-    m_signal(signal)
+        _In_ std::shared_ptr<Signal> signal,
+        _In_ size_t capacity):
+    m_signal(signal),
+    m_enqueuePos(0),
+    m_dequeuePos(0),
+    m_dropCount(0)
 {
     SWSS_LOG_ENTER();
 
-    // empty
+    size_t size = 2;
+
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+
+    m_slots = std::vector<Slot>(size);
+
+    m_mask = size - 1;
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        m_slots[idx].m_sequence.store(idx, std::memory_order_relaxed);
+    }
 }
 
-void EventQueue::enqueue(
+bool EventQueue::enqueue(
         _In_ std::shared_ptr<Event> event)
 {
     SWSS_LOG_ENTER();
 
-    QUEUE_MUTEX;
+    if (tryEnqueue(event))
+    {
+        return true;
+    }
+
+    size_t dropCount = ++m_dropCount;
+
+    if (dropCount % EVENT_QUEUE_DROP_COUNT_INDICATOR == 1)
+    {
+        SWSS_LOG_ERROR("event queue is full (%zu), dropped %zu events so far",
+                m_slots.size(),
+                dropCount);
+    }
+
+    return false;
+}
+
+bool EventQueue::tryEnqueue(
+        _In_ const std::shared_ptr<Event>& event)
+{
+    SWSS_LOG_ENTER();
+
+    if (event == nullptr)
+    {
+        SWSS_LOG_THROW("event is NULL");
+    }
+
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+    Slot* slot;
 
-    m_queue.push_back(event);
+    while (true)
+    {
+        slot = &m_slots[pos & m_mask];
+
+        size_t seq = slot->m_sequence.load(std::memory_order_acquire);
+
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // slot still holds event from previous lap, queue is full
+
+            m_signal->notifyAll();
+
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->m_event = event;
+
+    slot->m_sequence.store(pos + 1, std::memory_order_release);
 
     m_signal->notifyAll();
+
+    return true;
 }
 
 std::shared_ptr<Event> EventQueue::dequeue()
 {
     SWSS_LOG_ENTER();
 
-    QUEUE_MUTEX;
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+
+    auto& slot = m_slots[pos & m_mask];
+
+    if (slot.m_sequence.load(std::memory_order_acquire) != pos + 1)
+    {
+        return nullptr;
+    }
+
+    auto event = std::move(slot.m_event);
+
+    slot.m_event = nullptr;
+
+    slot.m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+    m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+
+    return event;
+}
+
+size_t EventQueue::dequeue(
+        _Inout_ std::vector<std::shared_ptr<Event>>& events,
+        _In_ size_t maxCount)
+{
+    SWSS_LOG_ENTER();
+
+    size_t count = 0;
 
-    if (m_queue.size())
+    while (count < maxCount)
     {
-        auto item = m_queue.front();
+        auto event = dequeue();
+
+        if (event == nullptr)
+        {
+            break;
+        }
 
-        m_queue.pop_front();
+        events.push_back(std::move(event));
 
-        return item;
+        count++;
     }
 
-    return nullptr;
+    return count;
 }
 
 size_t EventQueue::size()
 {
     SWSS_LOG_ENTER();
 
-    QUEUE_MUTEX;
+    size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+    size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+
+    // producers may have claimed slots which are not yet filled
+
+    return (enqueuePos > dequeuePos) ? (enqueuePos - dequeuePos) : 0;
+}
+
+size_t EventQueue::getDropCount() const
+{
+    SWSS_LOG_ENTER();
 
-    return m_queue.size();
+    return m_dropCount.load(std::memory_order_relaxed);
 }
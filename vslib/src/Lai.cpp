@@ -4,10 +4,17 @@
 #include "VirtualLinecardLaiInterface.h"
 #include "LinecardStateBase.h"
 #include "LaneMapFileParser.h"
+#include "LinecardScaleParser.h"
+#include "LatencyProfileParser.h"
+#include "CounterModelParser.h"
+#include "RecordingReplayParser.h"
 #include "LinecardConfigContainer.h"
 #include "ResourceLimiterParser.h"
+#include "SimulationProfileParser.h"
 #include "CorePortIndexMapFileParser.h"
 
+#include "meta/lai_serialize.h"
+
 #include "swss/logger.h"
 
 #include "swss/notificationconsumer.h"
@@ -34,6 +41,8 @@ Lai::Lai()
 
     m_unittestChannelRun = false;
 
+    m_replayThreadRun = false;
+
     m_apiInitialized = false;
 
     m_isLinkUp = true;
@@ -108,6 +117,43 @@ lai_status_t Lai::initialize(
 
     m_resourceLimiterContainer = ResourceLimiterParser::parseFromFile(resourceLimiterFile);
 
+    auto *latencyProfileFile = service_method_table->profile_get_value(0, LAI_KEY_VS_LATENCY_PROFILE_FILE);
+
+    auto latencyProfile = LatencyProfileParser::parseFromFile(latencyProfileFile);
+
+    auto *simulationFile = service_method_table->profile_get_value(0, LAI_KEY_VS_SIMULATION_FILE);
+
+    auto simulationProfile = SimulationProfileParser::parseFromFile(simulationFile);
+
+    auto *counterModelFile = service_method_table->profile_get_value(0, LAI_KEY_VS_COUNTER_MODEL_FILE);
+
+    auto counterModel = CounterModelParser::parseFromFile(counterModelFile);
+
+    auto *replayFile = service_method_table->profile_get_value(0, LAI_KEY_VS_REPLAY_FILE);
+
+    auto *replaySpeed = service_method_table->profile_get_value(0, LAI_KEY_VS_REPLAY_SPEED);
+
+    double speed;
+
+    if (!RecordingReplayParser::parseSpeed(replaySpeed, speed))
+    {
+        return LAI_STATUS_FAILURE;
+    }
+
+    m_recordingReplay = RecordingReplayParser::parseFromFile(replayFile);
+
+    m_recordingReplay->setSpeed(speed);
+
+    auto *laneMapFile = service_method_table->profile_get_value(0, LAI_KEY_VS_INTERFACE_LANE_MAP_FILE);
+
+    auto laneMapContainer = LaneMapFileParser::parseLaneMapFile(laneMapFile);
+
+    auto *scaleFile = service_method_table->profile_get_value(0, LAI_KEY_VS_LINECARD_SCALE_FILE);
+
+    auto *corePortIndexMapFile = service_method_table->profile_get_value(0, LAI_KEY_VS_CORE_PORT_INDEX_MAP_FILE);
+
+    m_corePortIndexMapContainer = CorePortIndexMapFileParser::parseCorePortIndexMapFile(corePortIndexMapFile);
+
     auto boot_type          = service_method_table->profile_get_value(0, LAI_KEY_BOOT_TYPE);
 
     lai_vs_boot_type_t bootType;
@@ -135,6 +181,13 @@ lai_status_t Lai::initialize(
     sc->m_linecardIndex = 0;
     sc->m_eventQueue = m_eventQueue;
     sc->m_resourceLimiter = m_resourceLimiterContainer->getResourceLimiter(sc->m_linecardIndex);
+    sc->m_simulationProfile = simulationProfile;
+    sc->m_latencyProfile = latencyProfile;
+    sc->m_counterModel = counterModel;
+    sc->m_recordingReplay = m_recordingReplay;
+    sc->m_laneMap = laneMapContainer->getLaneMap(sc->m_linecardIndex);
+    sc->m_linecardScale = LinecardScaleParser::parseFromFile(scaleFile);
+    sc->m_corePortIndexMap = m_corePortIndexMapContainer->getCorePortIndexMap(sc->m_linecardIndex);
 
     auto scc = std::make_shared<LinecardConfigContainer>();
 
@@ -178,6 +231,8 @@ lai_status_t Lai::uninitialize(void)
 
     stopUnittestThread();
 
+    stopReplayThread();
+
     stopEventQueueThread();
 
     stopCheckLinkThread();
@@ -214,12 +269,49 @@ lai_status_t Lai::create(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
-    return m_meta->create(
+    auto status = m_meta->create(
             objectType,
             objectId,
             linecardId,
             attr_count,
             attr_list);
+
+    if (objectType == LAI_OBJECT_TYPE_LINECARD && status == LAI_STATUS_SUCCESS)
+    {
+        // internal objects are created through metadata, so they can be
+        // validated and referenced like objects created by user
+
+        status = m_vsLai->createInternalObjects(*objectId);
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("failed to create internal objects on linecard %s, removing linecard",
+                    lai_serialize_object_id(*objectId).c_str());
+
+            // caller sees failed create, so linecard and objects created so
+            // far can't stay behind
+
+            m_vsLai->removeInternalObjects(*objectId);
+
+            if (m_meta->remove(LAI_OBJECT_TYPE_LINECARD, *objectId) != LAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("failed to remove linecard %s",
+                        lai_serialize_object_id(*objectId).c_str());
+            }
+
+            *objectId = LAI_NULL_OBJECT_ID;
+
+            return status;
+        }
+
+        // recording time starts at linecard create, so replay starts here
+
+        stopReplayThread();
+
+        startReplayThread();
+    }
+
+    return status;
 }
 
 lai_status_t Lai::remove(
@@ -272,6 +364,12 @@ lai_status_t Lai::get(
     SWSS_LOG_ENTER();
     VS_CHECK_API_INITIALIZED();
 
+    if (objectType == LAI_OBJECT_TYPE_LINECARD && attr_count == 1 && attr_list &&
+            attr_list[0].id == LAI_VS_LINECARD_ATTR_INTERNAL_OBJECT_LIST)
+    {
+        return m_vsLai->getInternalObjectList(objectId, attr_list[0].value.objlist);
+    }
+
     return m_meta->get(
             objectType,
             objectId,
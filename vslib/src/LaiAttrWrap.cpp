@@ -26,6 +26,8 @@ LaiAttrWrap::LaiAttrWrap(
 
     m_value = lai_serialize_attr_value(*m_meta, *attr, false);
 
+    m_valueValid = true;
+
     lai_deserialize_attr_value(m_value, *m_meta, m_attr, false);
 }
 
@@ -46,6 +48,8 @@ LaiAttrWrap::LaiAttrWrap(
 
     m_value = attrValue;
 
+    m_valueValid = true;
+
     lai_deserialize_attr_value(attrValue.c_str(), *m_meta, m_attr, false);
 }
 
@@ -79,47 +83,61 @@ const std::string& LaiAttrWrap::getAttrStrValue() const
 {
     SWSS_LOG_ENTER();
 
+    if (!m_valueValid)
+    {
+        m_value.clear();
+
+        lai_serialize_attr_value_append(m_value, *m_meta, m_attr, false);
+
+        m_valueValid = true;
+    }
+
     return m_value;
 }
 
-void LaiAttrWrap::updateValue()
+void LaiAttrWrap::updateValue(
+        _In_ const lai_attribute_t *attr)
 {
+    SWSS_LOG_ENTER();
+
+    if (attr->id != m_attr.id)
+    {
+        SWSS_LOG_THROW("attribute id %d doesn't match %s", attr->id, m_meta->attridname);
+    }
 
     switch (m_meta->attrvaluetype)
     {
         case LAI_ATTR_VALUE_TYPE_BOOL:
-            m_attr.value.booldata = !m_attr.value.booldata;
-            break;
         case LAI_ATTR_VALUE_TYPE_UINT8:
-            m_attr.value.u8++;
-            break;
         case LAI_ATTR_VALUE_TYPE_INT8:
-            m_attr.value.s8++;
-            break;
         case LAI_ATTR_VALUE_TYPE_UINT16:
-            m_attr.value.u16++;
-            break;
         case LAI_ATTR_VALUE_TYPE_INT16:
-            m_attr.value.s16++;
-            break;
         case LAI_ATTR_VALUE_TYPE_UINT32:
-            m_attr.value.u32++;
-            break;
         case LAI_ATTR_VALUE_TYPE_INT32:
-            if (m_meta->isenum == false) {
-                m_attr.value.s32++;
-            }
-            break;
         case LAI_ATTR_VALUE_TYPE_UINT64:
-            m_attr.value.u64++;
-            break;
         case LAI_ATTR_VALUE_TYPE_INT64:
-            m_attr.value.s64++;
-            break;
         case LAI_ATTR_VALUE_TYPE_DOUBLE:
-            m_attr.value.d64 = m_attr.value.d64 + 1.0;
+
+            // primitive value, no memory is owned by attribute
+
+            m_attr.value = attr->value;
+
+            m_valueValid = false;
+
             break;
+
         default:
+
+            // serialized value is needed anyway to make deep copy of list
+
+            lai_deserialize_free_attribute_value(m_meta->attrvaluetype, m_attr);
+
+            m_value = lai_serialize_attr_value(*m_meta, *attr, false);
+
+            m_valueValid = true;
+
+            lai_deserialize_attr_value(m_value, *m_meta, m_attr, false);
+
             break;
-    }    
+    }
 }
@@ -2,6 +2,7 @@
 #include "LaiInternal.h"
 
 #include "laivs.h"
+#include "EventPayloadLinecardStateChange.h"
 #include "meta/lai_serialize.h"
 
 #include "swss/logger.h"
@@ -39,9 +40,6 @@ void Lai::stopCheckLinkThread()
 #include <fstream>
 #include <unistd.h>
 
-extern int g_linecard_state_change;
-extern lai_oper_status_t g_linecard_state;
-
 void Lai::checkLinkThreadProc()
 {
     SWSS_LOG_ENTER();
@@ -57,12 +55,12 @@ void Lai::checkLinkThreadProc()
             std::getline(ifs, line);
             if (line == "1" && m_isLinkUp == false) {
                 m_isLinkUp = true;
-                g_linecard_state_change = 1;
-                g_linecard_state = LAI_OPER_STATUS_ACTIVE;
+                m_eventQueue->enqueue(EventQueue::makeEvent<EventPayloadLinecardStateChange>(
+                            EVENT_TYPE_LINECARD_STATE_CHANGE, LAI_OPER_STATUS_ACTIVE));
             } else if (line == "0" && m_isLinkUp == true) {
                 m_isLinkUp = false;
-                g_linecard_state_change = 1;
-                g_linecard_state = LAI_OPER_STATUS_INACTIVE;
+                m_eventQueue->enqueue(EventQueue::makeEvent<EventPayloadLinecardStateChange>(
+                            EVENT_TYPE_LINECARD_STATE_CHANGE, LAI_OPER_STATUS_INACTIVE));
             }
         }
         ifs.close();
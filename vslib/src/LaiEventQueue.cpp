@@ -3,6 +3,11 @@
 
 #include "swss/logger.h"
 
+/*
+ * Max number of events dequeued at once by event queue thread.
+ */
+#define EVENT_QUEUE_BATCH_SIZE 64
+
 using namespace laivs;
 
 void Lai::startEventQueueThread()
@@ -24,7 +29,7 @@ void Lai::stopEventQueueThread()
     {
         m_eventQueueThreadRun = false;
 
-        m_eventQueue->enqueue(std::make_shared<Event>(EventType::EVENT_TYPE_END_THREAD, nullptr));
+        m_eventQueue->enqueue(EventPool::makeShared<Event>(EventType::EVENT_TYPE_END_THREAD, nullptr));
 
         m_eventQueueThread->join();
     }
@@ -36,13 +41,22 @@ void Lai::eventQueueThreadProc()
 {
     SWSS_LOG_ENTER();
 
+    std::vector<std::shared_ptr<Event>> events;
+
+    events.reserve(EVENT_QUEUE_BATCH_SIZE);
+
     while (m_eventQueueThreadRun)
     {
         m_signal->wait();
 
-        while (auto event = m_eventQueue->dequeue())
+        while (m_eventQueue->dequeue(events, EVENT_QUEUE_BATCH_SIZE))
         {
-            processQueueEvent(event);
+            for (auto& event: events)
+            {
+                processQueueEvent(event);
+            }
+
+            events.clear();
         }
     }
 }
@@ -67,6 +81,12 @@ void Lai::processQueueEvent(
         case EVENT_TYPE_NOTIFICATION:
             return asyncProcessEventNotification(std::dynamic_pointer_cast<EventPayloadNotification>(event->getPayload()));
 
+        case EVENT_TYPE_LINECARD_STATE_CHANGE:
+            return syncProcessEventLinecardStateChange(std::dynamic_pointer_cast<EventPayloadLinecardStateChange>(event->getPayload()));
+
+        case EVENT_TYPE_REPLAY_NOTIFICATION:
+            return syncProcessEventReplayNotification(std::dynamic_pointer_cast<EventPayloadReplayNotification>(event->getPayload()));
+
         default:
 
             SWSS_LOG_THROW("unhandled event type: %d", type);
@@ -95,3 +115,23 @@ void Lai::asyncProcessEventNotification(
 
     ntf->executeCallback(linecardNotifications);
 }
+
+void Lai::syncProcessEventLinecardStateChange(
+        _In_ std::shared_ptr<EventPayloadLinecardStateChange> payload)
+{
+    MUTEX();
+
+    SWSS_LOG_ENTER();
+
+    m_vsLai->syncProcessEventLinecardStateChange(payload);
+}
+
+void Lai::syncProcessEventReplayNotification(
+        _In_ std::shared_ptr<EventPayloadReplayNotification> payload)
+{
+    MUTEX();
+
+    SWSS_LOG_ENTER();
+
+    m_vsLai->syncProcessEventReplayNotification(payload);
+}
@@ -0,0 +1,95 @@
+#include "Lai.h"
+#include "LaiInternal.h"
+
+#include "EventPayloadReplayNotification.h"
+
+#include "swss/logger.h"
+
+#define REPLAY_QUEUE_FULL_WAIT_MS (1)
+
+using namespace laivs;
+
+void Lai::startReplayThread()
+{
+    SWSS_LOG_ENTER();
+
+    // called when linecard is created, replay clock is started even without
+    // notifications, since recorded values are also returned at recorded
+    // cadence
+
+    m_recordingReplay->start();
+
+    if (m_recordingReplay->getNotifications().empty())
+    {
+        return;
+    }
+
+    m_replayThreadRun = true;
+
+    m_replayThread = std::make_shared<std::thread>(&Lai::replayThreadProc, this);
+}
+
+void Lai::stopReplayThread()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("begin");
+
+    if (m_replayThread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_replayMutex);
+
+            m_replayThreadRun = false;
+        }
+
+        m_replayCv.notify_all();
+
+        m_replayThread->join();
+
+        m_replayThread = nullptr;
+    }
+
+    SWSS_LOG_NOTICE("end");
+}
+
+void Lai::replayThreadProc()
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("enter VS replay thread, speed %f", m_recordingReplay->getSpeed());
+
+    std::unique_lock<std::mutex> lock(m_replayMutex);
+
+    for (auto& ntf: m_recordingReplay->getNotifications())
+    {
+        auto when = m_recordingReplay->getEmitTime(ntf);
+
+        if (m_replayCv.wait_until(lock, when, [this] { return !m_replayThreadRun; }))
+        {
+            break;
+        }
+
+        // notifications recorded at the same time are enqueued as burst,
+        // like alarm storm on real device, burst larger than event queue
+        // waits for consumer instead of being dropped
+
+        auto event = EventQueue::makeEvent<EventPayloadReplayNotification>(
+                EVENT_TYPE_REPLAY_NOTIFICATION, ntf.m_name, ntf.m_serializedNotification);
+
+        while (!m_eventQueue->tryEnqueue(event))
+        {
+            if (m_replayCv.wait_for(lock, std::chrono::milliseconds(REPLAY_QUEUE_FULL_WAIT_MS), [this] { return !m_replayThreadRun; }))
+            {
+                break;
+            }
+        }
+
+        if (!m_replayThreadRun)
+        {
+            break;
+        }
+    }
+
+    SWSS_LOG_NOTICE("exit VS replay thread");
+}
@@ -0,0 +1,266 @@
+#include "LatencyProfile.h"
+
+#include "swss/logger.h"
+
+#include <inttypes.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace laivs;
+
+#define MUTEX std::lock_guard<std::mutex> _lock(m_mutex);
+
+LatencyProfile::LatencyProfile():
+    m_probability(0.0, 1.0)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void LatencyProfile::setSeed(
+        _In_ uint64_t seed)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX;
+
+    m_generator.seed(seed);
+}
+
+void LatencyProfile::setRule(
+        _In_ lai_vs_latency_api_t api,
+        _In_ lai_object_type_t objectType,
+        _In_ const Rule& rule)
+{
+    SWSS_LOG_ENTER();
+
+    MUTEX;
+
+    m_rules[std::make_pair(api, objectType)] = rule;
+}
+
+const LatencyProfile::Rule* LatencyProfile::getRule(
+        _In_ lai_vs_latency_api_t api,
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    const std::pair<lai_vs_latency_api_t, lai_object_type_t> keys[] = {
+        std::make_pair(api, objectType),
+        std::make_pair(api, (lai_object_type_t)ANY_OBJECT_TYPE),
+        std::make_pair(LAI_VS_LATENCY_API_ANY, objectType),
+        std::make_pair(LAI_VS_LATENCY_API_ANY, (lai_object_type_t)ANY_OBJECT_TYPE),
+    };
+
+    for (auto& key: keys)
+    {
+        auto it = m_rules.find(key);
+
+        if (it != m_rules.end())
+        {
+            return &it->second;
+        }
+    }
+
+    return nullptr;
+}
+
+bool LatencyProfile::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_rules.empty();
+}
+
+LatencyProfile::Rule LatencyProfile::getDefaultRule()
+{
+    SWSS_LOG_ENTER();
+
+    Rule rule;
+
+    rule.m_distribution = LAI_VS_LATENCY_DISTRIBUTION_UNIFORM;
+    rule.m_latencyUs = 0;
+    rule.m_jitterUs = 0;
+    rule.m_timeoutUs = 0;
+    rule.m_timeoutRate = 0;
+    rule.m_notReadyRate = 0;
+    rule.m_failureRate = 0;
+
+    return rule;
+}
+
+uint64_t LatencyProfile::drawLatencyUs(
+        _In_ const Rule& rule)
+{
+    SWSS_LOG_ENTER();
+
+    double latency = rule.m_latencyUs;
+
+    switch (rule.m_distribution)
+    {
+        case LAI_VS_LATENCY_DISTRIBUTION_UNIFORM:
+
+            if (rule.m_jitterUs)
+            {
+                latency += (2 * m_probability(m_generator) - 1) * rule.m_jitterUs;
+            }
+
+            break;
+
+        case LAI_VS_LATENCY_DISTRIBUTION_NORMAL:
+
+            if (rule.m_jitterUs)
+            {
+                std::normal_distribution<double> normal(latency, rule.m_jitterUs);
+
+                latency = normal(m_generator);
+            }
+
+            break;
+
+        case LAI_VS_LATENCY_DISTRIBUTION_EXPONENTIAL:
+
+            if (rule.m_latencyUs)
+            {
+                std::exponential_distribution<double> exponential(1.0 / rule.m_latencyUs);
+
+                latency = exponential(m_generator);
+            }
+
+            break;
+
+        default:
+
+            SWSS_LOG_THROW("unknown latency distribution %d", rule.m_distribution);
+    }
+
+    return (latency > 0) ? (uint64_t)latency : 0;
+}
+
+lai_status_t LatencyProfile::inject(
+        _In_ lai_vs_latency_api_t api,
+        _In_ lai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_rules.empty())
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    auto rule = getRule(api, objectType);
+
+    if (rule == nullptr)
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    uint64_t sleepUs;
+
+    lai_status_t status = LAI_STATUS_SUCCESS;
+
+    {
+        MUTEX;
+
+        // draw all values under profile lock only, sleep happens outside of
+        // it, but still under vslib api lock, so calls are serialized and
+        // latencies add up like on driver with single command queue
+
+        if (rule->m_timeoutRate > 0 && m_probability(m_generator) < rule->m_timeoutRate)
+        {
+            sleepUs = rule->m_timeoutUs;
+
+            status = LAI_STATUS_FAILURE;
+        }
+        else
+        {
+            sleepUs = drawLatencyUs(*rule);
+
+            if (rule->m_notReadyRate > 0 && m_probability(m_generator) < rule->m_notReadyRate)
+            {
+                status = LAI_STATUS_OBJECT_NOT_READY;
+            }
+            else if (rule->m_failureRate > 0 && m_probability(m_generator) < rule->m_failureRate)
+            {
+                status = LAI_STATUS_FAILURE;
+            }
+        }
+    }
+
+    if (sleepUs)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(sleepUs));
+    }
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_INFO("injecting status %d on api %d object type %d after %" PRIu64 " us",
+                status,
+                api,
+                objectType,
+                sleepUs);
+    }
+
+    return status;
+}
+
+bool LatencyProfile::parseApi(
+        _In_ const std::string& str,
+        _Out_ lai_vs_latency_api_t& api)
+{
+    SWSS_LOG_ENTER();
+
+    static const std::map<std::string, lai_vs_latency_api_t> apis = {
+        { "*",              LAI_VS_LATENCY_API_ANY },
+        { "create",         LAI_VS_LATENCY_API_CREATE },
+        { "remove",         LAI_VS_LATENCY_API_REMOVE },
+        { "set",            LAI_VS_LATENCY_API_SET },
+        { "get",            LAI_VS_LATENCY_API_GET },
+        { "get_stats",      LAI_VS_LATENCY_API_GET_STATS },
+        { "get_alarms",     LAI_VS_LATENCY_API_GET_ALARMS },
+        { "clear_alarms",   LAI_VS_LATENCY_API_CLEAR_ALARMS },
+    };
+
+    auto it = apis.find(str);
+
+    if (it == apis.end())
+    {
+        SWSS_LOG_ERROR("unknown api '%s'", str.c_str());
+        return false;
+    }
+
+    api = it->second;
+
+    return true;
+}
+
+bool LatencyProfile::parseDistribution(
+        _In_ const std::string& str,
+        _Out_ lai_vs_latency_distribution_t& distribution)
+{
+    SWSS_LOG_ENTER();
+
+    if (str == "uniform")
+    {
+        distribution = LAI_VS_LATENCY_DISTRIBUTION_UNIFORM;
+        return true;
+    }
+
+    if (str == "normal")
+    {
+        distribution = LAI_VS_LATENCY_DISTRIBUTION_NORMAL;
+        return true;
+    }
+
+    if (str == "exponential")
+    {
+        distribution = LAI_VS_LATENCY_DISTRIBUTION_EXPONENTIAL;
+        return true;
+    }
+
+    SWSS_LOG_ERROR("unknown latency distribution '%s'", str.c_str());
+
+    return false;
+}
@@ -0,0 +1,235 @@
+#include "LatencyProfileParser.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include "meta/lai_serialize.h"
+
+#include <fstream>
+#include <inttypes.h>
+
+using namespace laivs;
+
+std::shared_ptr<LatencyProfile> LatencyProfileParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, returning empty latency profile");
+
+        return std::make_shared<LatencyProfile>();
+    }
+
+    std::string file(fileName);
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open latency profile file: %s", file.c_str());
+
+        return std::make_shared<LatencyProfile>();
+    }
+
+    SWSS_LOG_NOTICE("loading latency profile from: %s", file.c_str());
+
+    std::string line;
+
+    auto profile = std::make_shared<LatencyProfile>();
+
+    while (getline(ifs, line))
+    {
+        /*
+         * line can be in 2 forms:
+         *
+         * seed=N
+         * api:LAI_OBJECT_TYPE_XXX=param:value[,param:value...]
+         *
+         * where api is one of create, remove, set, get, get_stats,
+         * get_alarms, clear_alarms, and both api and object type can be
+         * '*' to match any
+         */
+
+        if (line.size() == 0 || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("line: %s", line.c_str());
+
+        auto toks = swss::tokenize(line, '=');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected 2 tokens, got: %zu on line: %s", toks.size(), line.c_str());
+            continue;
+        }
+
+        parse(profile, toks.at(0), toks.at(1));
+    }
+
+    return profile;
+}
+
+bool LatencyProfileParser::parseUint32(
+        _In_ const std::string& str,
+        _Out_ uint32_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (sscanf(str.c_str(), "%u", &value) != 1)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as number", str.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool LatencyProfileParser::parseRate(
+        _In_ const std::string& str,
+        _Out_ double& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (sscanf(str.c_str(), "%lf", &value) != 1 || value < 0 || value > 1)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as rate in range [0,1]", str.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool LatencyProfileParser::parseRule(
+        _In_ const std::string& str,
+        _Out_ LatencyProfile::Rule& rule)
+{
+    SWSS_LOG_ENTER();
+
+    rule = LatencyProfile::getDefaultRule();
+
+    for (auto& param: swss::tokenize(str, ','))
+    {
+        auto toks = swss::tokenize(param, ':');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected param:value, got: %s", param.c_str());
+            return false;
+        }
+
+        auto& name = toks.at(0);
+        auto& value = toks.at(1);
+
+        bool success;
+
+        if (name == "latency_us")
+        {
+            success = parseUint32(value, rule.m_latencyUs);
+        }
+        else if (name == "jitter_us")
+        {
+            success = parseUint32(value, rule.m_jitterUs);
+        }
+        else if (name == "timeout_us")
+        {
+            success = parseUint32(value, rule.m_timeoutUs);
+        }
+        else if (name == "distribution")
+        {
+            success = LatencyProfile::parseDistribution(value, rule.m_distribution);
+        }
+        else if (name == "timeout_rate")
+        {
+            success = parseRate(value, rule.m_timeoutRate);
+        }
+        else if (name == "not_ready_rate")
+        {
+            success = parseRate(value, rule.m_notReadyRate);
+        }
+        else if (name == "failure_rate")
+        {
+            success = parseRate(value, rule.m_failureRate);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("unknown latency param '%s'", name.c_str());
+
+            success = false;
+        }
+
+        if (!success)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void LatencyProfileParser::parse(
+        _In_ std::shared_ptr<LatencyProfile> profile,
+        _In_ const std::string& key,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (key == "seed")
+    {
+        uint64_t seed;
+
+        if (sscanf(value.c_str(), "%" SCNu64, &seed) != 1)
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as seed", value.c_str());
+            return;
+        }
+
+        profile->setSeed(seed);
+
+        return;
+    }
+
+    auto tokens = swss::tokenize(key, ':');
+
+    if (tokens.size() != 2)
+    {
+        SWSS_LOG_ERROR("expected api:object_type, got: %s", key.c_str());
+        return;
+    }
+
+    lai_vs_latency_api_t api;
+
+    if (!LatencyProfile::parseApi(tokens.at(0), api))
+    {
+        return;
+    }
+
+    lai_object_type_t objectType = LatencyProfile::ANY_OBJECT_TYPE;
+
+    if (tokens.at(1) != "*")
+    {
+        try
+        {
+            lai_deserialize_object_type(tokens.at(1), objectType);
+        }
+        catch(const std::exception& e)
+        {
+            SWSS_LOG_ERROR("failed to deserialize '%s' as object type: %s", tokens.at(1).c_str(), e.what());
+            return;
+        }
+    }
+
+    LatencyProfile::Rule rule;
+
+    if (!parseRule(value, rule))
+    {
+        return;
+    }
+
+    SWSS_LOG_NOTICE("adding latency rule %s = %s", key.c_str(), value.c_str());
+
+    profile->setRule(api, objectType, rule);
+}
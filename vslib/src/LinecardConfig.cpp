@@ -56,11 +56,16 @@ bool LinecardConfig::parseLinecardType(
     {
         linecardType = LAI_VS_LINECARD_TYPE_P230C;
     }
+    else if (st == LAI_VALUE_VS_LINECARD_TYPE_SCALABLE)
+    {
+        linecardType = LAI_VS_LINECARD_TYPE_SCALABLE;
+    }
     else
     {
-        SWSS_LOG_ERROR("unknown linecard type: '%s', expected (%s)",
+        SWSS_LOG_ERROR("unknown linecard type: '%s', expected (%s|%s)",
                 linecardTypeStr,
-                LAI_VALUE_VS_LINECARD_TYPE_P230C);
+                LAI_VALUE_VS_LINECARD_TYPE_P230C,
+                LAI_VALUE_VS_LINECARD_TYPE_SCALABLE);
 
         return false;
     }
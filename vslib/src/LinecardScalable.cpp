@@ -0,0 +1,291 @@
+#include "LinecardScalable.h"
+
+#include "swss/logger.h"
+#include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+using namespace laivs;
+
+static uint64_t getMaxValue(
+        _In_ lai_attr_value_type_t type)
+{
+    SWSS_LOG_ENTER();
+
+    switch (type)
+    {
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+            return std::numeric_limits<uint8_t>::max();
+
+        case LAI_ATTR_VALUE_TYPE_INT8:
+            return std::numeric_limits<int8_t>::max();
+
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+            return std::numeric_limits<uint16_t>::max();
+
+        case LAI_ATTR_VALUE_TYPE_INT16:
+            return std::numeric_limits<int16_t>::max();
+
+        case LAI_ATTR_VALUE_TYPE_INT32:
+            return std::numeric_limits<int32_t>::max();
+
+        default:
+            return std::numeric_limits<uint64_t>::max();
+    }
+}
+
+LinecardScalable::LinecardScalable(
+        _In_ lai_object_id_t linecard_id,
+        _In_ std::shared_ptr<RealObjectIdManager> manager,
+        _In_ std::shared_ptr<LinecardConfig> config):
+    LinecardStateBase(linecard_id, manager, config)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+lai_status_t LinecardScalable::create_internal_objects(
+        _In_ std::shared_ptr<laimeta::Meta> meta)
+{
+    SWSS_LOG_ENTER();
+
+    auto scale = m_linecardConfig->m_linecardScale;
+
+    if (scale == nullptr)
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    SWSS_LOG_TIMER("create scaled objects");
+
+    auto counts = scale->getObjectCounts();
+
+    if (!scale->hasObjectCount(LAI_OBJECT_TYPE_PORT))
+    {
+        counts[LAI_OBJECT_TYPE_PORT] = (uint32_t)getInterfaceNames().size();
+    }
+
+    for (auto& kvp: counts)
+    {
+        CHECK_STATUS(create_scaled_objects(meta, kvp.first, kvp.second));
+    }
+
+    return LAI_STATUS_SUCCESS;
+}
+
+lai_status_t LinecardScalable::create_scaled_objects(
+        _In_ std::shared_ptr<laimeta::Meta> meta,
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_NOTICE("creating %u objects of %s",
+            count,
+            lai_serialize_object_type(objectType).c_str());
+
+    auto& alarms = m_linecardConfig->m_linecardScale->getAlarms(objectType);
+
+    auto ifnames = (objectType == LAI_OBJECT_TYPE_PORT) ? getInterfaceNames() : std::vector<std::string>();
+
+    for (uint32_t idx = 0; idx < count; ++idx)
+    {
+        std::vector<lai_attribute_t> attrs;
+
+        if (!generateAttributes(objectType, idx, attrs))
+        {
+            return LAI_STATUS_NOT_SUPPORTED;
+        }
+
+        lai_object_id_t objectId;
+
+        lai_status_t status = create_internal_object(meta, objectType, &objectId, (uint32_t)attrs.size(), attrs.data());
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("failed to create %s #%u: %s",
+                    lai_serialize_object_type(objectType).c_str(),
+                    idx,
+                    lai_serialize_status(status).c_str());
+
+            return status;
+        }
+
+        if (idx < ifnames.size())
+        {
+            setIfNameToPortId(ifnames[idx], objectId);
+        }
+
+        for (auto alarm: alarms)
+        {
+            raiseAlarm(objectId, alarm, LAI_ALARM_SEVERITY_CRITICAL);
+        }
+    }
+
+    return LAI_STATUS_SUCCESS;
+}
+
+bool LinecardScalable::generateAttributes(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t index,
+        _Out_ std::vector<lai_attribute_t>& attrs) const
+{
+    SWSS_LOG_ENTER();
+
+    attrs.clear();
+
+    auto info = laimeta::MetadataIndex::getInstance().getObjectTypeInfo(objectType);
+
+    if (info == nullptr)
+    {
+        SWSS_LOG_ERROR("no metadata for %s", lai_serialize_object_type(objectType).c_str());
+
+        return false;
+    }
+
+    for (size_t i = 0; info->attrmetadata[i] != nullptr; ++i)
+    {
+        const auto* md = info->attrmetadata[i];
+
+        bool mandatory = LAI_HAS_FLAG_MANDATORY_ON_CREATE(md->flags) && !md->isconditional;
+
+        if (!mandatory && !LAI_HAS_FLAG_KEY(md->flags))
+        {
+            continue;
+        }
+
+        lai_attribute_t attr;
+
+        memset(&attr, 0, sizeof(attr));
+
+        attr.id = md->attrid;
+
+        // enum values are spread across objects, so for example ports get
+        // all port types, integers get index based value, so keys are unique
+
+        if (md->isenum && md->enummetadata && md->enummetadata->valuescount)
+        {
+            attr.value.s32 = md->enummetadata->values[index % md->enummetadata->valuescount];
+
+            attrs.push_back(attr);
+            continue;
+        }
+
+        uint64_t value = (uint64_t)index + 1;
+
+        switch (md->attrvaluetype)
+        {
+            case LAI_ATTR_VALUE_TYPE_BOOL:
+                attr.value.booldata = false;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_UINT8:
+                attr.value.u8 = (uint8_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_INT8:
+                attr.value.s8 = (int8_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_UINT16:
+                attr.value.u16 = (uint16_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_INT16:
+                attr.value.s16 = (int16_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_UINT32:
+                attr.value.u32 = (uint32_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_INT32:
+                attr.value.s32 = (int32_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_UINT64:
+                attr.value.u64 = value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_INT64:
+                attr.value.s64 = (int64_t)value;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_DOUBLE:
+                attr.value.d64 = 0.0;
+                break;
+
+            case LAI_ATTR_VALUE_TYPE_CHARDATA:
+                snprintf(attr.value.chardata, sizeof(attr.value.chardata), "vs-%u", index);
+                break;
+
+            default:
+
+                SWSS_LOG_ERROR("can't generate value for %s, type %s is not supported",
+                        md->attridname,
+                        lai_serialize_attr_value_type(md->attrvaluetype).c_str());
+
+                return false;
+        }
+
+        // narrow types would wrap on large scale and break key uniqueness
+
+        if (value > getMaxValue(md->attrvaluetype))
+        {
+            SWSS_LOG_ERROR("object index %u is out of range of %s", index, md->attridname);
+
+            return false;
+        }
+
+        attrs.push_back(attr);
+    }
+
+    return true;
+}
+
+bool LinecardScalable::isStatSupported(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ lai_stat_id_t stat_id) const
+{
+    SWSS_LOG_ENTER();
+
+    auto scale = m_linecardConfig->m_linecardScale;
+
+    if (scale == nullptr || !isInternalObject(object_type, object_id))
+    {
+        return true;
+    }
+
+    auto stats = scale->getStats(object_type);
+
+    return stats == nullptr || stats->find(stat_id) != stats->end();
+}
+
+std::vector<std::string> LinecardScalable::getInterfaceNames() const
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<std::string> ifnames;
+
+    if (m_linecardConfig->m_laneMap)
+    {
+        for (auto& lanes: m_linecardConfig->m_laneMap->getLaneVector())
+        {
+            ifnames.push_back(m_linecardConfig->m_laneMap->getInterfaceFromLaneNumber(lanes.at(0)));
+        }
+    }
+    else if (m_linecardConfig->m_corePortIndexMap)
+    {
+        for (auto& corePortIndex: m_linecardConfig->m_corePortIndexMap->getCorePortIndexVector())
+        {
+            ifnames.push_back(m_linecardConfig->m_corePortIndexMap->getInterfaceFromCorePortIndex(corePortIndex));
+        }
+    }
+
+    return ifnames;
+}
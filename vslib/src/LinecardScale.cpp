@@ -0,0 +1,69 @@
+#include "LinecardScale.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+void LinecardScale::setObjectCount(
+        _In_ lai_object_type_t objectType,
+        _In_ uint32_t count)
+{
+    SWSS_LOG_ENTER();
+
+    m_objectCounts[objectType] = count;
+}
+
+bool LinecardScale::hasObjectCount(
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectCounts.find(objectType) != m_objectCounts.end();
+}
+
+const std::map<lai_object_type_t, uint32_t>& LinecardScale::getObjectCounts() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objectCounts;
+}
+
+void LinecardScale::setStats(
+        _In_ lai_object_type_t objectType,
+        _In_ const std::set<lai_stat_id_t>& stats)
+{
+    SWSS_LOG_ENTER();
+
+    m_stats[objectType] = stats;
+}
+
+const std::set<lai_stat_id_t>* LinecardScale::getStats(
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_stats.find(objectType);
+
+    return (it == m_stats.end()) ? nullptr : &it->second;
+}
+
+void LinecardScale::setAlarms(
+        _In_ lai_object_type_t objectType,
+        _In_ const std::vector<lai_alarm_type_t>& alarms)
+{
+    SWSS_LOG_ENTER();
+
+    m_alarms[objectType] = alarms;
+}
+
+const std::vector<lai_alarm_type_t>& LinecardScale::getAlarms(
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    static const std::vector<lai_alarm_type_t> empty;
+
+    auto it = m_alarms.find(objectType);
+
+    return (it == m_alarms.end()) ? empty : it->second;
+}
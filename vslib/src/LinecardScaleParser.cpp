@@ -0,0 +1,197 @@
+#include "LinecardScaleParser.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
+
+#include <fstream>
+
+using namespace laivs;
+
+std::shared_ptr<LinecardScale> LinecardScaleParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    auto scale = std::make_shared<LinecardScale>();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, no objects will be created");
+
+        return scale;
+    }
+
+    std::string file(fileName);
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open linecard scale file: %s", file.c_str());
+
+        return scale;
+    }
+
+    SWSS_LOG_NOTICE("loading linecard scale from: %s", file.c_str());
+
+    std::string line;
+
+    while (getline(ifs, line))
+    {
+        /*
+         * line can be in 3 forms:
+         *
+         * LAI_OBJECT_TYPE_XXX=count
+         * LAI_OBJECT_TYPE_XXX.stats=LAI_XXX_STAT_YYY,LAI_XXX_STAT_ZZZ
+         * LAI_OBJECT_TYPE_XXX.alarms=LAI_ALARM_TYPE_YYY,LAI_ALARM_TYPE_ZZZ
+         */
+
+        if (line.size() == 0 || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("line: %s", line.c_str());
+
+        auto toks = swss::tokenize(line, '=');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected 2 tokens, got: %zu on line: %s", toks.size(), line.c_str());
+            continue;
+        }
+
+        parse(scale, toks.at(0), toks.at(1));
+    }
+
+    return scale;
+}
+
+void LinecardScaleParser::parse(
+        _In_ std::shared_ptr<LinecardScale> scale,
+        _In_ const std::string& key,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = key.find('.');
+
+    auto type = key.substr(0, pos);
+
+    lai_object_type_t objectType;
+
+    try
+    {
+        lai_deserialize_object_type(type, objectType);
+    }
+    catch(const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to deserialize '%s' as object type: %s", type.c_str(), e.what());
+        return;
+    }
+
+    if (objectType == LAI_OBJECT_TYPE_NULL || objectType == LAI_OBJECT_TYPE_LINECARD)
+    {
+        SWSS_LOG_ERROR("object type %s can't be scaled", type.c_str());
+        return;
+    }
+
+    if (pos != std::string::npos)
+    {
+        auto option = key.substr(pos + 1);
+
+        if (option == "stats")
+        {
+            parseStats(scale, objectType, value);
+        }
+        else if (option == "alarms")
+        {
+            parseAlarms(scale, objectType, value);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("unknown option '%s' for %s", option.c_str(), type.c_str());
+        }
+
+        return;
+    }
+
+    uint32_t count;
+
+    if (sscanf(value.c_str(), "%u", &count) != 1)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as count", value.c_str());
+        return;
+    }
+
+    SWSS_LOG_NOTICE("scale %s = %u", type.c_str(), count);
+
+    scale->setObjectCount(objectType, count);
+}
+
+void LinecardScaleParser::parseStats(
+        _In_ std::shared_ptr<LinecardScale> scale,
+        _In_ lai_object_type_t objectType,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    std::set<lai_stat_id_t> stats;
+
+    for (auto& name: swss::tokenize(value, ','))
+    {
+        auto meta = index.getStatMetadata(name);
+
+        if (meta == nullptr || index.getStatMetadata(objectType, meta->statid) != meta)
+        {
+            SWSS_LOG_ERROR("stat %s is not defined on %s",
+                    name.c_str(),
+                    lai_serialize_object_type(objectType).c_str());
+            return;
+        }
+
+        stats.insert(meta->statid);
+    }
+
+    SWSS_LOG_NOTICE("scale %s stats: %zu",
+            lai_serialize_object_type(objectType).c_str(),
+            stats.size());
+
+    scale->setStats(objectType, stats);
+}
+
+void LinecardScaleParser::parseAlarms(
+        _In_ std::shared_ptr<LinecardScale> scale,
+        _In_ lai_object_type_t objectType,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    std::vector<lai_alarm_type_t> alarms;
+
+    for (auto& name: swss::tokenize(value, ','))
+    {
+        int32_t alarm;
+
+        if (!index.getEnumValue(&lai_metadata_enum_lai_alarm_type_t, name, alarm))
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as alarm type", name.c_str());
+            return;
+        }
+
+        alarms.push_back((lai_alarm_type_t)alarm);
+    }
+
+    SWSS_LOG_NOTICE("scale %s alarms: %zu",
+            lai_serialize_object_type(objectType).c_str(),
+            alarms.size());
+
+    scale->setAlarms(objectType, alarms);
+}
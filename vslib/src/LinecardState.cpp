@@ -8,6 +8,7 @@
 #include "swss/logger.h"
 
 #include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
 
 #include <netlink/route/link.h>
 #include <netlink/route/addr.h>
@@ -33,37 +34,37 @@ LinecardState::LinecardState(
                 lai_serialize_object_type(RealObjectIdManager::objectTypeQuery(linecard_id)).c_str());
     }
 
-    for (int i = LAI_OBJECT_TYPE_NULL; i < (int)LAI_OBJECT_TYPE_EXTENSIONS_MAX; ++i)
-    {
-        /*
-         * Populate empty maps for each object to avoid checking if
-         * objecttype exists.
-         */
-
-        m_objectHash[(lai_object_type_t)i] = { };
-    }
-
     /*
      * Create linecard by default, it will require special treat on
      * creating.
      */
 
-    m_objectHash[LAI_OBJECT_TYPE_LINECARD][lai_serialize_object_id(linecard_id)] = {};
+    m_counterModel = m_linecardConfig->m_counterModel;
+
+    if (m_counterModel == nullptr)
+    {
+        m_counterModel = std::make_shared<CounterModel>();
+    }
+
+    m_recordingReplay = m_linecardConfig->m_recordingReplay;
+
+    auto& attrHash = m_objectHash.insert(LAI_OBJECT_TYPE_LINECARD, linecard_id);
     lai_attribute_t attr;
     
     attr.id = LAI_LINECARD_ATTR_SOFTWARE_VERSION;
     strncpy(attr.value.chardata, "1.1.1", sizeof(attr.value.chardata) - 1);
-    auto a = std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr);
-    m_objectHash[LAI_OBJECT_TYPE_LINECARD][lai_serialize_object_id(linecard_id)][a->getAttrMetadata()->attridname] = a;
+    attrHash.setAttr(std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr));
 
     attr.id = LAI_LINECARD_ATTR_OPER_STATUS;
     attr.value.s32 = LAI_OPER_STATUS_ACTIVE;
-    auto b = std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr);
-    m_objectHash[LAI_OBJECT_TYPE_LINECARD][lai_serialize_object_id(linecard_id)][b->getAttrMetadata()->attridname] = b;
+    attrHash.setAttr(std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr));
     attr.id = LAI_LINECARD_ATTR_UPGRADE_STATE;
     attr.value.s32 = LAI_LINECARD_UPGRADE_STATE_IDLE;
-    auto c = std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr);
-    m_objectHash[LAI_OBJECT_TYPE_LINECARD][lai_serialize_object_id(linecard_id)][c->getAttrMetadata()->attridname] = c;
+    attrHash.setAttr(std::make_shared<LaiAttrWrap>(LAI_OBJECT_TYPE_LINECARD, &attr));
+
+    // linecard is created by user as well
+
+    addCreationIndex(LAI_OBJECT_TYPE_LINECARD, linecard_id);
 
     if (m_linecardConfig->m_useTapDevice)
     {
@@ -209,9 +210,10 @@ void LinecardState::asyncOnLinkMsg(
             if_flags,
             if_index);
 
-    auto payload = std::make_shared<EventPayloadNetLinkMsg>(m_linecard_id, nlmsg_type, if_index, if_flags, if_name);
+    auto event = EventQueue::makeEvent<EventPayloadNetLinkMsg>(
+            EVENT_TYPE_NET_LINK_MSG, m_linecard_id, nlmsg_type, if_index, if_flags, if_name);
 
-    m_linecardConfig->m_eventQueue->enqueue(std::make_shared<Event>(EVENT_TYPE_NET_LINK_MSG, payload));
+    m_linecardConfig->m_eventQueue->enqueue(event);
 }
 
 
@@ -253,60 +255,60 @@ lai_status_t LinecardState::getStatsExt(
         perform_set = true;
     }
 
-    auto str_object_id = lai_serialize_object_id(object_id);
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    auto it = m_countersMap.find(object_id);
 
-    auto mapit = m_countersMap.find(str_object_id);
+    if (it == m_countersMap.end())
+    {
+        // each object gets its own random sequence, so gauge values don't
+        // depend on order in which objects are read
+
+        it = m_countersMap.emplace(object_id, ObjectCounters(m_counterModel->getSeed() ^ object_id)).first;
+    }
 
-    if (mapit == m_countersMap.end())
-        m_countersMap[str_object_id] = { };
+    auto& localcounters = it->second;
 
-    auto& localcounters = m_countersMap[str_object_id];
+    uint64_t creationIndex = 0;
+
+    bool replay = m_recordingReplay && getCreationIndex(object_id, creationIndex);
+
+    auto now = std::chrono::steady_clock::now();
 
     for (uint32_t i = 0; i < number_of_counters; ++i)
     {
-        int32_t id = counter_ids[i];
-
-        auto stat_metadata  = lai_metadata_get_stat_metadata(object_type, id);
-
-        if (stat_metadata->statvaluetype == LAI_STAT_VALUE_TYPE_UINT64) {
-            if (perform_set)
-            {
-                localcounters[ id ] = counters[i].u64;
-            }
-            else
-            {
-                auto it = localcounters.find(id);
-
-                if (it == localcounters.end())
-                {
-                    // if counter is not found on list, just return 0
-                    counters[i].u64 = 1;
-                    localcounters[id] = 1;
-                }
-                else
-                {
-                    it->second++;
-                    counters[i].u64 = it->second;
-                }
-
-                if (mode == LAI_STATS_MODE_READ_AND_CLEAR)
-                {
-                    localcounters[ id ] = 0;
-                }
-            }
-        } else if (stat_metadata->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE) {
-            auto it = localcounters.find(id);
-            if (it == localcounters.end())
-            {
-                localcounters[id] = 1;
-                counters[i].d64 = 1.0;
-            }
-            else
-            {
-                it->second++;
-                counters[i].d64 = (double)(it->second);
-            }
+        auto stat_metadata = index.getStatMetadata(object_type, counter_ids[i]);
+
+        if (stat_metadata == nullptr)
+        {
+            SWSS_LOG_ERROR("stat id %d is not valid on %s",
+                    counter_ids[i],
+                    lai_serialize_object_id(object_id).c_str());
+
+            return LAI_STATUS_INVALID_PARAMETER;
+        }
+
+        if (!isStatSupported(object_type, object_id, counter_ids[i]))
+        {
+            SWSS_LOG_ERROR("stat %s is not supported on %s",
+                    stat_metadata->statidname,
+                    lai_serialize_object_id(object_id).c_str());
+
+            return LAI_STATUS_NOT_SUPPORTED;
+        }
+
+        if (perform_set)
+        {
+            localcounters.write(stat_metadata, now, counters[i]);
+            continue;
+        }
+
+        if (replay && m_recordingReplay->getStat(object_type, creationIndex, counter_ids[i], counters[i].u64))
+        {
+            continue;
         }
+
+        localcounters.read(stat_metadata, m_counterModel->getModel(stat_metadata), now, mode, counters[i]);
     }
 
     return LAI_STATUS_SUCCESS;
@@ -323,56 +325,71 @@ lai_status_t LinecardState::getAlarms(
 
     bool perform_set = false;
 
-    // auto info = lai_metadata_get_object_type_info(object_type);
-
-    // bool enabled = false;
+    bool enabled = false;
 
     auto meta = m_meta.lock();
 
-    //if (meta)
-    //{
-    //    enabled = meta->meta_unittests_enabled();
-    //}
-    //else
-    //{
-    //    SWSS_LOG_WARN("meta pointer expired");
-    //}
+    if (meta)
+    {
+        enabled = meta->meta_unittests_enabled();
+    }
+    else
+    {
+        SWSS_LOG_WARN("meta pointer expired");
+    }
 
-    auto str_object_id = lai_serialize_object_id(object_id);
+    if (enabled && (number_of_alarms & VS_COUNTERS_COUNT_MSB))
+    {
+        number_of_alarms &= ~VS_COUNTERS_COUNT_MSB;
 
-    auto mapit = m_alarmsMap.find(str_object_id);
+        SWSS_LOG_NOTICE("unittests are enabled and alarms count MSB is set to 1, performing SET on %s alarms",
+                lai_serialize_object_id(object_id).c_str());
 
-    if (mapit == m_alarmsMap.end())
-        m_alarmsMap[str_object_id] = { };
+        perform_set = true;
+    }
 
-    auto& localalarms = m_alarmsMap[str_object_id];
+    auto& localalarms = m_alarmsMap[object_id];
 
     for (uint32_t i = 0; i < number_of_alarms; ++i)
     {
         int32_t id = alarm_ids[i];
 
+        // alarm types are dense enum values, so valid type also bounds
+        // size of local alarms vector
+
+        if (laimeta::MetadataIndex::getInstance().getEnumName(&lai_metadata_enum_lai_alarm_type_t, id, false) == nullptr)
+        {
+            SWSS_LOG_ERROR("alarm type %d is not valid", id);
+
+            return LAI_STATUS_INVALID_PARAMETER;
+        }
+
+        if ((size_t)id >= localalarms.size())
+        {
+            lai_alarm_info_t inactive;
+
+            memset(&inactive, 0, sizeof(inactive));
+
+            inactive.status = LAI_ALARM_STATUS_INACTIVE;
+
+            localalarms.resize(id + 1, inactive);
+        }
+
+        auto& alarm = localalarms[id];
+
         if (perform_set)
         {
-            //localalarms[ id ] = counters[i];
+            // resource and text lists are owned by caller, don't keep them
+
+            alarm.time_created = alarm_info[i].time_created;
+            alarm.severity = alarm_info[i].severity;
+            alarm.status = alarm_info[i].status;
         }
         else
         {
-            auto it = localalarms.find(id);
-
-            if (it == localalarms.end())
-            {
-                // if counter is not found on list, just return 0
-                // counters[i] = 0;
-            }
-            else
-            {
-                // counters[i] = it->second;
-            }
-
-            // if (mode == LAI_STATS_MODE_READ_AND_CLEAR)
-            // {
-                // localcounters[ id ] = 0;
-            // }
+            alarm_info[i].time_created = alarm.time_created;
+            alarm_info[i].severity = alarm.severity;
+            alarm_info[i].status = alarm.status;
         }
     }
 
@@ -385,9 +402,103 @@ lai_status_t LinecardState::clearAlarms(
         _In_ uint32_t number_of_alarms,
         _In_ const lai_alarm_type_t *alarm_ids)
 {
+    SWSS_LOG_ENTER();
+
+    auto it = m_alarmsMap.find(object_id);
+
+    if (it == m_alarmsMap.end())
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    for (uint32_t i = 0; i < number_of_alarms; ++i)
+    {
+        int32_t id = alarm_ids[i];
+
+        if (id >= 0 && (size_t)id < it->second.size())
+        {
+            it->second[id].status = LAI_ALARM_STATUS_INACTIVE;
+        }
+    }
+
     return LAI_STATUS_SUCCESS;
 }
 
+bool LinecardState::isStatSupported(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id,
+        _In_ lai_stat_id_t stat_id) const
+{
+    SWSS_LOG_ENTER();
+
+    return true;
+}
+
+void LinecardState::addCreationIndex(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id)
+{
+    SWSS_LOG_ENTER();
+
+    m_creationIndex[object_id] = m_creationCount[object_type]++;
+}
+
+void LinecardState::removeCreationIndex(
+        _In_ lai_object_id_t object_id)
+{
+    SWSS_LOG_ENTER();
+
+    // index is not reused, same as in recording
+
+    m_creationIndex.erase(object_id);
+}
+
+bool LinecardState::getCreationIndex(
+        _In_ lai_object_id_t object_id,
+        _Out_ uint64_t& index) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_creationIndex.find(object_id);
+
+    if (it == m_creationIndex.end())
+    {
+        return false;
+    }
+
+    index = it->second;
+
+    return true;
+}
+
+void LinecardState::raiseAlarm(
+        _In_ lai_object_id_t object_id,
+        _In_ lai_alarm_type_t alarm_type,
+        _In_ lai_alarm_severity_t severity)
+{
+    SWSS_LOG_ENTER();
+
+    auto& localalarms = m_alarmsMap[object_id];
+
+    if ((size_t)alarm_type >= localalarms.size())
+    {
+        lai_alarm_info_t inactive;
+
+        memset(&inactive, 0, sizeof(inactive));
+
+        inactive.status = LAI_ALARM_STATUS_INACTIVE;
+
+        localalarms.resize(alarm_type + 1, inactive);
+    }
+
+    auto& alarm = localalarms[alarm_type];
+
+    alarm.time_created = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    alarm.severity = severity;
+    alarm.status = LAI_ALARM_STATUS_ACTIVE;
+}
+
 std::shared_ptr<laimeta::Meta> LinecardState::getMeta()
 {
     SWSS_LOG_ENTER();
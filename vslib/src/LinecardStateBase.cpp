@@ -2,57 +2,57 @@
 
 #include "swss/logger.h"
 #include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
 #include "EventPayloadNotification.h"
 #include "lib/inc/NotificationLinecardStateChange.h"
+#include "lib/inc/lairediscommon.h"
  
 #include <net/if.h>
 
 #include <algorithm>
+#include <chrono>
 #include <unistd.h>
  #include <shell.h>
 
 #define LAI_VS_MAX_PORTS 1024
 
-using namespace laivs;
+#define OBJECT_HASH_MUTEX std::lock_guard<std::mutex> _lock(m_objectHashMutex);
 
-int g_linecard_state_change = 0;
-lai_oper_status_t g_linecard_state = LAI_OPER_STATUS_DISABLED;
+using namespace laivs;
 
-void LinecardStateBase::externEventThreadProc()
+void LinecardStateBase::simulationThreadProc()
 {
     SWSS_LOG_ENTER();
 
-    while (m_externEventThreadRun)
+    auto profile = m_simulationEngine->getProfile();
+
+    auto next = std::chrono::steady_clock::now() + std::chrono::milliseconds(profile->getStartDelayMs());
+
+    std::unique_lock<std::mutex> lock(m_simulationMutex);
+
+    while (m_simulationThreadRun)
     {
-        if (g_linecard_state_change) {
-            send_linecard_state_change_notification(0x100000000, g_linecard_state, true);
-            g_linecard_state_change = 0;
-        } else {
-            usleep(1000);
+        if (m_simulationCv.wait_until(lock, next, [this] { return !m_simulationThreadRun; }))
+        {
+            break;
         }
-    }
-}
 
-void LinecardStateBase::updateObjectThreadProc()
-{
-    SWSS_LOG_ENTER();
+        {
+            OBJECT_HASH_MUTEX;
 
-    sleep(15);
+            m_simulationEngine->tick(m_objectHash);
+        }
 
-    while (m_updateObjectThreadRun)
-    {
-        for (auto &i : m_objectHash)
+        next += std::chrono::milliseconds(profile->getTickIntervalMs());
+
+        auto now = std::chrono::steady_clock::now();
+
+        if (next < now)
         {
-            for (auto &j : i.second)
-            {
-                for (auto &k : j.second)
-                {
-                    k.second->updateValue();
+            // we are late, don't try to catch up with burst of ticks
 
-                }
-            }
-        }      
-        sleep(1);
+            next = now;
+        }
     }
 }
 
@@ -61,23 +61,40 @@ LinecardStateBase::LinecardStateBase(
         _In_ std::shared_ptr<RealObjectIdManager> manager,
         _In_ std::shared_ptr<LinecardConfig> config):
     LinecardState(linecard_id, config),
-    m_realObjectIdManager(manager)
+    m_realObjectIdManager(manager),
+    m_changingInternalObjects(false)
 {
     SWSS_LOG_ENTER();
 
-    m_externEventThreadRun = true;
-    m_externEventThread = std::make_shared<std::thread>(&LinecardStateBase::externEventThreadProc, this);
-    m_updateObjectThreadRun = true;
-    m_updateObjectThread = std::make_shared<std::thread>(&LinecardStateBase::updateObjectThreadProc, this);
+    auto profile = config->m_simulationProfile;
+
+    if (profile == nullptr)
+    {
+        profile = std::make_shared<SimulationProfile>();
+    }
+
+    m_simulationEngine = std::make_shared<SimulationEngine>(profile);
+
+    // linecard object was already created by LinecardState
+
+    m_simulationEngine->addObject(LAI_OBJECT_TYPE_LINECARD, *m_objectHash.find(LAI_OBJECT_TYPE_LINECARD, linecard_id));
+
+    m_simulationThreadRun = true;
+    m_simulationThread = std::make_shared<std::thread>(&LinecardStateBase::simulationThreadProc, this);
 }
 
 LinecardStateBase::~LinecardStateBase()
 {
     SWSS_LOG_ENTER();
 
-    m_externEventThreadRun = false;
-    m_externEventThread->join();
-    // empty
+    {
+        std::lock_guard<std::mutex> lock(m_simulationMutex);
+
+        m_simulationThreadRun = false;
+    }
+
+    m_simulationCv.notify_all();
+    m_simulationThread->join();
 }
 
 lai_status_t LinecardStateBase::create(
@@ -96,48 +113,60 @@ lai_status_t LinecardStateBase::create(
 
     *object_id = m_realObjectIdManager->allocateNewObjectId(object_type, linecard_id);
 
-    auto sid = lai_serialize_object_id(*object_id);
-
-    return create_internal(object_type, sid, linecard_id, attr_count, attr_list);
+    return create_internal(object_type, *object_id, linecard_id, attr_count, attr_list);
 }
 
 lai_status_t LinecardStateBase::create(
         _In_ lai_object_type_t object_type,
-        _In_ const std::string &serializedObjectId,
+        _In_ lai_object_id_t object_id,
         _In_ lai_object_id_t linecard_id,
         _In_ uint32_t attr_count,
         _In_ const lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
-    return create_internal(object_type, serializedObjectId, linecard_id, attr_count, attr_list);
+    auto status = create_internal(object_type, object_id, linecard_id, attr_count, attr_list);
+
+    if (status == LAI_STATUS_SUCCESS && !m_changingInternalObjects)
+    {
+        addCreationIndex(object_type, object_id);
+    }
+
+    return status;
 }
 
 void LinecardStateBase::setObjectHash(
         _In_ lai_object_type_t object_type,
-        _In_ const std::string &serializedObjectId,
+        _In_ lai_object_id_t object_id,
         _In_ const lai_attribute_t *attr)
 {
-    auto &objectHash = m_objectHash.at(object_type);
-    auto a = std::make_shared<LaiAttrWrap>(object_type, attr);
-    objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
+    SWSS_LOG_ENTER();
+
+    m_objectHash.insert(object_type, object_id).setAttr(std::make_shared<LaiAttrWrap>(object_type, attr));
 }
 
 lai_status_t LinecardStateBase::create_internal(
         _In_ lai_object_type_t object_type,
-        _In_ const std::string &serializedObjectId,
+        _In_ lai_object_id_t object_id,
         _In_ lai_object_id_t linecard_id,
         _In_ uint32_t attr_count,
         _In_ const lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
-    auto &objectHash = m_objectHash.at(object_type);
 
-    if (m_linecardConfig->m_resourceLimiter)
+    OBJECT_HASH_MUTEX;
+
+    if (m_linecardConfig->m_resourceLimiter && !m_changingInternalObjects)
     {
         size_t limit = m_linecardConfig->m_resourceLimiter->getObjectTypeLimit(object_type);
 
-        if (objectHash.size() >= limit)
+        // objects created by linecard itself are not counted against limit
+
+        auto it = m_internalObjects.find(object_type);
+
+        size_t internal = (it == m_internalObjects.end()) ? 0 : it->second.size();
+
+        if (m_objectHash.size(object_type) - internal >= limit)
         {
             SWSS_LOG_ERROR("too many %s, created %zu is resource limit",
                     lai_serialize_object_type(object_type).c_str(),
@@ -149,7 +178,7 @@ lai_status_t LinecardStateBase::create_internal(
 
     
     #if 0
-    auto it = objectHash.find(serializedObjectId);
+    auto it = m_objectHash.find(object_type, object_id);
     if (object_type != LAI_OBJECT_TYPE_LINECARD)
     {
         /*
@@ -158,25 +187,25 @@ lai_status_t LinecardStateBase::create_internal(
          * XXX revisit this.
          */
 
-        if (it != objectHash.end())
+        if (it != nullptr)
         {
             SWSS_LOG_ERROR("create failed, object already exists, object type: %s: id: %s",
                     lai_serialize_object_type(object_type).c_str(),
-                    serializedObjectId.c_str());
+                    lai_serialize_object_id(object_id).c_str());
 
             return LAI_STATUS_ITEM_ALREADY_EXISTS;
         }
     }
     #endif
 
-    if (objectHash.find(serializedObjectId) == objectHash.end())
+    if (m_objectHash.find(object_type, object_id) == nullptr)
     {
         /*
          * Number of attributes may be zero, so see if actual entry was created
          * with empty hash.
          */
 
-        objectHash[serializedObjectId] = {};
+        m_objectHash.insert(object_type, object_id);
 
         lai_attr_id_t id = 0;
         lai_attribute_t attr;
@@ -190,47 +219,47 @@ lai_status_t LinecardStateBase::create_internal(
             {
                 case LAI_ATTR_VALUE_TYPE_BOOL:
                     attr.value.booldata = true;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_UINT8:
                     attr.value.u8 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_INT8:
                     attr.value.s8 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_UINT16:
                     attr.value.u16 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_INT16:
                     attr.value.s16 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_UINT32:
                     attr.value.u32 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_INT32:
                     attr.value.s32 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_UINT64:
                     attr.value.u64 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_INT64:
                     attr.value.s64 = 0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_DOUBLE:
                     attr.value.d64 = 0.0;
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 case LAI_ATTR_VALUE_TYPE_CHARDATA:
                     strncpy(attr.value.chardata, "test data", sizeof(attr.value.chardata));
-                    setObjectHash(object_type, serializedObjectId, &attr);
+                    setObjectHash(object_type, object_id, &attr);
                     break;
                 default:
                     break;
@@ -240,13 +269,15 @@ lai_status_t LinecardStateBase::create_internal(
         }
     }
 
+    auto& attrHash = m_objectHash.insert(object_type, object_id);
+
     for (uint32_t i = 0; i < attr_count; ++i)
     {
-        auto a = std::make_shared<LaiAttrWrap>(object_type, &attr_list[i]);
-
-        objectHash[serializedObjectId][a->getAttrMetadata()->attridname] = a;
+        attrHash.setAttr(std::make_shared<LaiAttrWrap>(object_type, &attr_list[i]));
     }
 
+    m_simulationEngine->addObject(object_type, attrHash);
+
     return LAI_STATUS_SUCCESS;
 }
 
@@ -256,84 +287,203 @@ lai_status_t LinecardStateBase::remove(
 {
     SWSS_LOG_ENTER();
 
-    auto sid = lai_serialize_object_id(objectId);
+    return remove_internal(object_type, objectId);
+}
+
+lai_status_t LinecardStateBase::create_internal_objects(
+        _In_ std::shared_ptr<laimeta::Meta> meta)
+{
+    SWSS_LOG_ENTER();
 
-    return remove(object_type, sid);
+    // base linecard has no internal objects
+
+    return LAI_STATUS_SUCCESS;
 }
 
-lai_status_t LinecardStateBase::remove(
+lai_status_t LinecardStateBase::create_internal_object(
+        _In_ std::shared_ptr<laimeta::Meta> meta,
         _In_ lai_object_type_t object_type,
-        _In_ const std::string &serializedObjectId)
+        _Out_ lai_object_id_t *object_id,
+        _In_ uint32_t attr_count,
+        _In_ const lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
-    return remove_internal(object_type, serializedObjectId);
+    // internal objects are only created and removed from API calls, which
+    // are serialized by vslib api lock, simulation thread is not using them
+
+    m_changingInternalObjects = true;
+
+    auto status = meta->create(object_type, object_id, m_linecard_id, attr_count, attr_list);
+
+    m_changingInternalObjects = false;
+
+    if (status == LAI_STATUS_SUCCESS)
+    {
+        m_internalObjects[object_type].insert(*object_id);
+    }
+
+    return status;
 }
 
-lai_status_t LinecardStateBase::remove_internal(
+lai_status_t LinecardStateBase::remove_internal_objects(
+        _In_ std::shared_ptr<laimeta::Meta> meta)
+{
+    SWSS_LOG_ENTER();
+
+    // remove modifies internal objects, so take copy first
+
+    std::vector<std::pair<lai_object_type_t, lai_object_id_t>> objects;
+
+    for (auto& kvp: m_internalObjects)
+    {
+        for (auto oid: kvp.second)
+        {
+            objects.emplace_back(kvp.first, oid);
+        }
+    }
+
+    lai_status_t result = LAI_STATUS_SUCCESS;
+
+    m_changingInternalObjects = true;
+
+    // internal objects don't reference each other, so order doesn't matter
+
+    for (auto& obj: objects)
+    {
+        auto status = meta->remove(obj.first, obj.second);
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("failed to remove internal object %s: %s",
+                    lai_serialize_object_id(obj.second).c_str(),
+                    lai_serialize_status(status).c_str());
+
+            result = status;
+        }
+    }
+
+    m_changingInternalObjects = false;
+
+    return result;
+}
+
+bool LinecardStateBase::isChangingInternalObjects() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_changingInternalObjects;
+}
+
+bool LinecardStateBase::isInternalObject(
         _In_ lai_object_type_t object_type,
-        _In_ const std::string &serializedObjectId)
+        _In_ lai_object_id_t object_id) const
 {
     SWSS_LOG_ENTER();
 
-    auto &objectHash = m_objectHash.at(object_type);
+    auto it = m_internalObjects.find(object_type);
+
+    return it != m_internalObjects.end() && it->second.find(object_id) != it->second.end();
+}
+
+lai_status_t LinecardStateBase::get_internal_object_list(
+        _Inout_ lai_object_list_t& objectList)
+{
+    SWSS_LOG_ENTER();
 
-    auto it = objectHash.find(serializedObjectId);
+    std::vector<lai_object_id_t> objects;
 
-    if (it == objectHash.end())
+    for (auto& kvp: m_internalObjects)
     {
-        SWSS_LOG_ERROR("not found %s:%s",
-                lai_serialize_object_type(object_type).c_str(),
-                serializedObjectId.c_str());
+        objects.insert(objects.end(), kvp.second.begin(), kvp.second.end());
+    }
 
-        return LAI_STATUS_ITEM_NOT_FOUND;
+    if (objectList.count < objects.size())
+    {
+        objectList.count = (uint32_t)objects.size();
+
+        return LAI_STATUS_BUFFER_OVERFLOW;
     }
 
-    objectHash.erase(it);
+    if (objects.size() && objectList.list == nullptr)
+    {
+        SWSS_LOG_ERROR("object list pointer is NULL");
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    std::copy(objects.begin(), objects.end(), objectList.list);
+
+    objectList.count = (uint32_t)objects.size();
 
     return LAI_STATUS_SUCCESS;
 }
 
-lai_status_t LinecardStateBase::set(
-        _In_ lai_object_type_t objectType,
-        _In_ const std::string &serializedObjectId,
-        _In_ const lai_attribute_t* attr)
+lai_status_t LinecardStateBase::remove_internal(
+        _In_ lai_object_type_t object_type,
+        _In_ lai_object_id_t object_id)
 {
     SWSS_LOG_ENTER();
 
-    return set_internal(objectType, serializedObjectId, attr);
+    OBJECT_HASH_MUTEX;
+
+    if (!m_objectHash.erase(object_type, object_id))
+    {
+        SWSS_LOG_ERROR("not found %s:%s",
+                lai_serialize_object_type(object_type).c_str(),
+                lai_serialize_object_id(object_id).c_str());
+
+        return LAI_STATUS_ITEM_NOT_FOUND;
+    }
+
+    m_simulationEngine->removeObject(object_id);
+
+    m_countersMap.erase(object_id);
+
+    m_alarmsMap.erase(object_id);
+
+    removeCreationIndex(object_id);
+
+    auto it = m_internalObjects.find(object_type);
+
+    if (it != m_internalObjects.end())
+    {
+        it->second.erase(object_id);
+    }
+
+    return LAI_STATUS_SUCCESS;
 }
 
 lai_status_t LinecardStateBase::set_internal(
         _In_ lai_object_type_t objectType,
-        _In_ const std::string &serializedObjectId,
+        _In_ lai_object_id_t objectId,
         _In_ const lai_attribute_t* attr)
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_objectHash.at(objectType).find(serializedObjectId);
+    OBJECT_HASH_MUTEX;
+
+    auto attrHash = m_objectHash.find(objectType, objectId);
 
-    if (it == m_objectHash.at(objectType).end())
+    if (attrHash == nullptr)
     {
         SWSS_LOG_ERROR("not found %s:%s",
                 lai_serialize_object_type(objectType).c_str(),
-                serializedObjectId.c_str());
+                lai_serialize_object_id(objectId).c_str());
 
         return LAI_STATUS_ITEM_NOT_FOUND;
     }
 
-    auto &attrHash = it->second;
-
     auto a = std::make_shared<LaiAttrWrap>(objectType, attr);
 
     // set have only one attribute
-    attrHash[a->getAttrMetadata()->attridname] = a;
+    attrHash->setAttr(a);
 
-    auto meta = lai_metadata_get_attr_metadata(objectType, attr->id);
+    m_simulationEngine->setAttr(objectType, objectId, *a);
 
     SWSS_LOG_NOTICE("set %s:%s %s", lai_serialize_object_type(objectType).c_str(),
-                    serializedObjectId.c_str(),
-                    meta->attridname);
+                    lai_serialize_object_id(objectId).c_str(),
+                    a->getAttrMetadata()->attridname);
 
     return LAI_STATUS_SUCCESS;
 }
@@ -345,49 +495,34 @@ lai_status_t LinecardStateBase::set(
 {
     SWSS_LOG_ENTER();
 
-    auto sid = lai_serialize_object_id(objectId);
-
-    return set(objectType, sid, attr);
+    return set_internal(objectType, objectId, attr);
 }
 
 lai_status_t LinecardStateBase::get(
-        _In_ lai_object_type_t object_type,
-        _In_ lai_object_id_t object_id,
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId,
         _In_ uint32_t attr_count,
         _Out_ lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
-    auto sid = lai_serialize_object_id(object_id);
-    
-    return get(object_type, sid, attr_count, attr_list);
-}
+    /*
+     * We need pointer to non const here since we can potentially update attr
+     * hash for RO object.
+     */
 
-lai_status_t LinecardStateBase::get(
-        _In_ lai_object_type_t objectType,
-        _In_ const std::string &serializedObjectId,
-        _In_ uint32_t attr_count,
-        _Out_ lai_attribute_t *attr_list)
-{
-    SWSS_LOG_ENTER();
-    const auto &objectHash = m_objectHash.at(objectType);
+    OBJECT_HASH_MUTEX;
 
-    auto it = objectHash.find(serializedObjectId);
+    auto attrHash = m_objectHash.find(objectType, objectId);
 
-    if (it == objectHash.end())
+    if (attrHash == nullptr)
     {
         SWSS_LOG_ERROR("not found %s:%s",
                 lai_serialize_object_type(objectType).c_str(),
-                serializedObjectId.c_str());
+                lai_serialize_object_id(objectId).c_str());
 
         return LAI_STATUS_ITEM_NOT_FOUND;
     }
-    /*
-     * We need reference here since we can potentially update attr hash for RO
-     * object.
-     */
-
-    auto& attrHash = it->second;
 
     /*
      * Some of the list query maybe for length, so we can't do
@@ -396,23 +531,44 @@ lai_status_t LinecardStateBase::get(
 
     lai_status_t final_status = LAI_STATUS_SUCCESS;
 
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    uint64_t creationIndex = 0;
+
+    bool replay = m_recordingReplay && getCreationIndex(objectId, creationIndex);
+
+    /*
+     * Read only refresh depends only on object, not on attribute, so for
+     * multi attribute get it's performed once, when first read only
+     * attribute is reached.
+     */
+
+    bool refreshed = false;
+
     for (uint32_t idx = 0; idx < attr_count; ++idx)
     {
         lai_attr_id_t id = attr_list[idx].id;
 
-        auto meta = lai_metadata_get_attr_metadata(objectType, id);
+        auto meta = index.getAttrMetadata(objectType, id);
 
         if (meta == NULL)
         {
             SWSS_LOG_ERROR("failed to find attribute %d for %s:%s", id,
                     lai_serialize_object_type(objectType).c_str(),
-                    serializedObjectId.c_str());
+                    lai_serialize_object_id(objectId).c_str());
 
             return LAI_STATUS_FAILURE;
         }
         lai_status_t status;
 
-        if (LAI_HAS_FLAG_READ_ONLY(meta->flags))
+        std::shared_ptr<LaiAttrWrap> a;
+
+        if (replay)
+        {
+            a = m_recordingReplay->getAttr(objectType, creationIndex, id);
+        }
+
+        if (a == nullptr && !refreshed && LAI_HAS_FLAG_READ_ONLY(meta->flags))
         {
             /*
              * Read only attributes may require recalculation.
@@ -420,35 +576,44 @@ lai_status_t LinecardStateBase::get(
              * read only attributes. So here is definitely OID.
              */
 
-            lai_object_id_t oid;
-            lai_deserialize_object_id(serializedObjectId, oid);
-
-            status = refresh_read_only(meta, oid);
+            status = refresh_read_only(meta, objectId);
 
             if (status != LAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_INFO("%s read only not implemented on %s",
                         meta->attridname,
-                        serializedObjectId.c_str());
+                        lai_serialize_object_id(objectId).c_str());
 
                 return status;
             }
+
+            refreshed = true;
         }
 
-        auto ait = attrHash.find(meta->attridname);
+        if (a == nullptr)
+        {
+            a = attrHash->getAttr(id);
+        }
 
-        if (ait == attrHash.end())
+        if (a == nullptr)
         {
             SWSS_LOG_INFO("%s not implemented on %s",
                     meta->attridname,
-                    serializedObjectId.c_str());
+                    lai_serialize_object_id(objectId).c_str());
              SWSS_LOG_NOTICE("LinecardStateBase attridname is %s",meta->attridname);
             return LAI_STATUS_NOT_IMPLEMENTED;
         }
 
-        auto attr = ait->second->getAttr();
+        /*
+         * Metadata is already resolved, so transfer goes directly to kernel
+         * specialized for attribute value type.
+         */
+
+        auto ops = lai_get_attr_ops(meta->attrvaluetype);
 
-        status = transfer_attributes(objectType, 1, attr, &attr_list[idx], false);
+        status = (ops == NULL)
+            ? LAI_STATUS_NOT_IMPLEMENTED
+            : ops->transfer(*a->getAttr(), attr_list[idx], false);
 
         if (status == LAI_STATUS_BUFFER_OVERFLOW)
         {
@@ -458,7 +623,7 @@ lai_status_t LinecardStateBase::get(
              */
 
             SWSS_LOG_NOTICE("BUFFER_OVERFLOW %s: %s",
-                    serializedObjectId.c_str(),
+                    lai_serialize_object_id(objectId).c_str(),
                     meta->attridname);
 
             /*
@@ -475,7 +640,7 @@ lai_status_t LinecardStateBase::get(
             // all other errors
 
             SWSS_LOG_ERROR("get failed %s: %s: %s",
-                    serializedObjectId.c_str(),
+                    lai_serialize_object_id(objectId).c_str(),
                     meta->attridname,
                     lai_serialize_status(status).c_str());
             return status;
@@ -744,16 +909,15 @@ void LinecardStateBase::findObjects(
 
     LaiAttrWrap expect_wrap(object_type, &expect);
 
-    for (auto &obj : m_objectHash.at(object_type))
+    OBJECT_HASH_MUTEX;
+
+    for (auto &obj : m_objectHash.getObjects(object_type))
     {
-        auto attr_itr = obj.second.find(expect_wrap.getAttrMetadata()->attridname);
+        auto attr = obj.getAttr(expect.id);
 
-        if (attr_itr != obj.second.end()
-                && attr_itr->second->getAttrStrValue() == expect_wrap.getAttrStrValue())
+        if (attr && attr->getAttrStrValue() == expect_wrap.getAttrStrValue())
         {
-            lai_object_id_t object_id;
-            lai_deserialize_object_id(obj.first, object_id);
-            objects.push_back(object_id);
+            objects.push_back(obj.getObjectId());
         }
     }
 }
@@ -766,17 +930,18 @@ bool LinecardStateBase::dumpObject(
 
     attrs.clear();
 
-    auto &objs = m_objectHash.at(objectTypeQuery(object_id));
-    auto obj = objs.find(lai_serialize_object_id(object_id));
+    OBJECT_HASH_MUTEX;
 
-    if (obj == objs.end())
+    auto obj = m_objectHash.find(objectTypeQuery(object_id), object_id);
+
+    if (obj == nullptr)
     {
         return false;
     }
 
-    for (auto &attr : obj->second)
+    for (auto &attr : obj->getAttrs())
     {
-        attrs.push_back(*attr.second->getAttr());
+        attrs.push_back(*attr->getAttr());
     }
 
     return true;
@@ -805,6 +970,53 @@ void LinecardStateBase::send_aps_switch_info_notification(
     SWSS_LOG_NOTICE("Finish report switch info");
 }
 
+void LinecardStateBase::processLinecardStateChange(
+        _In_ lai_oper_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    send_linecard_state_change_notification(m_linecard_id, status, true);
+}
+
+void LinecardStateBase::processReplayNotification(
+        _In_ const std::string& name,
+        _In_ const std::string& serializedNotification)
+{
+    SWSS_LOG_ENTER();
+
+    // recorded linecard id is replaced with id of this linecard
+
+    lai_object_id_t linecardId;
+
+    if (name == LAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE)
+    {
+        lai_oper_status_t status;
+
+        lai_deserialize_linecard_oper_status(serializedNotification, linecardId, status);
+
+        send_linecard_state_change_notification(m_linecard_id, status, true);
+
+        return;
+    }
+
+    if (name == LAI_LINECARD_NOTIFICATION_NAME_LINECARD_ALARM_NOTIFY)
+    {
+        lai_alarm_type_t alarmType;
+        lai_alarm_info_t alarmInfo;
+
+        lai_deserialize_linecard_alarm(serializedNotification, linecardId, alarmType, alarmInfo);
+
+        send_linecard_alarm_notification(m_linecard_id, alarmType, alarmInfo);
+
+        delete[] alarmInfo.resource.list;
+        delete[] alarmInfo.text.list;
+
+        return;
+    }
+
+    SWSS_LOG_ERROR("replay of notification %s is not supported", name.c_str());
+}
+
 void LinecardStateBase::send_linecard_state_change_notification(
         _In_ lai_object_id_t linecard_id,
         _In_ lai_oper_status_t status,
@@ -0,0 +1,218 @@
+#include "ObjectCounters.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace laivs;
+
+ObjectCounters::ObjectCounters(
+        _In_ uint64_t randomState):
+    m_randomSeed(randomState)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ObjectCounters::Counter& ObjectCounters::getCounter(
+        _In_ lai_stat_id_t id,
+        _In_ const TimePoint& now)
+{
+    SWSS_LOG_ENTER();
+
+    Counter* counter;
+
+    if (id >= 0 && id < MAX_FLAT_STAT_ID)
+    {
+        if ((size_t)id >= m_counters.size())
+        {
+            Counter empty = {};
+
+            m_counters.resize(id + 1, empty);
+        }
+
+        counter = &m_counters[id];
+    }
+    else
+    {
+        counter = &m_customCounters[id];
+    }
+
+    if (!counter->m_valid)
+    {
+        *counter = {};
+
+        counter->m_valid = true;
+        counter->m_randomState = m_randomSeed ^ ((uint64_t)(uint32_t)id * 0x9e3779b97f4a7c15ULL);
+        counter->m_lastRead = now;
+    }
+
+    return *counter;
+}
+
+bool ObjectCounters::isSigned(
+        _In_ const lai_stat_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    return meta->statvaluetype == LAI_STAT_VALUE_TYPE_INT32 ||
+        meta->statvaluetype == LAI_STAT_VALUE_TYPE_INT64;
+}
+
+uint64_t ObjectCounters::toInteger(
+        _In_ const lai_stat_metadata_t* meta,
+        _In_ double value)
+{
+    SWSS_LOG_ENTER();
+
+    if (isSigned(meta))
+    {
+        if (value <= (double)INT64_MIN)
+            return (uint64_t)INT64_MIN;
+
+        if (value >= (double)INT64_MAX)
+            return (uint64_t)INT64_MAX;
+
+        return (uint64_t)(int64_t)value;
+    }
+
+    if (value <= 0)
+        return 0;
+
+    if (value >= (double)UINT64_MAX)
+        return UINT64_MAX;
+
+    return (uint64_t)value;
+}
+
+void ObjectCounters::read(
+        _In_ const lai_stat_metadata_t* meta,
+        _In_ const CounterModel::Model& model,
+        _In_ const TimePoint& now,
+        _In_ lai_stats_mode_t mode,
+        _Out_ lai_stat_value_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& counter = getCounter(meta->statid, now);
+
+    bool isDouble = meta->statvaluetype == LAI_STAT_VALUE_TYPE_DOUBLE;
+
+    int64_t step;
+
+    if (model.m_generator && !isDouble && model.m_generator->getIntegerStep(step))
+    {
+        // integer fast path, default model is ramp by one and must stay
+        // exact for 64 bit counters
+
+        counter.m_integer += (uint64_t)step;
+        counter.m_tick++;
+    }
+    else if (model.m_generator)
+    {
+        double previous = isDouble ? counter.m_double
+            : isSigned(meta) ? (double)(int64_t)counter.m_integer
+            : (double)counter.m_integer;
+
+        double next = model.m_generator->next(counter.m_tick++, previous, counter.m_randomState);
+
+        if (isDouble)
+            counter.m_double = next;
+        else
+            counter.m_integer = toInteger(meta, next);
+    }
+    else
+    {
+        double elapsed = std::chrono::duration<double>(now - counter.m_lastRead).count();
+
+        if (isDouble)
+        {
+            counter.m_double += model.m_rate * elapsed;
+        }
+        else
+        {
+            double growth = counter.m_fraction + model.m_rate * elapsed;
+
+            double whole = std::floor(growth);
+
+            counter.m_integer += toInteger(meta, whole);
+            counter.m_fraction = growth - whole;
+        }
+    }
+
+    counter.m_lastRead = now;
+
+    switch (meta->statvaluetype)
+    {
+        case LAI_STAT_VALUE_TYPE_UINT32:
+            value.u32 = (counter.m_integer > UINT32_MAX) ? UINT32_MAX : (uint32_t)counter.m_integer;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT32:
+            value.s32 = (int32_t)std::min<int64_t>(std::max<int64_t>((int64_t)counter.m_integer, INT32_MIN), INT32_MAX);
+            break;
+
+        case LAI_STAT_VALUE_TYPE_UINT64:
+            value.u64 = counter.m_integer;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT64:
+            value.s64 = (int64_t)counter.m_integer;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_DOUBLE:
+            value.d64 = counter.m_double;
+            break;
+
+        default:
+            SWSS_LOG_THROW("unsupported stat value type %d for %s", meta->statvaluetype, meta->statidname);
+    }
+
+    if (mode == LAI_STATS_MODE_READ_AND_CLEAR)
+    {
+        counter.m_integer = 0;
+        counter.m_double = 0;
+        counter.m_fraction = 0;
+    }
+}
+
+void ObjectCounters::write(
+        _In_ const lai_stat_metadata_t* meta,
+        _In_ const TimePoint& now,
+        _In_ const lai_stat_value_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& counter = getCounter(meta->statid, now);
+
+    switch (meta->statvaluetype)
+    {
+        case LAI_STAT_VALUE_TYPE_UINT32:
+            counter.m_integer = value.u32;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT32:
+            counter.m_integer = (uint64_t)(int64_t)value.s32;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_UINT64:
+            counter.m_integer = value.u64;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_INT64:
+            counter.m_integer = (uint64_t)value.s64;
+            break;
+
+        case LAI_STAT_VALUE_TYPE_DOUBLE:
+            counter.m_double = value.d64;
+            break;
+
+        default:
+            SWSS_LOG_THROW("unsupported stat value type %d for %s", meta->statvaluetype, meta->statidname);
+    }
+
+    counter.m_fraction = 0;
+    counter.m_lastRead = now;
+}
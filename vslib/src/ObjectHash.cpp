@@ -0,0 +1,136 @@
+#include "ObjectHash.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+ObjectHash::ObjectHash():
+    m_objectTypes(LAI_OBJECT_TYPE_EXTENSIONS_MAX)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+ObjectHash::ObjectTypeHash& ObjectHash::at(
+        _In_ lai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        SWSS_LOG_THROW("invalid object type: %d", objectType);
+    }
+
+    return m_objectTypes[objectType];
+}
+
+const ObjectHash::ObjectTypeHash& ObjectHash::at(
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    if ((size_t)objectType >= m_objectTypes.size())
+    {
+        SWSS_LOG_THROW("invalid object type: %d", objectType);
+    }
+
+    return m_objectTypes[objectType];
+}
+
+AttrHash* ObjectHash::find(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto& hash = at(objectType);
+
+    auto it = hash.m_index.find(objectId);
+
+    return (it == hash.m_index.end()) ? nullptr : &hash.m_objects[it->second];
+}
+
+const AttrHash* ObjectHash::find(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto& hash = at(objectType);
+
+    auto it = hash.m_index.find(objectId);
+
+    return (it == hash.m_index.end()) ? nullptr : &hash.m_objects[it->second];
+}
+
+AttrHash& ObjectHash::insert(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto& hash = at(objectType);
+
+    auto it = hash.m_index.find(objectId);
+
+    if (it != hash.m_index.end())
+    {
+        return hash.m_objects[it->second];
+    }
+
+    hash.m_index[objectId] = hash.m_objects.size();
+
+    hash.m_objects.emplace_back(objectId);
+
+    return hash.m_objects.back();
+}
+
+bool ObjectHash::erase(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto& hash = at(objectType);
+
+    auto it = hash.m_index.find(objectId);
+
+    if (it == hash.m_index.end())
+    {
+        return false;
+    }
+
+    // move last object into erased position to keep storage contiguous
+
+    size_t pos = it->second;
+
+    hash.m_index.erase(it);
+
+    if (pos != hash.m_objects.size() - 1)
+    {
+        hash.m_objects[pos] = std::move(hash.m_objects.back());
+
+        hash.m_index[hash.m_objects[pos].getObjectId()] = pos;
+    }
+
+    hash.m_objects.pop_back();
+
+    return true;
+}
+
+size_t ObjectHash::size(
+        _In_ lai_object_type_t objectType) const
+{
+    SWSS_LOG_ENTER();
+
+    return at(objectType).m_objects.size();
+}
+
+std::vector<AttrHash>& ObjectHash::getObjects(
+        _In_ lai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    return at(objectType).m_objects;
+}
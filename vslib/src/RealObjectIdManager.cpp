@@ -7,76 +7,17 @@ extern "C" {
 #include "laimetadata.h"
 }
 
-#define LAI_OBJECT_ID_BITS_SIZE (8 * sizeof(lai_object_id_t))
-
-static_assert(LAI_OBJECT_ID_BITS_SIZE == 64, "lai_object_id_t must have 64 bits");
 static_assert(sizeof(lai_object_id_t) == sizeof(uint64_t), "LAI object ID size should be uint64_t");
 
-#define LAI_VS_OID_RESERVED_BITS_SIZE ( 8 )
-
-#define LAI_VS_LINECARD_INDEX_BITS_SIZE ( 8 )
-#define LAI_VS_LINECARD_INDEX_MAX ( (1ULL << LAI_VS_LINECARD_INDEX_BITS_SIZE) - 1 )
-#define LAI_VS_LINECARD_INDEX_MASK (LAI_VS_LINECARD_INDEX_MAX)
-
-#define LAI_VS_GLOBAL_CONTEXT_BITS_SIZE ( 8 )
-#define LAI_VS_GLOBAL_CONTEXT_MAX ( (1ULL << LAI_VS_GLOBAL_CONTEXT_BITS_SIZE) - 1 )
-#define LAI_VS_GLOBAL_CONTEXT_MASK (LAI_VS_GLOBAL_CONTEXT_MAX)
-
-#define LAI_VS_OBJECT_TYPE_BITS_SIZE ( 8 )
-#define LAI_VS_OBJECT_TYPE_MAX ( (1ULL << LAI_VS_OBJECT_TYPE_BITS_SIZE) - 1 )
-#define LAI_VS_OBJECT_TYPE_MASK (LAI_VS_OBJECT_TYPE_MAX)
-
-#define LAI_VS_OBJECT_INDEX_BITS_SIZE ( 32 )
-#define LAI_VS_OBJECT_INDEX_MAX ( (1ULL << LAI_VS_OBJECT_INDEX_BITS_SIZE) - 1 )
-#define LAI_VS_OBJECT_INDEX_MASK (LAI_VS_OBJECT_INDEX_MAX)
-
-#define LAI_VS_OBJECT_ID_BITS_SIZE (      \
-        LAI_VS_OID_RESERVED_BITS_SIZE +   \
-        LAI_VS_GLOBAL_CONTEXT_BITS_SIZE + \
-        LAI_VS_LINECARD_INDEX_BITS_SIZE +   \
-        LAI_VS_OBJECT_TYPE_BITS_SIZE +    \
-        LAI_VS_OBJECT_INDEX_BITS_SIZE )
-
-static_assert(LAI_VS_OBJECT_ID_BITS_SIZE == LAI_OBJECT_ID_BITS_SIZE, "vs object id size must be equal to LAI object id size");
-
-/*
- * This condition must be met, since we need to be able to encode LAI object
- * type in object id on defined number of bits.
- */
-static_assert(LAI_OBJECT_TYPE_EXTENSIONS_MAX < LAI_VS_OBJECT_TYPE_MAX, "vs max object type value must be greater than supported LAI max objeect type value");
-
-/*
- * Current OBJECT ID format:
- *
- * bits 63..56 - reserved (must be zero)
- * bits 55..48 - global context
- * bits 47..40 - linecard index
- * bits 49..32 - LAI object type
- * bits 31..0  - object index
- *
- * So large number of bits is required, otherwise we would need to have map of
- * OID to some struct that will have all those values.  But having all this
- * information in OID itself is more convenient.
- */
-
-#define LAI_VS_GET_OBJECT_INDEX(oid) \
-    ( ((uint64_t)oid) & ( LAI_VS_OBJECT_INDEX_MASK ) )
+typedef lairedis::VsObjectIdLayout Layout;
 
-#define LAI_VS_GET_OBJECT_TYPE(oid) \
-    ( (((uint64_t)oid) >> ( LAI_VS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_VS_OBJECT_TYPE_MASK ) )
+#define LAI_VS_TEST_OID (0x0023456789abcdef)
 
-#define LAI_VS_GET_LINECARD_INDEX(oid) \
-    ( (((uint64_t)oid) >> ( LAI_VS_OBJECT_TYPE_BITS_SIZE + LAI_VS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_VS_LINECARD_INDEX_MASK ) )
-
-#define LAI_VS_GET_GLOBAL_CONTEXT(oid) \
-    ( (((uint64_t)oid) >> ( LAI_VS_LINECARD_INDEX_BITS_SIZE + LAI_VS_OBJECT_TYPE_BITS_SIZE + LAI_VS_OBJECT_INDEX_BITS_SIZE) ) & ( LAI_VS_GLOBAL_CONTEXT_MASK ) )
-
-#define LAI_VS_TEST_OID (0x0123456789abcdef)
-
-static_assert(LAI_VS_GET_GLOBAL_CONTEXT(LAI_VS_TEST_OID) == 0x23, "test global context");
-static_assert(LAI_VS_GET_LINECARD_INDEX(LAI_VS_TEST_OID) == 0x45, "test linecard index");
-static_assert(LAI_VS_GET_OBJECT_TYPE(LAI_VS_TEST_OID) == 0x67, "test object type");
-static_assert(LAI_VS_GET_OBJECT_INDEX(LAI_VS_TEST_OID) == 0x89abcdef, "test object index");
+static_assert(Layout::getGlobalContext(LAI_VS_TEST_OID) == 0x23, "test global context");
+static_assert(Layout::getLinecardIndex(LAI_VS_TEST_OID) == 0x45, "test linecard index");
+static_assert(Layout::getObjectType(LAI_VS_TEST_OID) == 0x67, "test object type");
+static_assert(Layout::getObjectIndex(LAI_VS_TEST_OID) == 0x89abcdef, "test object index");
+static_assert(Layout::construct((lai_object_type_t)0x67, 0x45, 0x89abcdef, 0x23) == LAI_VS_TEST_OID, "test construct");
 
 using namespace laivs;
 
@@ -88,12 +29,14 @@ RealObjectIdManager::RealObjectIdManager(
 {
     SWSS_LOG_ENTER();
 
-    if (globalContext > LAI_VS_GLOBAL_CONTEXT_MAX)
+    if (globalContext > Layout::GLOBAL_CONTEXT_MAX)
     {
-        SWSS_LOG_THROW("specified globalContext(0x%x) > maximum global context 0x%llx",
+        SWSS_LOG_THROW("specified globalContext(0x%x) > maximum global context 0x%" PRIx64,
                 globalContext,
-                LAI_VS_GLOBAL_CONTEXT_MAX);
+                Layout::GLOBAL_CONTEXT_MAX);
     }
+
+    m_indexer.fill(0);
 }
 
 lai_object_id_t RealObjectIdManager::laiLinecardIdQuery(
@@ -124,7 +67,7 @@ lai_object_id_t RealObjectIdManager::laiLinecardIdQuery(
     // - if object id has existing linecard index
     // but then this method can't be made static
 
-    uint32_t linecardIndex = (uint32_t)LAI_VS_GET_LINECARD_INDEX(objectId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(objectId);
 
     return constructObjectId(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, m_globalContext);
 }
@@ -139,7 +82,7 @@ lai_object_type_t RealObjectIdManager::laiObjectTypeQuery(
         return LAI_OBJECT_TYPE_NULL;
     }
 
-    lai_object_type_t objectType = (lai_object_type_t)(LAI_VS_GET_OBJECT_TYPE(objectId));
+    lai_object_type_t objectType = Layout::getObjectType(objectId);
 
     if (objectType == LAI_OBJECT_TYPE_NULL || objectType >= LAI_OBJECT_TYPE_EXTENSIONS_MAX)
     {
@@ -168,27 +111,27 @@ void RealObjectIdManager::clear()
 
     SWSS_LOG_NOTICE("clearing linecard index set");
 
-    m_linecardIndexes.clear();
-    m_indexer.clear();
+    m_linecardIndexes.reset();
+    m_indexer.fill(0);
 }
 
 uint32_t RealObjectIdManager::allocateNewLinecardIndex()
 {
     SWSS_LOG_ENTER();
 
-    for (uint32_t index = 0; index < LAI_VS_LINECARD_INDEX_MAX; ++index)
+    for (uint32_t index = 0; index < Layout::LINECARD_INDEX_MAX; ++index)
     {
-        if (m_linecardIndexes.find(index) != m_linecardIndexes.end())
+        if (m_linecardIndexes.test(index))
             continue;
 
-        m_linecardIndexes.insert(index);
+        m_linecardIndexes.set(index);
 
         SWSS_LOG_NOTICE("allocated new linecard index 0x%x", index);
 
         return index;
     }
 
-    SWSS_LOG_THROW("no more available linecard indexes (used count is: %zu)", m_linecardIndexes.size());
+    SWSS_LOG_THROW("no more available linecard indexes (used count is: %zu)", m_linecardIndexes.count());
 }
 
 void RealObjectIdManager::releaseLinecardIndex(
@@ -196,14 +139,12 @@ void RealObjectIdManager::releaseLinecardIndex(
 {
     SWSS_LOG_ENTER();
 
-    auto it = m_linecardIndexes.find(index);
-
-    if (it == m_linecardIndexes.end())
+    if (index > Layout::LINECARD_INDEX_MAX || !m_linecardIndexes.test(index))
     {
         SWSS_LOG_THROW("linecard index 0x%x is invalid! programming error", index);
     }
 
-    m_linecardIndexes.erase(it);
+    m_linecardIndexes.reset(index);
 
     SWSS_LOG_DEBUG("released linecard index 0x%x", index);
 }
@@ -234,16 +175,16 @@ lai_object_id_t RealObjectIdManager::allocateNewObjectId(
                 lai_serialize_object_type(linecardObjectType).c_str());
     }
 
-    uint32_t linecardIndex = (uint32_t)LAI_VS_GET_LINECARD_INDEX(linecardId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(linecardId);
 
     // count from zero
     uint64_t objectIndex = m_indexer[objectType]++; // allocation !
 
-    if (objectIndex > LAI_VS_OBJECT_INDEX_MAX)
+    if (objectIndex > Layout::OBJECT_INDEX_MAX)
     {
-        SWSS_LOG_THROW("no more object indexes available, given: 0x%" PRIx64 " but limit is 0x%llx",
+        SWSS_LOG_THROW("no more object indexes available, given: 0x%" PRIx64 " but limit is 0x%" PRIx64,
                 objectIndex,
-                LAI_VS_OBJECT_INDEX_MAX);
+                Layout::OBJECT_INDEX_MAX);
     }
 
     lai_object_id_t objectId = constructObjectId(objectType, linecardIndex, objectIndex, m_globalContext);
@@ -270,12 +211,12 @@ lai_object_id_t RealObjectIdManager::allocateNewLinecardObjectId(
 
     uint32_t linecardIndex = config->m_linecardIndex;
 
-    if (linecardIndex > LAI_VS_LINECARD_INDEX_MAX)
+    if (linecardIndex > Layout::LINECARD_INDEX_MAX)
     {
-        SWSS_LOG_THROW("linecard index %u > %llu (max)", linecardIndex, LAI_VS_LINECARD_INDEX_MAX);
+        SWSS_LOG_THROW("linecard index %u > %" PRIu64 " (max)", linecardIndex, Layout::LINECARD_INDEX_MAX);
     }
 
-    m_linecardIndexes.insert(linecardIndex);
+    m_linecardIndexes.set(linecardIndex);
 
     lai_object_id_t objectId = constructObjectId(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, m_globalContext);
 
@@ -293,7 +234,7 @@ void RealObjectIdManager::releaseObjectId(
 
     if (laiObjectTypeQuery(objectId) == LAI_OBJECT_TYPE_LINECARD)
     {
-        releaseLinecardIndex((uint32_t)LAI_VS_GET_LINECARD_INDEX(objectId));
+        releaseLinecardIndex(Layout::getLinecardIndex(objectId));
     }
 }
 
@@ -303,19 +244,15 @@ lai_object_id_t RealObjectIdManager::constructObjectId(
         _In_ uint64_t objectIndex,
         _In_ uint32_t globalContext)
 {
-    SWSS_LOG_ENTER();
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
 
-    return (lai_object_id_t)(
-            ((uint64_t)globalContext << ( LAI_VS_LINECARD_INDEX_BITS_SIZE + LAI_VS_OBJECT_TYPE_BITS_SIZE + LAI_VS_OBJECT_INDEX_BITS_SIZE )) |
-            ((uint64_t)linecardIndex << ( LAI_VS_OBJECT_TYPE_BITS_SIZE + LAI_VS_OBJECT_INDEX_BITS_SIZE )) |
-            ((uint64_t)objectType << ( LAI_VS_OBJECT_INDEX_BITS_SIZE)) |
-            objectIndex);
+    return Layout::construct(objectType, linecardIndex, objectIndex, globalContext);
 }
 
 lai_object_id_t RealObjectIdManager::linecardIdQuery(
         _In_ lai_object_id_t objectId)
 {
-    SWSS_LOG_ENTER();
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
 
     if (objectId == LAI_NULL_OBJECT_ID)
     {
@@ -337,23 +274,23 @@ lai_object_id_t RealObjectIdManager::linecardIdQuery(
         return objectId;
     }
 
-    uint32_t linecardIndex = (uint32_t)LAI_VS_GET_LINECARD_INDEX(objectId);
-    uint32_t globalContext = (uint32_t)LAI_VS_GET_GLOBAL_CONTEXT(objectId);
+    uint32_t linecardIndex = Layout::getLinecardIndex(objectId);
+    uint32_t globalContext = Layout::getGlobalContext(objectId);
 
-    return constructObjectId(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, globalContext);
+    return Layout::construct(LAI_OBJECT_TYPE_LINECARD, linecardIndex, linecardIndex, globalContext);
 }
 
 lai_object_type_t RealObjectIdManager::objectTypeQuery(
         _In_ lai_object_id_t objectId)
 {
-    SWSS_LOG_ENTER();
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
 
     if (objectId == LAI_NULL_OBJECT_ID)
     {
         return LAI_OBJECT_TYPE_NULL;
     }
 
-    lai_object_type_t objectType = (lai_object_type_t)(LAI_VS_GET_OBJECT_TYPE(objectId));
+    lai_object_type_t objectType = Layout::getObjectType(objectId);
 
     if (!lai_metadata_is_object_type_valid(objectType))
     {
@@ -373,12 +310,14 @@ uint32_t RealObjectIdManager::getLinecardIndex(
 
     auto linecardId = linecardIdQuery(objectId);
 
-    return LAI_VS_GET_LINECARD_INDEX(linecardId);
+    return Layout::getLinecardIndex(linecardId);
 }
 
 uint32_t RealObjectIdManager::getObjectIndex(
         _In_ lai_object_id_t objectId)
 {
-    return LAI_VS_GET_OBJECT_INDEX(objectId);
+    // SWSS_LOG_ENTER(); // disabled for performance reasons
+
+    return (uint32_t)Layout::getObjectIndex(objectId);
 }
 
@@ -0,0 +1,209 @@
+#include "RecordingReplay.h"
+
+#include "swss/logger.h"
+
+#include <algorithm>
+
+using namespace laivs;
+
+RecordingReplay::RecordingReplay():
+    m_speed(1.0),
+    m_start(std::chrono::steady_clock::now())
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+void RecordingReplay::setSpeed(
+        _In_ double speed)
+{
+    SWSS_LOG_ENTER();
+
+    if (speed <= 0)
+    {
+        SWSS_LOG_THROW("replay speed must be positive, got %f", speed);
+    }
+
+    m_speed = speed;
+}
+
+double RecordingReplay::getSpeed() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_speed;
+}
+
+void RecordingReplay::start()
+{
+    SWSS_LOG_ENTER();
+
+    m_start = std::chrono::steady_clock::now();
+}
+
+bool RecordingReplay::empty() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_attrs.empty() && m_stats.empty() && m_notifications.empty();
+}
+
+void RecordingReplay::addAttr(
+        _In_ lai_object_type_t objectType,
+        _In_ uint64_t creationIndex,
+        _In_ uint64_t timeUs,
+        _In_ std::shared_ptr<LaiAttrWrap> attr)
+{
+    SWSS_LOG_ENTER();
+
+    auto& samples = m_attrs[std::make_pair(objectType, creationIndex)][attr->getAttr()->id];
+
+    // values are step function of time, polling same value again adds
+    // nothing, this keeps long recordings with 1 s polling small
+
+    if (samples.size() && samples.back().m_attr->getAttrStrValue() == attr->getAttrStrValue())
+    {
+        return;
+    }
+
+    samples.push_back(AttrSample{ timeUs, attr });
+}
+
+void RecordingReplay::addStat(
+        _In_ lai_object_type_t objectType,
+        _In_ uint64_t creationIndex,
+        _In_ uint64_t timeUs,
+        _In_ lai_stat_id_t statId,
+        _In_ uint64_t value)
+{
+    SWSS_LOG_ENTER();
+
+    auto& samples = m_stats[std::make_pair(objectType, creationIndex)][statId];
+
+    if (samples.size() && samples.back().m_value == value)
+    {
+        return;
+    }
+
+    samples.push_back(StatSample{ timeUs, value });
+}
+
+void RecordingReplay::addNotification(
+        _In_ uint64_t timeUs,
+        _In_ const std::string& name,
+        _In_ const std::string& serializedNotification)
+{
+    SWSS_LOG_ENTER();
+
+    m_notifications.push_back(Notification{ timeUs, name, serializedNotification });
+}
+
+template <typename T>
+const T* RecordingReplay::findSample(
+        _In_ const std::vector<T>& samples,
+        _In_ uint64_t timeUs)
+{
+    SWSS_LOG_ENTER();
+
+    if (samples.empty())
+    {
+        return nullptr;
+    }
+
+    // last sample recorded at or before given time
+
+    auto it = std::upper_bound(samples.begin(), samples.end(), timeUs,
+            [](uint64_t t, const T& sample) { return t < sample.m_timeUs; });
+
+    if (it == samples.begin())
+    {
+        return &samples.front();
+    }
+
+    return &*(it - 1);
+}
+
+uint64_t RecordingReplay::getRecordingTimeUs() const
+{
+    SWSS_LOG_ENTER();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start);
+
+    return (uint64_t)((double)elapsed.count() * m_speed);
+}
+
+std::shared_ptr<LaiAttrWrap> RecordingReplay::getAttr(
+        _In_ lai_object_type_t objectType,
+        _In_ uint64_t creationIndex,
+        _In_ lai_attr_id_t attrId) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_attrs.find(std::make_pair(objectType, creationIndex));
+
+    if (it == m_attrs.end())
+    {
+        return nullptr;
+    }
+
+    auto ait = it->second.find(attrId);
+
+    if (ait == it->second.end())
+    {
+        return nullptr;
+    }
+
+    auto sample = findSample(ait->second, getRecordingTimeUs());
+
+    return sample ? sample->m_attr : nullptr;
+}
+
+bool RecordingReplay::getStat(
+        _In_ lai_object_type_t objectType,
+        _In_ uint64_t creationIndex,
+        _In_ lai_stat_id_t statId,
+        _Out_ uint64_t& value) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_stats.find(std::make_pair(objectType, creationIndex));
+
+    if (it == m_stats.end())
+    {
+        return false;
+    }
+
+    auto sit = it->second.find(statId);
+
+    if (sit == it->second.end())
+    {
+        return false;
+    }
+
+    auto sample = findSample(sit->second, getRecordingTimeUs());
+
+    if (sample == nullptr)
+    {
+        return false;
+    }
+
+    value = sample->m_value;
+
+    return true;
+}
+
+const std::vector<RecordingReplay::Notification>& RecordingReplay::getNotifications() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_notifications;
+}
+
+std::chrono::steady_clock::time_point RecordingReplay::getEmitTime(
+        _In_ const Notification& notification) const
+{
+    SWSS_LOG_ENTER();
+
+    return m_start + std::chrono::microseconds((uint64_t)((double)notification.m_timeUs / m_speed));
+}
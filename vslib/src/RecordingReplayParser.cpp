@@ -0,0 +1,547 @@
+#include "RecordingReplayParser.h"
+
+#include "lib/inc/BinaryRecordReader.h"
+#include "lib/inc/BinaryRecordFormat.h"
+#include "lib/inc/lairediscommon.h"
+
+#include "meta/lai_serialize.h"
+#include "meta/MetadataIndex.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <fstream>
+#include <inttypes.h>
+
+using namespace laivs;
+
+std::shared_ptr<RecordingReplay> RecordingReplayParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    auto replay = std::make_shared<RecordingReplay>();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, returning empty replay");
+
+        return replay;
+    }
+
+    std::string file(fileName);
+
+    State state;
+
+    state.m_started = false;
+    state.m_startUs = 0;
+    state.m_get.m_pending = false;
+    state.m_getStats.m_pending = false;
+    state.m_unknown = 0;
+
+    std::string record;
+
+    uint64_t lines = 0;
+
+    if (lairedis::BinaryRecordReader::isBinaryRecording(file))
+    {
+        std::ifstream ifs(file, std::ifstream::in | std::ifstream::binary);
+
+        SWSS_LOG_NOTICE("loading binary recording replay from: %s", file.c_str());
+
+        lairedis::BinaryRecordReader reader(ifs);
+
+        uint64_t timestamp;
+
+        while (reader.getRecord(timestamp, record))
+        {
+            parseRecord(replay, state, timestamp, record);
+
+            lines++;
+        }
+    }
+    else
+    {
+        std::ifstream ifs(file);
+
+        if (!ifs.is_open())
+        {
+            SWSS_LOG_WARN("failed to open recording file: %s", file.c_str());
+
+            return replay;
+        }
+
+        SWSS_LOG_NOTICE("loading recording replay from: %s", file.c_str());
+
+        std::string line;
+
+        while (getline(ifs, line))
+        {
+            // timestamp|op|...
+
+            auto pos = line.find('|');
+
+            uint64_t timestamp;
+
+            if (pos == std::string::npos ||
+                    !lairedis::BinaryRecordFormat::deserializeTimestamp(line.substr(0, pos), timestamp))
+            {
+                SWSS_LOG_ERROR("invalid recording line: %s", line.c_str());
+                continue;
+            }
+
+            parseRecord(replay, state, timestamp, line.substr(pos + 1));
+
+            lines++;
+        }
+    }
+
+    if (!state.m_started)
+    {
+        SWSS_LOG_WARN("linecard create not found in recording, recording time starts at linecard create");
+    }
+
+    if (state.m_unknown)
+    {
+        SWSS_LOG_WARN("skipped %" PRIu64 " requests on objects not created in recording", state.m_unknown);
+    }
+
+    SWSS_LOG_NOTICE("loaded %" PRIu64 " recording lines, %zu objects, %zu notifications",
+            lines,
+            state.m_objects.size(),
+            replay->getNotifications().size());
+
+    return replay;
+}
+
+bool RecordingReplayParser::parseSpeed(
+        _In_ const char* speedStr,
+        _Out_ double& speed)
+{
+    SWSS_LOG_ENTER();
+
+    speed = 1.0;
+
+    if (speedStr == nullptr)
+    {
+        return true;
+    }
+
+    if (sscanf(speedStr, "%lf", &speed) != 1 || speed <= 0)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as positive replay speed", speedStr);
+        return false;
+    }
+
+    return true;
+}
+
+void RecordingReplayParser::parseRecord(
+        _In_ std::shared_ptr<RecordingReplay> replay,
+        _Inout_ State& state,
+        _In_ uint64_t timestamp,
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    // replay clock starts at linecard create, so recording time starts at
+    // recorded linecard create, anything before is at time zero
+
+    uint64_t timeUs = (state.m_started && timestamp > state.m_startUs) ? (timestamp - state.m_startUs) : 0;
+
+    auto tokens = swss::tokenize(record, '|');
+
+    if (tokens.size() < 2)
+    {
+        return;
+    }
+
+    auto& op = tokens.at(0);
+
+    try
+    {
+        if (op == "c")
+        {
+            // c|LAI_OBJECT_TYPE_X:oid:0x...|ATTR=value|ATTR=value
+
+            parseCreate(state, timestamp, tokens.at(1));
+        }
+        else if (op == "r")
+        {
+            // r|LAI_OBJECT_TYPE_X:oid:0x...
+
+            parseRemove(state, tokens.at(1));
+        }
+        else if (op == "g")
+        {
+            // g|LAI_OBJECT_TYPE_X:oid:0x...|ATTR=|ATTR=
+
+            state.m_bulkGet.clear();
+
+            parseRequest(state, tokens.at(1), state.m_get);
+        }
+        else if (op == "B")
+        {
+            // B|LAI_OBJECT_TYPE_X:count||oid:0x...|ATTR=|ATTR=||oid:0x...|ATTR=
+
+            state.m_get.m_pending = false;
+
+            parseBulkGet(state, record);
+        }
+        else if (op == "G")
+        {
+            // only last get or bulk get can be pending, since response is
+            // recorded right after request
+
+            if (state.m_bulkGet.size())
+            {
+                parseBulkGetResponse(replay, state, timeUs, record);
+            }
+            else
+            {
+                parseGetResponse(replay, state.m_get, timeUs, tokens);
+            }
+        }
+        else if (op == "q" && tokens.at(1) == "get_stats" && tokens.size() > 2)
+        {
+            // q|get_stats|LAI_OBJECT_TYPE_X:oid:0x...|STAT=|STAT=
+
+            parseRequest(state, tokens.at(2), state.m_getStats);
+
+            auto& index = laimeta::MetadataIndex::getInstance();
+
+            for (size_t idx = 3; idx < tokens.size(); idx++)
+            {
+                auto name = tokens.at(idx).substr(0, tokens.at(idx).find('='));
+
+                state.m_getStats.m_stats.push_back(index.getStatMetadata(name));
+            }
+        }
+        else if (op == "Q" && tokens.at(1) == "get_stats")
+        {
+            parseGetStatsResponse(replay, state.m_getStats, timeUs, tokens);
+        }
+        else if (op == "n" && tokens.size() > 2)
+        {
+            // n|name|serialized|
+
+            auto& name = tokens.at(1);
+
+            if (name != LAI_LINECARD_NOTIFICATION_NAME_LINECARD_STATE_CHANGE &&
+                    name != LAI_LINECARD_NOTIFICATION_NAME_LINECARD_ALARM_NOTIFY)
+            {
+                SWSS_LOG_WARN("notification %s is not supported by replay", name.c_str());
+                return;
+            }
+
+            replay->addNotification(timeUs, name, tokens.at(2));
+        }
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("failed to parse recording line %s: %s", record.c_str(), e.what());
+
+        state.m_get.m_pending = false;
+        state.m_getStats.m_pending = false;
+        state.m_bulkGet.clear();
+    }
+}
+
+void RecordingReplayParser::parseCreate(
+        _Inout_ State& state,
+        _In_ uint64_t timestamp,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    lai_object_meta_key_t metaKey;
+
+    lai_deserialize_object_meta_key(key, metaKey);
+
+    // virtual ids come from global counter shared by all object types, and
+    // real ids on virtual linecard from per type counter, so only position
+    // among created objects of the same type matches
+
+    auto creationIndex = state.m_created[metaKey.objecttype]++;
+
+    state.m_objects[metaKey.objectkey.key.object_id] = std::make_pair(metaKey.objecttype, creationIndex);
+
+    if (metaKey.objecttype == LAI_OBJECT_TYPE_LINECARD && !state.m_started)
+    {
+        state.m_started = true;
+        state.m_startUs = timestamp;
+    }
+}
+
+void RecordingReplayParser::parseRemove(
+        _Inout_ State& state,
+        _In_ const std::string& key)
+{
+    SWSS_LOG_ENTER();
+
+    // creation index of removed object is not reused, same as object index
+    // on virtual linecard
+
+    lai_object_meta_key_t metaKey;
+
+    lai_deserialize_object_meta_key(key, metaKey);
+
+    state.m_objects.erase(metaKey.objectkey.key.object_id);
+}
+
+void RecordingReplayParser::parseRequest(
+        _Inout_ State& state,
+        _In_ const std::string& key,
+        _Out_ Request& request)
+{
+    SWSS_LOG_ENTER();
+
+    // response is recorded right after request, so only last request can be
+    // pending
+
+    request.m_pending = false;
+    request.m_stats.clear();
+
+    lai_object_meta_key_t metaKey;
+
+    lai_deserialize_object_meta_key(key, metaKey);
+
+    auto it = state.m_objects.find(metaKey.objectkey.key.object_id);
+
+    if (it == state.m_objects.end() || it->second.first != metaKey.objecttype)
+    {
+        // object was created before recording started, or by linecard
+
+        state.m_unknown++;
+
+        return;
+    }
+
+    request.m_objectType = metaKey.objecttype;
+    request.m_creationIndex = it->second.second;
+    request.m_pending = true;
+}
+
+void RecordingReplayParser::parseBulkGet(
+        _Inout_ State& state,
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    state.m_bulkGet.clear();
+
+    auto entries = splitEntries(record);
+
+    auto objectType = entries.at(0).substr(entries.at(0).find('|') + 1);
+
+    objectType = objectType.substr(0, objectType.find(':'));
+
+    for (size_t idx = 1; idx < entries.size(); idx++)
+    {
+        auto oid = entries.at(idx).substr(0, entries.at(idx).find('|'));
+
+        Request request;
+
+        parseRequest(state, objectType + ":" + oid, request);
+
+        // unknown objects are kept, so responses match requests by position
+
+        state.m_bulkGet.push_back(request);
+    }
+}
+
+void RecordingReplayParser::parseGetResponse(
+        _In_ std::shared_ptr<RecordingReplay> replay,
+        _Inout_ Request& request,
+        _In_ uint64_t timeUs,
+        _In_ const std::vector<std::string>& tokens)
+{
+    SWSS_LOG_ENTER();
+
+    // G|LAI_STATUS_SUCCESS|ATTR=value|ATTR=value
+
+    if (!request.m_pending)
+    {
+        return;
+    }
+
+    request.m_pending = false;
+
+    lai_status_t status;
+
+    lai_deserialize_status(tokens.at(1), status);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    parseAttributes(replay, request, timeUs, tokens, 2);
+}
+
+void RecordingReplayParser::parseBulkGetResponse(
+        _In_ std::shared_ptr<RecordingReplay> replay,
+        _Inout_ State& state,
+        _In_ uint64_t timeUs,
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    // G|LAI_STATUS_SUCCESS||LAI_STATUS_SUCCESS|ATTR=value||LAI_STATUS_FAILURE
+
+    auto requests = std::move(state.m_bulkGet);
+
+    state.m_bulkGet.clear();
+
+    auto entries = splitEntries(record);
+
+    if (entries.size() != requests.size() + 1)
+    {
+        // older recordings have only object statuses in response
+
+        SWSS_LOG_INFO("bulk get response has no values for %zu objects", requests.size());
+        return;
+    }
+
+    for (size_t idx = 0; idx < requests.size(); idx++)
+    {
+        if (!requests[idx].m_pending)
+        {
+            continue;
+        }
+
+        auto tokens = swss::tokenize(entries.at(idx + 1), '|');
+
+        lai_status_t status;
+
+        lai_deserialize_status(tokens.at(0), status);
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        parseAttributes(replay, requests[idx], timeUs, tokens, 1);
+    }
+}
+
+void RecordingReplayParser::parseAttributes(
+        _In_ std::shared_ptr<RecordingReplay> replay,
+        _In_ const Request& request,
+        _In_ uint64_t timeUs,
+        _In_ const std::vector<std::string>& tokens,
+        _In_ size_t first)
+{
+    SWSS_LOG_ENTER();
+
+    auto& index = laimeta::MetadataIndex::getInstance();
+
+    for (size_t idx = first; idx < tokens.size(); idx++)
+    {
+        auto& token = tokens.at(idx);
+
+        auto pos = token.find('=');
+
+        if (pos == std::string::npos)
+        {
+            continue;
+        }
+
+        auto name = token.substr(0, pos);
+
+        auto meta = index.getAttrMetadata(name);
+
+        if (meta == nullptr || meta->isoidattribute)
+        {
+            // object ids in recording are lairedis virtual ids and would
+            // point to different objects on virtual linecard
+
+            continue;
+        }
+
+        auto attr = std::make_shared<LaiAttrWrap>(name, token.substr(pos + 1));
+
+        replay->addAttr(request.m_objectType, request.m_creationIndex, timeUs, attr);
+    }
+}
+
+void RecordingReplayParser::parseGetStatsResponse(
+        _In_ std::shared_ptr<RecordingReplay> replay,
+        _Inout_ Request& request,
+        _In_ uint64_t timeUs,
+        _In_ const std::vector<std::string>& tokens)
+{
+    SWSS_LOG_ENTER();
+
+    // Q|get_stats|LAI_STATUS_SUCCESS|value|value
+
+    if (!request.m_pending || tokens.size() < 3)
+    {
+        return;
+    }
+
+    request.m_pending = false;
+
+    lai_status_t status;
+
+    lai_deserialize_status(tokens.at(2), status);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return;
+    }
+
+    if (tokens.size() - 3 != request.m_stats.size())
+    {
+        SWSS_LOG_ERROR("expected %zu stat values, got %zu", request.m_stats.size(), tokens.size() - 3);
+        return;
+    }
+
+    for (size_t idx = 0; idx < request.m_stats.size(); idx++)
+    {
+        auto meta = request.m_stats[idx];
+
+        if (meta == nullptr)
+        {
+            continue;
+        }
+
+        uint64_t value;
+
+        if (sscanf(tokens.at(idx + 3).c_str(), "%" SCNu64, &value) != 1)
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as %s value", tokens.at(idx + 3).c_str(), meta->statidname);
+            continue;
+        }
+
+        replay->addStat(request.m_objectType, request.m_creationIndex, timeUs, meta->statid, value);
+    }
+}
+
+std::vector<std::string> RecordingReplayParser::splitEntries(
+        _In_ const std::string& record)
+{
+    SWSS_LOG_ENTER();
+
+    // bulk records separate objects by empty field
+
+    std::vector<std::string> entries;
+
+    size_t begin = 0;
+
+    while (true)
+    {
+        auto end = record.find("||", begin);
+
+        entries.push_back(record.substr(begin, end - begin));
+
+        if (end == std::string::npos)
+        {
+            break;
+        }
+
+        begin = end + 2;
+    }
+
+    return entries;
+}
@@ -4,10 +4,32 @@
 
 using namespace laivs;
 
+Signal::Signal():
+    m_pending(false)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
 void Signal::notifyAll()
 {
     SWSS_LOG_ENTER();
 
+    if (m_pending.exchange(true))
+    {
+        // waiting thread was already notified and didn't wake up yet
+
+        return;
+    }
+
+    {
+        // waiting thread is either before predicate check, or already
+        // blocked in wait, so notification can't be missed
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+    }
+
     m_cv.notify_all();
 }
 
@@ -15,6 +37,15 @@ void Signal::notifyOne()
 {
     SWSS_LOG_ENTER();
 
+    if (m_pending.exchange(true))
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+    }
+
     m_cv.notify_one();
 }
 
@@ -24,5 +55,7 @@ void Signal::wait()
 
     std::unique_lock<std::mutex> lock(m_mutex);
 
-    m_cv.wait(lock);
+    m_cv.wait(lock, [this] { return m_pending.load(); });
+
+    m_pending = false;
 }
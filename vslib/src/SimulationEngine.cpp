@@ -0,0 +1,286 @@
+#include "SimulationEngine.h"
+
+#include "swss/logger.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace laivs;
+
+template <typename T>
+static T clampValue(
+        _In_ double value)
+{
+    SWSS_LOG_ENTER();
+
+    if (value <= (double)std::numeric_limits<T>::lowest())
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    if (value >= (double)std::numeric_limits<T>::max())
+    {
+        return std::numeric_limits<T>::max();
+    }
+
+    return (T)std::round(value);
+}
+
+SimulationEngine::SimulationEngine(
+        _In_ std::shared_ptr<SimulationProfile> profile):
+    m_profile(profile),
+    m_tick(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (profile == nullptr)
+    {
+        SWSS_LOG_THROW("simulation profile can't be nullptr");
+    }
+}
+
+std::shared_ptr<SimulationProfile> SimulationEngine::getProfile() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_profile;
+}
+
+void SimulationEngine::addObject(
+        _In_ lai_object_type_t objectType,
+        _In_ const AttrHash& attrHash)
+{
+    SWSS_LOG_ENTER();
+
+    lai_object_id_t objectId = attrHash.getObjectId();
+
+    SimulatedObject obj;
+
+    obj.m_objectType = objectType;
+    obj.m_objectId = objectId;
+
+    for (auto& a: attrHash.getAttrs())
+    {
+        SimulatedAttr attr;
+
+        if (initAttr(objectId, *a, attr))
+        {
+            obj.m_attrs.push_back(attr);
+        }
+    }
+
+    auto it = m_index.find(objectId);
+
+    if (obj.m_attrs.empty())
+    {
+        if (it != m_index.end())
+        {
+            removeObject(objectId);
+        }
+
+        return;
+    }
+
+    if (it != m_index.end())
+    {
+        m_objects[it->second] = std::move(obj);
+        return;
+    }
+
+    m_index[objectId] = m_objects.size();
+
+    m_objects.push_back(std::move(obj));
+}
+
+bool SimulationEngine::initAttr(
+        _In_ lai_object_id_t objectId,
+        _In_ const LaiAttrWrap& wrap,
+        _Out_ SimulatedAttr& attr) const
+{
+    SWSS_LOG_ENTER();
+
+    auto meta = wrap.getAttrMetadata();
+
+    auto generator = m_profile->getGenerator(meta);
+
+    if (generator == nullptr || !getValue(meta, wrap.getAttr(), attr.m_value))
+    {
+        return false;
+    }
+
+    attr.m_meta = meta;
+    attr.m_generator = generator;
+    attr.m_randomState = m_profile->getSeed() ^ (objectId * 0x9e3779b97f4a7c15ULL) ^ meta->attrid;
+
+    return true;
+}
+
+void SimulationEngine::setAttr(
+        _In_ lai_object_type_t objectType,
+        _In_ lai_object_id_t objectId,
+        _In_ const LaiAttrWrap& wrap)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(objectId);
+
+    if (it != m_index.end())
+    {
+        for (auto& sa: m_objects[it->second].m_attrs)
+        {
+            if (sa.m_meta == wrap.getAttrMetadata())
+            {
+                // keep generator state, continue from value which was set
+
+                getValue(sa.m_meta, wrap.getAttr(), sa.m_value);
+
+                return;
+            }
+        }
+    }
+
+    SimulatedAttr attr;
+
+    if (!initAttr(objectId, wrap, attr))
+    {
+        return;
+    }
+
+    if (it != m_index.end())
+    {
+        m_objects[it->second].m_attrs.push_back(attr);
+
+        return;
+    }
+
+    SimulatedObject obj;
+
+    obj.m_objectType = objectType;
+    obj.m_objectId = objectId;
+    obj.m_attrs.push_back(attr);
+
+    m_index[objectId] = m_objects.size();
+
+    m_objects.push_back(std::move(obj));
+}
+
+void SimulationEngine::removeObject(
+        _In_ lai_object_id_t objectId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(objectId);
+
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    size_t pos = it->second;
+
+    m_index.erase(it);
+
+    if (pos != m_objects.size() - 1)
+    {
+        m_objects[pos] = std::move(m_objects.back());
+
+        m_index[m_objects[pos].m_objectId] = pos;
+    }
+
+    m_objects.pop_back();
+}
+
+void SimulationEngine::tick(
+        _Inout_ ObjectHash& objectHash)
+{
+    SWSS_LOG_ENTER();
+
+    m_tick++;
+
+    for (auto& obj: m_objects)
+    {
+        auto attrHash = objectHash.find(obj.m_objectType, obj.m_objectId);
+
+        if (attrHash == nullptr)
+        {
+            continue;
+        }
+
+        for (auto& sa: obj.m_attrs)
+        {
+            auto wrap = attrHash->getAttr(sa.m_meta->attrid);
+
+            if (wrap == nullptr)
+            {
+                continue;
+            }
+
+            sa.m_value = sa.m_generator->next(m_tick, sa.m_value, sa.m_randomState);
+
+            lai_attribute_t attr;
+
+            attr.id = sa.m_meta->attrid;
+
+            setValue(sa.m_meta, sa.m_value, attr);
+
+            wrap->updateValue(&attr);
+        }
+    }
+}
+
+size_t SimulationEngine::getSimulatedObjectCount() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_objects.size();
+}
+
+bool SimulationEngine::getValue(
+        _In_ const lai_attr_metadata_t* meta,
+        _In_ const lai_attribute_t* attr,
+        _Out_ double& value)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta->attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_UINT8:     value = attr->value.u8;  break;
+        case LAI_ATTR_VALUE_TYPE_INT8:      value = attr->value.s8;  break;
+        case LAI_ATTR_VALUE_TYPE_UINT16:    value = attr->value.u16; break;
+        case LAI_ATTR_VALUE_TYPE_INT16:     value = attr->value.s16; break;
+        case LAI_ATTR_VALUE_TYPE_UINT32:    value = attr->value.u32; break;
+        case LAI_ATTR_VALUE_TYPE_INT32:     value = attr->value.s32; break;
+        case LAI_ATTR_VALUE_TYPE_UINT64:    value = (double)attr->value.u64; break;
+        case LAI_ATTR_VALUE_TYPE_INT64:     value = (double)attr->value.s64; break;
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:    value = attr->value.d64; break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+void SimulationEngine::setValue(
+        _In_ const lai_attr_metadata_t* meta,
+        _In_ double value,
+        _Out_ lai_attribute_t& attr)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta->attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_UINT8:     attr.value.u8  = clampValue<uint8_t>(value);  break;
+        case LAI_ATTR_VALUE_TYPE_INT8:      attr.value.s8  = clampValue<int8_t>(value);   break;
+        case LAI_ATTR_VALUE_TYPE_UINT16:    attr.value.u16 = clampValue<uint16_t>(value); break;
+        case LAI_ATTR_VALUE_TYPE_INT16:     attr.value.s16 = clampValue<int16_t>(value);  break;
+        case LAI_ATTR_VALUE_TYPE_UINT32:    attr.value.u32 = clampValue<uint32_t>(value); break;
+        case LAI_ATTR_VALUE_TYPE_INT32:     attr.value.s32 = clampValue<int32_t>(value);  break;
+        case LAI_ATTR_VALUE_TYPE_UINT64:    attr.value.u64 = clampValue<uint64_t>(value); break;
+        case LAI_ATTR_VALUE_TYPE_INT64:     attr.value.s64 = clampValue<int64_t>(value);  break;
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:    attr.value.d64 = value; break;
+
+        default:
+            SWSS_LOG_THROW("attribute %s is not numeric", meta->attridname);
+    }
+}
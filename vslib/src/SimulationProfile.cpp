@@ -0,0 +1,132 @@
+#include "SimulationProfile.h"
+
+#include "swss/logger.h"
+
+using namespace laivs;
+
+SimulationProfile::SimulationProfile():
+    m_tickIntervalMs(DEFAULT_TICK_INTERVAL_MS),
+    m_startDelayMs(DEFAULT_START_DELAY_MS),
+    m_seed(0)
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultGenerator = std::make_shared<ValueGenerator>(
+            LAI_VS_VALUE_GENERATOR_TYPE_RAMP,
+            std::vector<double>{ 1 });
+}
+
+uint32_t SimulationProfile::getTickIntervalMs() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_tickIntervalMs;
+}
+
+void SimulationProfile::setTickIntervalMs(
+        _In_ uint32_t tickIntervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    if (tickIntervalMs == 0)
+    {
+        SWSS_LOG_THROW("tick interval must be positive");
+    }
+
+    m_tickIntervalMs = tickIntervalMs;
+}
+
+uint32_t SimulationProfile::getStartDelayMs() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_startDelayMs;
+}
+
+void SimulationProfile::setStartDelayMs(
+        _In_ uint32_t startDelayMs)
+{
+    SWSS_LOG_ENTER();
+
+    m_startDelayMs = startDelayMs;
+}
+
+uint64_t SimulationProfile::getSeed() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_seed;
+}
+
+void SimulationProfile::setSeed(
+        _In_ uint64_t seed)
+{
+    SWSS_LOG_ENTER();
+
+    m_seed = seed;
+}
+
+void SimulationProfile::setDefaultGenerator(
+        _In_ std::shared_ptr<ValueGenerator> generator)
+{
+    SWSS_LOG_ENTER();
+
+    m_defaultGenerator = generator;
+}
+
+void SimulationProfile::setGenerator(
+        _In_ const lai_attr_metadata_t* meta,
+        _In_ std::shared_ptr<ValueGenerator> generator)
+{
+    SWSS_LOG_ENTER();
+
+    if (!isNumeric(meta))
+    {
+        SWSS_LOG_THROW("attribute %s is not numeric, can't be simulated", meta->attridname);
+    }
+
+    m_generators[std::make_pair(meta->objecttype, meta->attrid)] = generator;
+}
+
+std::shared_ptr<ValueGenerator> SimulationProfile::getGenerator(
+        _In_ const lai_attr_metadata_t* meta) const
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_generators.find(std::make_pair(meta->objecttype, meta->attrid));
+
+    if (it != m_generators.end())
+    {
+        return it->second;
+    }
+
+    if (meta->isreadonly && !meta->isenum && isNumeric(meta))
+    {
+        return m_defaultGenerator;
+    }
+
+    return nullptr;
+}
+
+bool SimulationProfile::isNumeric(
+        _In_ const lai_attr_metadata_t* meta)
+{
+    SWSS_LOG_ENTER();
+
+    switch (meta->attrvaluetype)
+    {
+        case LAI_ATTR_VALUE_TYPE_UINT8:
+        case LAI_ATTR_VALUE_TYPE_INT8:
+        case LAI_ATTR_VALUE_TYPE_UINT16:
+        case LAI_ATTR_VALUE_TYPE_INT16:
+        case LAI_ATTR_VALUE_TYPE_UINT32:
+        case LAI_ATTR_VALUE_TYPE_INT32:
+        case LAI_ATTR_VALUE_TYPE_UINT64:
+        case LAI_ATTR_VALUE_TYPE_INT64:
+        case LAI_ATTR_VALUE_TYPE_DOUBLE:
+            return true;
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,168 @@
+#include "SimulationProfileParser.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <fstream>
+#include <inttypes.h>
+
+using namespace laivs;
+
+std::shared_ptr<SimulationProfile> SimulationProfileParser::parseFromFile(
+        _In_ const char* fileName)
+{
+    SWSS_LOG_ENTER();
+
+    if (fileName == nullptr)
+    {
+        SWSS_LOG_NOTICE("file name is NULL, returning default simulation profile");
+
+        return std::make_shared<SimulationProfile>();
+    }
+
+    std::string file(fileName);
+
+    std::ifstream ifs(file);
+
+    if (!ifs.is_open())
+    {
+        SWSS_LOG_WARN("failed to open simulation profile file: %s", file.c_str());
+
+        return std::make_shared<SimulationProfile>();
+    }
+
+    SWSS_LOG_NOTICE("loading simulation profile from: %s", file.c_str());
+
+    std::string line;
+
+    auto profile = std::make_shared<SimulationProfile>();
+
+    while (getline(ifs, line))
+    {
+        /*
+         * line can be in 2 forms:
+         *
+         * option=value
+         * LAI_XXX_ATTR_YYY=generator
+         *
+         * where option is one of tick_ms, start_delay_ms, seed or default
+         */
+
+        if (line.size() == 0 || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        SWSS_LOG_INFO("line: %s", line.c_str());
+
+        auto toks = swss::tokenize(line, '=');
+
+        if (toks.size() != 2)
+        {
+            SWSS_LOG_ERROR("expected 2 tokens, got: %zu on line: %s", toks.size(), line.c_str());
+            continue;
+        }
+
+        parse(profile, toks.at(0), toks.at(1));
+    }
+
+    return profile;
+}
+
+bool SimulationProfileParser::parseUint64(
+        _In_ const std::string& str,
+        _Out_ uint64_t& value)
+{
+    SWSS_LOG_ENTER();
+
+    if (sscanf(str.c_str(), "%" SCNu64, &value) != 1)
+    {
+        SWSS_LOG_ERROR("failed to parse '%s' as number", str.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void SimulationProfileParser::parse(
+        _In_ std::shared_ptr<SimulationProfile> profile,
+        _In_ const std::string& key,
+        _In_ const std::string& value)
+{
+    SWSS_LOG_ENTER();
+
+    uint64_t number;
+
+    if (key == "tick_ms")
+    {
+        if (parseUint64(value, number) && number > 0 && number <= UINT32_MAX)
+        {
+            profile->setTickIntervalMs((uint32_t)number);
+        }
+
+        return;
+    }
+
+    if (key == "start_delay_ms")
+    {
+        if (parseUint64(value, number) && number <= UINT32_MAX)
+        {
+            profile->setStartDelayMs((uint32_t)number);
+        }
+
+        return;
+    }
+
+    if (key == "seed")
+    {
+        if (parseUint64(value, number))
+        {
+            profile->setSeed(number);
+        }
+
+        return;
+    }
+
+    if (key == "default")
+    {
+        if (value == "none")
+        {
+            profile->setDefaultGenerator(nullptr);
+            return;
+        }
+
+        auto generator = ValueGenerator::parse(value);
+
+        if (generator)
+        {
+            profile->setDefaultGenerator(generator);
+        }
+
+        return;
+    }
+
+    auto meta = lai_metadata_get_attr_metadata_by_attr_id_name(key.c_str());
+
+    if (meta == nullptr)
+    {
+        SWSS_LOG_ERROR("failed to find attribute metadata for %s", key.c_str());
+        return;
+    }
+
+    if (!SimulationProfile::isNumeric(meta))
+    {
+        SWSS_LOG_ERROR("attribute %s is not numeric, can't be simulated", key.c_str());
+        return;
+    }
+
+    auto generator = ValueGenerator::parse(value);
+
+    if (generator == nullptr)
+    {
+        return;
+    }
+
+    SWSS_LOG_NOTICE("adding generator %s = %s", key.c_str(), value.c_str());
+
+    profile->setGenerator(meta, generator);
+}
@@ -0,0 +1,271 @@
+#include "ValueGenerator.h"
+
+#include "swss/logger.h"
+#include "swss/tokenize.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+using namespace laivs;
+
+ValueGenerator::ValueGenerator(
+        _In_ lai_vs_value_generator_type_t type,
+        _In_ const std::vector<double>& params):
+    m_type(type),
+    m_params(params),
+    m_hasIntegerStep(false),
+    m_integerStep(0)
+{
+    SWSS_LOG_ENTER();
+
+    size_t expected = 0;
+
+    switch (type)
+    {
+        case LAI_VS_VALUE_GENERATOR_TYPE_CONSTANT:
+            expected = 1;
+            break;
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_RAMP:
+            expected = (params.size() == 3) ? 3 : 1;
+            break;
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_RANDOM_WALK:
+        case LAI_VS_VALUE_GENERATOR_TYPE_SINE:
+            expected = 3;
+            break;
+
+        default:
+            SWSS_LOG_THROW("generator type %d requires value list", type);
+    }
+
+    if (params.size() != expected)
+    {
+        SWSS_LOG_THROW("generator type %d expects %zu params, got %zu", type, expected, params.size());
+    }
+
+    if (type == LAI_VS_VALUE_GENERATOR_TYPE_SINE && params[2] <= 0)
+    {
+        SWSS_LOG_THROW("sine generator period must be positive");
+    }
+}
+
+ValueGenerator::ValueGenerator(
+        _In_ const std::vector<double>& values):
+    m_type(LAI_VS_VALUE_GENERATOR_TYPE_REPLAY),
+    m_values(values),
+    m_hasIntegerStep(false),
+    m_integerStep(0)
+{
+    SWSS_LOG_ENTER();
+
+    if (values.empty())
+    {
+        SWSS_LOG_THROW("replay generator requires at least one value");
+    }
+}
+
+ValueGenerator::ValueGenerator(
+        _In_ int64_t step):
+    m_type(LAI_VS_VALUE_GENERATOR_TYPE_RAMP),
+    m_params{ (double)step },
+    m_hasIntegerStep(true),
+    m_integerStep(step)
+{
+    SWSS_LOG_ENTER();
+
+    // empty
+}
+
+std::shared_ptr<ValueGenerator> ValueGenerator::parse(
+        _In_ const std::string& str)
+{
+    SWSS_LOG_ENTER();
+
+    auto pos = str.find(':');
+
+    if (pos == std::string::npos)
+    {
+        SWSS_LOG_ERROR("expected TYPE:PARAMS, got: %s", str.c_str());
+        return nullptr;
+    }
+
+    auto type = str.substr(0, pos);
+    auto args = str.substr(pos + 1);
+
+    if (type == "replay")
+    {
+        std::ifstream ifs(args);
+
+        if (!ifs.is_open())
+        {
+            SWSS_LOG_ERROR("failed to open replay file: %s", args.c_str());
+            return nullptr;
+        }
+
+        std::vector<double> values;
+
+        std::string line;
+
+        while (getline(ifs, line))
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            double value;
+
+            if (sscanf(line.c_str(), "%lf", &value) != 1)
+            {
+                SWSS_LOG_ERROR("failed to parse '%s' in replay file %s", line.c_str(), args.c_str());
+                return nullptr;
+            }
+
+            values.push_back(value);
+        }
+
+        if (values.empty())
+        {
+            SWSS_LOG_ERROR("replay file %s has no values", args.c_str());
+            return nullptr;
+        }
+
+        return std::make_shared<ValueGenerator>(values);
+    }
+
+    lai_vs_value_generator_type_t generatorType;
+
+    if (type == "constant")
+        generatorType = LAI_VS_VALUE_GENERATOR_TYPE_CONSTANT;
+    else if (type == "ramp")
+        generatorType = LAI_VS_VALUE_GENERATOR_TYPE_RAMP;
+    else if (type == "random_walk")
+        generatorType = LAI_VS_VALUE_GENERATOR_TYPE_RANDOM_WALK;
+    else if (type == "sine")
+        generatorType = LAI_VS_VALUE_GENERATOR_TYPE_SINE;
+    else
+    {
+        SWSS_LOG_ERROR("unknown generator type: %s", type.c_str());
+        return nullptr;
+    }
+
+    if (generatorType == LAI_VS_VALUE_GENERATOR_TYPE_RAMP && args.find(',') == std::string::npos)
+    {
+        int64_t step;
+        int consumed = 0;
+
+        if (sscanf(args.c_str(), "%" SCNd64 "%n", &step, &consumed) == 1 && args[consumed] == 0)
+        {
+            return std::make_shared<ValueGenerator>(step);
+        }
+    }
+
+    std::vector<double> params;
+
+    for (auto& tok: swss::tokenize(args, ','))
+    {
+        double value;
+
+        if (sscanf(tok.c_str(), "%lf", &value) != 1)
+        {
+            SWSS_LOG_ERROR("failed to parse '%s' as generator param", tok.c_str());
+            return nullptr;
+        }
+
+        params.push_back(value);
+    }
+
+    try
+    {
+        return std::make_shared<ValueGenerator>(generatorType, params);
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("invalid generator '%s': %s", str.c_str(), e.what());
+    }
+
+    return nullptr;
+}
+
+lai_vs_value_generator_type_t ValueGenerator::getType() const
+{
+    SWSS_LOG_ENTER();
+
+    return m_type;
+}
+
+bool ValueGenerator::getIntegerStep(
+        _Out_ int64_t& step) const
+{
+    SWSS_LOG_ENTER();
+
+    step = m_integerStep;
+
+    return m_hasIntegerStep;
+}
+
+double ValueGenerator::random(
+        _Inout_ uint64_t& state)
+{
+    SWSS_LOG_ENTER();
+
+    // splitmix64, uniform value in [0, 1)
+
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+
+    return (double)(z >> 11) / (double)(1ULL << 53);
+}
+
+double ValueGenerator::next(
+        _In_ uint64_t tick,
+        _In_ double previous,
+        _Inout_ uint64_t& randomState) const
+{
+    SWSS_LOG_ENTER();
+
+    switch (m_type)
+    {
+        case LAI_VS_VALUE_GENERATOR_TYPE_CONSTANT:
+
+            return m_params[0];
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_RAMP:
+            {
+                double value = previous + m_params[0];
+
+                if (m_params.size() == 3 && (value > m_params[2] || value < m_params[1]))
+                {
+                    value = (m_params[0] >= 0) ? m_params[1] : m_params[2];
+                }
+
+                return value;
+            }
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_RANDOM_WALK:
+            {
+                double value = previous + m_params[0] * (2.0 * random(randomState) - 1.0);
+
+                return std::min(std::max(value, m_params[1]), m_params[2]);
+            }
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_SINE:
+
+            return m_params[0] + m_params[1] * std::sin(2.0 * M_PI * (double)tick / m_params[2]);
+
+        case LAI_VS_VALUE_GENERATOR_TYPE_REPLAY:
+
+            return m_values[tick % m_values.size()];
+
+        default:
+            SWSS_LOG_THROW("unknown generator type %d", m_type);
+    }
+}
@@ -13,6 +13,7 @@
 
 #include "LinecardStateBase.h"
 #include "LinecardP230C.h"
+#include "LinecardScalable.h"
 
 /*
  * Max number of counters used in 1 api call
@@ -73,6 +74,76 @@ void VirtualLinecardLaiInterface::setMeta(
     m_meta = meta;
 }
 
+lai_status_t VirtualLinecardLaiInterface::createInternalObjects(
+        _In_ lai_object_id_t linecardId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_linecardStateMap.find(linecardId);
+
+    if (it == m_linecardStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find linecard %s in linecard state map", lai_serialize_object_id(linecardId).c_str());
+
+        return LAI_STATUS_FAILURE;
+    }
+
+    auto meta = m_meta.lock();
+
+    if (!meta)
+    {
+        SWSS_LOG_ERROR("meta pointer expired");
+
+        return LAI_STATUS_FAILURE;
+    }
+
+    return it->second->create_internal_objects(meta);
+}
+
+lai_status_t VirtualLinecardLaiInterface::removeInternalObjects(
+        _In_ lai_object_id_t linecardId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_linecardStateMap.find(linecardId);
+
+    if (it == m_linecardStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find linecard %s in linecard state map", lai_serialize_object_id(linecardId).c_str());
+
+        return LAI_STATUS_FAILURE;
+    }
+
+    auto meta = m_meta.lock();
+
+    if (!meta)
+    {
+        SWSS_LOG_ERROR("meta pointer expired");
+
+        return LAI_STATUS_FAILURE;
+    }
+
+    return it->second->remove_internal_objects(meta);
+}
+
+lai_status_t VirtualLinecardLaiInterface::getInternalObjectList(
+        _In_ lai_object_id_t linecardId,
+        _Inout_ lai_object_list_t& objectList)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_linecardStateMap.find(linecardId);
+
+    if (it == m_linecardStateMap.end())
+    {
+        SWSS_LOG_ERROR("failed to find linecard %s in linecard state map", lai_serialize_object_id(linecardId).c_str());
+
+        return LAI_STATUS_INVALID_PARAMETER;
+    }
+
+    return it->second->get_internal_object_list(objectList);
+}
+
 std::string VirtualLinecardLaiInterface::getHardwareInfo(
         _In_ uint32_t attrCount,
         _In_ const lai_attribute_t *attrList) const
@@ -113,19 +184,43 @@ lai_status_t VirtualLinecardLaiInterface::create(
 
             return LAI_STATUS_FAILURE;
         }
+
+        // linecard id is derived from hardware info, so only the index
+        // needs to be released when failure is injected, unless linecard
+        // already exists and is still using it
+
+        auto status = injectLatency(LAI_VS_LATENCY_API_CREATE, linecardId, objectType);
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            if (m_linecardStateMap.find(linecardId) == m_linecardStateMap.end())
+            {
+                m_realObjectIdManager->releaseObjectId(linecardId);
+            }
+
+            return status;
+        }
     }
     else
     {
+        // inject before allocation, so injected failure will not consume
+        // object index
+
+        auto status = injectLatency(LAI_VS_LATENCY_API_CREATE, linecardId, objectType);
+
+        if (status != LAI_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
         // create new real object ID
         *objectId = m_realObjectIdManager->allocateNewObjectId(objectType, linecardId);
     }
 
-    std::string str_object_id = lai_serialize_object_id(*objectId);
-
     return create(
             linecardId,
             objectType,
-            str_object_id,
+            *objectId,
             attr_count,
             attr_list);
 }
@@ -139,7 +234,7 @@ lai_status_t VirtualLinecardLaiInterface::remove(
     return remove(
             linecardIdQuery(objectId),
             objectType,
-            lai_serialize_object_id(objectId));
+            objectId);
 }
 
 lai_status_t VirtualLinecardLaiInterface::preSet(
@@ -167,7 +262,7 @@ lai_status_t VirtualLinecardLaiInterface::set(
     return set(
             linecardIdQuery(objectId),
             objectType,
-            lai_serialize_object_id(objectId),
+            objectId,
             attr);
 }
 
@@ -182,11 +277,38 @@ lai_status_t VirtualLinecardLaiInterface::get(
     return get(
             linecardIdQuery(objectId),
             objectType,
-            lai_serialize_object_id(objectId),
+            objectId,
             attr_count,
             attr_list);
 }
 
+lai_status_t VirtualLinecardLaiInterface::injectLatency(
+        _In_ lai_vs_latency_api_t api,
+        _In_ lai_object_id_t linecardId,
+        _In_ lai_object_type_t objectType)
+{
+    SWSS_LOG_ENTER();
+
+    auto config = m_linecardConfigContainer->getConfig(RealObjectIdManager::getLinecardIndex(linecardId));
+
+    if (config == nullptr || config->m_latencyProfile == nullptr)
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    // objects created by linecard itself are not user API calls, like
+    // for resource limiter
+
+    auto it = m_linecardStateMap.find(linecardId);
+
+    if (it != m_linecardStateMap.end() && it->second->isChangingInternalObjects())
+    {
+        return LAI_STATUS_SUCCESS;
+    }
+
+    return config->m_latencyProfile->inject(api, objectType);
+}
+
 std::shared_ptr<LinecardStateBase> VirtualLinecardLaiInterface::init_linecard(
         _In_ lai_object_id_t linecard_id,
         _In_ std::shared_ptr<LinecardConfig> config,
@@ -215,6 +337,11 @@ std::shared_ptr<LinecardStateBase> VirtualLinecardLaiInterface::init_linecard(
             m_linecardStateMap[linecard_id] = std::make_shared<LinecardP230C>(linecard_id, m_realObjectIdManager, config);
             break;
 
+        case LAI_VS_LINECARD_TYPE_SCALABLE:
+
+            m_linecardStateMap[linecard_id] = std::make_shared<LinecardScalable>(linecard_id, m_realObjectIdManager, config);
+            break;
+
         default:
 
             SWSS_LOG_WARN("unknown linecard type: %d", config->m_linecardType);
@@ -241,12 +368,15 @@ std::shared_ptr<LinecardStateBase> VirtualLinecardLaiInterface::init_linecard(
 lai_status_t VirtualLinecardLaiInterface::create(
         _In_ lai_object_id_t linecardId,
         _In_ lai_object_type_t object_type,
-        _In_ const std::string& serializedObjectId,
+        _In_ lai_object_id_t objectId,
         _In_ uint32_t attr_count,
         _In_ const lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
+    // latency and failure for create are injected by caller before object
+    // id allocation
+
     if (object_type == LAI_OBJECT_TYPE_LINECARD)
     {
         auto linecardIndex = RealObjectIdManager::getLinecardIndex(linecardId);
@@ -256,7 +386,7 @@ lai_status_t VirtualLinecardLaiInterface::create(
         if (config == nullptr)
         {
             SWSS_LOG_ERROR("failed to get linecard config for linecard %s, and index %u",
-                    serializedObjectId.c_str(),
+                    lai_serialize_object_id(objectId).c_str(),
                     linecardIndex);
 
             return LAI_STATUS_FAILURE;
@@ -272,7 +402,7 @@ lai_status_t VirtualLinecardLaiInterface::create(
 
     auto ss = m_linecardStateMap.at(linecardId);
 
-    return ss->create(object_type, serializedObjectId, linecardId, attr_count, attr_list);
+    return ss->create(object_type, objectId, linecardId, attr_count, attr_list);
 }
 
 void VirtualLinecardLaiInterface::removeLinecard(
@@ -293,25 +423,29 @@ void VirtualLinecardLaiInterface::removeLinecard(
 lai_status_t VirtualLinecardLaiInterface::remove(
         _In_ lai_object_id_t linecardId,
         _In_ lai_object_type_t objectType,
-        _In_ const std::string& serializedObjectId)
+        _In_ lai_object_id_t objectId)
 {
     SWSS_LOG_ENTER();
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_REMOVE, linecardId, objectType);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecardId);
 
-    auto status = ss->remove(objectType, serializedObjectId);
+    status = ss->remove(objectType, objectId);
 
     if (objectType == LAI_OBJECT_TYPE_LINECARD &&
             status == LAI_STATUS_SUCCESS)
     {
-        lai_object_id_t object_id;
-        lai_deserialize_object_id(serializedObjectId, object_id);
+        SWSS_LOG_NOTICE("removed linecard: %s", lai_serialize_object_id(objectId).c_str());
 
-        SWSS_LOG_NOTICE("removed linecard: %s", lai_serialize_object_id(object_id).c_str());
+        m_realObjectIdManager->releaseObjectId(objectId);
 
-        m_realObjectIdManager->releaseObjectId(object_id);
-
-        removeLinecard(object_id);
+        removeLinecard(objectId);
     }
 
     return status;
@@ -320,27 +454,41 @@ lai_status_t VirtualLinecardLaiInterface::remove(
 lai_status_t VirtualLinecardLaiInterface::set(
         _In_ lai_object_id_t linecardId,
         _In_ lai_object_type_t objectType,
-        _In_ const std::string &serializedObjectId,
+        _In_ lai_object_id_t objectId,
         _In_ const lai_attribute_t *attr)
 {
     SWSS_LOG_ENTER();
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_SET, linecardId, objectType);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecardId);
 
-    return ss->set(objectType, serializedObjectId, attr);
+    return ss->set(objectType, objectId, attr);
 }
 
 lai_status_t VirtualLinecardLaiInterface::get(
         _In_ lai_object_id_t linecardId,
         _In_ lai_object_type_t objectType,
-        _In_ const std::string& serializedObjectId,
+        _In_ lai_object_id_t objectId,
         _In_ uint32_t attr_count,
         _Inout_ lai_attribute_t *attr_list)
 {
     SWSS_LOG_ENTER();
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_GET, linecardId, objectType);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecardId);
-    return ss->get(objectType, serializedObjectId, attr_count, attr_list);
+    return ss->get(objectType, objectId, attr_count, attr_list);
 }
 
 lai_status_t VirtualLinecardLaiInterface::objectTypeGetAvailability(
@@ -442,6 +590,13 @@ lai_status_t VirtualLinecardLaiInterface::getStatsExt(
         return LAI_STATUS_FAILURE;
     }
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_GET_STATS, linecard_id, object_type);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecard_id);
 
     return ss->getStatsExt(
@@ -511,6 +666,13 @@ lai_status_t VirtualLinecardLaiInterface::getAlarms(
         return LAI_STATUS_FAILURE;
     }
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_GET_ALARMS, linecard_id, object_type);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecard_id);
 
     return ss->getAlarms(
@@ -553,6 +715,13 @@ lai_status_t VirtualLinecardLaiInterface::clearAlarms(
         return LAI_STATUS_FAILURE;
     }
 
+    auto status = injectLatency(LAI_VS_LATENCY_API_CLEAR_ALARMS, linecard_id, object_type);
+
+    if (status != LAI_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
     auto ss = m_linecardStateMap.at(linecard_id);
 
     return ss->clearAlarms(
@@ -604,3 +773,30 @@ void VirtualLinecardLaiInterface::syncProcessEventNetLinkMsg(
         return;
     }
 }
+
+void VirtualLinecardLaiInterface::syncProcessEventLinecardStateChange(
+        _In_ std::shared_ptr<EventPayloadLinecardStateChange> payload)
+{
+    SWSS_LOG_ENTER();
+
+    // link state is common for all linecards
+
+    for (auto& kvp: m_linecardStateMap)
+    {
+        kvp.second->processLinecardStateChange(payload->getOperStatus());
+    }
+}
+
+void VirtualLinecardLaiInterface::syncProcessEventReplayNotification(
+        _In_ std::shared_ptr<EventPayloadReplayNotification> payload)
+{
+    SWSS_LOG_ENTER();
+
+    // recorded linecard id is lairedis virtual id, so like link state,
+    // notification is sent on behalf of all linecards
+
+    for (auto& kvp: m_linecardStateMap)
+    {
+        kvp.second->processReplayNotification(payload->getName(), payload->getSerializedNotification());
+    }
+}